@@ -22,12 +22,14 @@
 enum iox_SubscriberState
 {
     SubscriberState_HAS_DATA,
+    SubscriberState_DEADLINE_MISSED,
 };
 
 /// @brief describes events which can be triggered by a subscriber
 enum iox_SubscriberEvent
 {
     SubscriberEvent_DATA_RECEIVED,
+    SubscriberEvent_DEADLINE_MISSED,
 };
 
 /// @brief describes the current state of a subscriber
@@ -117,6 +119,7 @@ enum iox_AllocationResult
     AllocationResult_UNDEFINED_ERROR,
     AllocationResult_INVALID_PARAMETER_FOR_CHUNK,
     AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    AllocationResult_CHUNK_DELIVERED_INLINE,
     AllocationResult_SUCCESS,
 };
 
@@ -46,6 +46,8 @@ struct cpp2c_Subscriber
 
     bool hasSamples() const noexcept;
 
+    bool hasMissedDeadline() const noexcept;
+
     iox::popo::WaitSetIsConditionSatisfiedCallback
     getCallbackForIsStateConditionSatisfied(const iox::popo::SubscriberState subscriberState) const noexcept;
 
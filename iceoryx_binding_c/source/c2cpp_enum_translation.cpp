@@ -55,6 +55,8 @@ iox::popo::SubscriberEvent subscriberEvent(const iox_SubscriberEvent value) noex
     {
     case SubscriberEvent_DATA_RECEIVED:
         return iox::popo::SubscriberEvent::DATA_RECEIVED;
+    case SubscriberEvent_DEADLINE_MISSED:
+        return iox::popo::SubscriberEvent::DEADLINE_MISSED;
     }
 
     LogFatal() << "invalid iox_SubscriberEvent value";
@@ -68,6 +70,8 @@ iox::popo::SubscriberState subscriberState(const iox_SubscriberState value) noex
     {
     case SubscriberState_HAS_DATA:
         return iox::popo::SubscriberState::HAS_DATA;
+    case SubscriberState_DEADLINE_MISSED:
+        return iox::popo::SubscriberState::DEADLINE_MISSED;
     }
 
     LogFatal() << "invalid iox_SubscriberState value";
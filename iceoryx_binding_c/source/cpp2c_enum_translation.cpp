@@ -69,6 +69,8 @@ iox_AllocationResult allocationResult(const iox::popo::AllocationError value) no
         return AllocationResult_INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER;
     case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
         return AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER;
+    case AllocationError::CHUNK_DELIVERED_INLINE:
+        return AllocationResult_CHUNK_DELIVERED_INLINE;
     }
     return AllocationResult_UNDEFINED_ERROR;
 }
@@ -38,6 +38,11 @@ void cpp2c_Subscriber::enableEvent(iox::popo::TriggerHandle&& triggerHandle,
         iox::popo::SubscriberPortUser(m_portData)
             .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        m_trigger = std::move(triggerHandle);
+        iox::popo::SubscriberPortUser(m_portData)
+            .setConditionVariableForMissedDeadline(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
     }
 }
 
@@ -46,6 +51,7 @@ void cpp2c_Subscriber::disableEvent(const SubscriberEvent subscriberEvent) noexc
     switch (subscriberEvent)
     {
     case SubscriberEvent::DATA_RECEIVED:
+    case SubscriberEvent::DEADLINE_MISSED:
         m_trigger.reset();
         break;
     }
@@ -61,6 +67,11 @@ void cpp2c_Subscriber::enableState(iox::popo::TriggerHandle&& triggerHandle,
         iox::popo::SubscriberPortUser(m_portData)
             .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberState::DEADLINE_MISSED:
+        m_trigger = std::move(triggerHandle);
+        iox::popo::SubscriberPortUser(m_portData)
+            .setConditionVariableForMissedDeadline(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
     }
 }
 
@@ -69,6 +80,7 @@ void cpp2c_Subscriber::disableState(const SubscriberState subscriberState) noexc
     switch (subscriberState)
     {
     case SubscriberState::HAS_DATA:
+    case SubscriberState::DEADLINE_MISSED:
         m_trigger.reset();
         break;
     }
@@ -81,6 +93,9 @@ cpp2c_Subscriber::getCallbackForIsStateConditionSatisfied(const SubscriberState
     {
     case SubscriberState::HAS_DATA:
         return iox::popo::WaitSetIsConditionSatisfiedCallback(iox::cxx::in_place, *this, &cpp2c_Subscriber::hasSamples);
+    case SubscriberState::DEADLINE_MISSED:
+        return iox::popo::WaitSetIsConditionSatisfiedCallback(
+            iox::cxx::in_place, *this, &cpp2c_Subscriber::hasMissedDeadline);
     }
 
     return iox::cxx::nullopt;
@@ -99,3 +114,8 @@ bool cpp2c_Subscriber::hasSamples() const noexcept
 {
     return iox::popo::SubscriberPortUser(m_portData).hasNewChunks();
 }
+
+bool cpp2c_Subscriber::hasMissedDeadline() const noexcept
+{
+    return iox::popo::SubscriberPortUser(m_portData).hasMissedDeadline();
+}
@@ -35,7 +35,8 @@ TEST(c2cpp_enum_translation_test, SubscriberState)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7f942bb1-be58-4aff-b05c-2e78c4648be3");
     constexpr EnumMapping<iox::popo::SubscriberState, iox_SubscriberState> SUBSCRIBER_STATES[]{
-        {iox::popo::SubscriberState::HAS_DATA, SubscriberState_HAS_DATA}};
+        {iox::popo::SubscriberState::HAS_DATA, SubscriberState_HAS_DATA},
+        {iox::popo::SubscriberState::DEADLINE_MISSED, SubscriberState_DEADLINE_MISSED}};
 
     for (const auto subscriberState : SUBSCRIBER_STATES)
     {
@@ -44,6 +45,9 @@ TEST(c2cpp_enum_translation_test, SubscriberState)
         case iox::popo::SubscriberState::HAS_DATA:
             EXPECT_EQ(c2cpp::subscriberState(subscriberState.c), subscriberState.cpp);
             break;
+        case iox::popo::SubscriberState::DEADLINE_MISSED:
+            EXPECT_EQ(c2cpp::subscriberState(subscriberState.c), subscriberState.cpp);
+            break;
             // default intentionally left out in order to get a compiler warning if the enum gets extended and we forgot
             // to extend the test
         }
@@ -68,7 +72,8 @@ TEST(c2cpp_enum_translation_test, SubscriberEvent)
 {
     ::testing::Test::RecordProperty("TEST_ID", "eac05952-7bb1-4265-bd96-1c9c2b5f7327");
     constexpr EnumMapping<iox::popo::SubscriberEvent, iox_SubscriberEvent> SUBSCRIBER_EVENTS[]{
-        {iox::popo::SubscriberEvent::DATA_RECEIVED, SubscriberEvent_DATA_RECEIVED}};
+        {iox::popo::SubscriberEvent::DATA_RECEIVED, SubscriberEvent_DATA_RECEIVED},
+        {iox::popo::SubscriberEvent::DEADLINE_MISSED, SubscriberEvent_DEADLINE_MISSED}};
 
     for (const auto subscriberEvent : SUBSCRIBER_EVENTS)
     {
@@ -77,6 +82,9 @@ TEST(c2cpp_enum_translation_test, SubscriberEvent)
         case iox::popo::SubscriberEvent::DATA_RECEIVED:
             EXPECT_EQ(c2cpp::subscriberEvent(subscriberEvent.c), subscriberEvent.cpp);
             break;
+        case iox::popo::SubscriberEvent::DEADLINE_MISSED:
+            EXPECT_EQ(c2cpp::subscriberEvent(subscriberEvent.c), subscriberEvent.cpp);
+            break;
             // default intentionally left out in order to get a compiler warning if the enum gets extended and we forgot
             // to extend the test
         }
@@ -111,7 +111,8 @@ TEST(cpp2c_enum_translation_test, AllocationResult)
         {iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
          AllocationResult_INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER},
         {iox::popo::AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER,
-         AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER}};
+         AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER},
+        {iox::popo::AllocationError::CHUNK_DELIVERED_INLINE, AllocationResult_CHUNK_DELIVERED_INLINE}};
 
     for (const auto allocationError : ALLOCATION_ERRORS)
     {
@@ -135,6 +136,9 @@ TEST(cpp2c_enum_translation_test, AllocationResult)
         case iox::popo::AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
             EXPECT_EQ(cpp2c::allocationResult(allocationError.cpp), allocationError.c);
             break;
+        case iox::popo::AllocationError::CHUNK_DELIVERED_INLINE:
+            EXPECT_EQ(cpp2c::allocationResult(allocationError.cpp), allocationError.c);
+            break;
             // default intentionally left out in order to get a compiler warning if the enum gets extended and we forgot
             // to extend the test
         }
@@ -21,4 +21,14 @@ if(NOT DEFINED IOX_MINIMAL_LOG_LEVEL)
 endif()
 message(STATUS "[i] IOX_MINIMAL_LOG_LEVEL: " ${IOX_MINIMAL_LOG_LEVEL})
 
+if(NOT DEFINED IOX_CACHE_LINE_PADDING)
+    set(IOX_CACHE_LINE_PADDING ON)
+endif()
+if(IOX_CACHE_LINE_PADDING)
+    set(IOX_CACHE_LINE_PADDING_ENABLED "true")
+else()
+    set(IOX_CACHE_LINE_PADDING_ENABLED "false")
+endif()
+message(STATUS "[i] IOX_CACHE_LINE_PADDING: " ${IOX_CACHE_LINE_PADDING})
+
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_hoofs configuration: >>>>>>>>>>>>>>")
@@ -113,7 +113,11 @@ class LockFreeQueue
 
     Buffer<ElementType, Capacity, BufferIndex> m_buffer;
 
+    /// m_size is modified by every push and pop, the paddings keep the buffer and the members of derived classes
+    /// out of its cache line
+    CacheLinePadding m_paddingBeforeSize;
     std::atomic<uint64_t> m_size{0U};
+    CacheLinePadding m_paddingAfterSize;
 
     // template is needed to distinguish between lvalue and rvalue T references
     // (universal reference type deduction)
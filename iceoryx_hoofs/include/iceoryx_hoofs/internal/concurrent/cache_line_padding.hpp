@@ -0,0 +1,62 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
+#define IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
+
+#include "iceoryx_hoofs/iceoryx_hoofs_deployment.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief the distance in bytes two memory locations must have to not share a cache line, the equivalent of
+/// std::hardware_destructive_interference_size
+constexpr uint64_t CACHE_LINE_SIZE{platform::IOX_CACHE_LINE_SIZE};
+
+/// @brief the size of a CacheLinePadding, a single byte when the paddings are disabled with
+/// '-DIOX_CACHE_LINE_PADDING=OFF' to measure the layout without them
+constexpr uint64_t CACHE_LINE_PADDING_SIZE{build::IOX_CACHE_LINE_PADDING ? CACHE_LINE_SIZE : 1U};
+
+/// @brief Separates the members before and after it by a full cache line. Atomics which are written concurrently
+/// are enclosed by paddings so that they do not share a cache line with unrelated members or with neighbouring
+/// objects in the shared memory, independent of the alignment of the enclosing object.
+/// @note alignas(CACHE_LINE_SIZE) is not used since over-aligned types cannot be created with operator new before
+/// C++17 and the shared memory allocators would have to be aware of the alignment
+/// @code
+/// class Queue
+/// {
+///     uint64_t m_capacity;
+///     CacheLinePadding m_paddingBeforeReadPosition;
+///     std::atomic<uint64_t> m_readPosition;
+///     CacheLinePadding m_paddingAfterReadPosition;
+/// };
+/// @endcode
+struct CacheLinePadding
+{
+    // NOLINTJUSTIFICATION the padding is never accessed, only its size is relevant
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint8_t m_bytes[CACHE_LINE_PADDING_SIZE]{};
+};
+
+static_assert(sizeof(CacheLinePadding) == CACHE_LINE_PADDING_SIZE, "The padding must not be larger than a cache line");
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_CACHE_LINE_PADDING_HPP
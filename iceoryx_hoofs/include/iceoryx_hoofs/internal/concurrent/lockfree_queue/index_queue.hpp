@@ -19,6 +19,7 @@
 #define IOX_HOOFS_LOCKFREE_QUEUE_INDEX_QUEUE_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/cyclic_index.hpp"
 
 #include <atomic>
@@ -119,8 +120,16 @@ class IndexQueue
     // NOLINTNEXTLINE(*avoid-c-arrays)
     Cell m_cells[Capacity];
 
+    /// the positions are modified by every pop respectively push, the paddings keep them in separate cache lines
+    /// which are not shared with the cells or with neighbouring objects
+    CacheLinePadding m_paddingBeforeReadPosition;
     std::atomic<Index> m_readPosition;
+    CacheLinePadding m_paddingBeforeWritePosition;
     std::atomic<Index> m_writePosition;
+    CacheLinePadding m_paddingAfterWritePosition;
+
+    /// @brief verifies at compile time that the positions are separated by the paddings
+    static constexpr bool hasCacheLineSeparatedPositions() noexcept;
 
     /// @brief load the value from m_cells at a position with a given memory order
     /// @param position position to load the value from
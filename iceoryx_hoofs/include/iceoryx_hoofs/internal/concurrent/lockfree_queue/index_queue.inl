@@ -20,6 +20,8 @@
 
 #include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
 
+#include <cstddef>
+
 namespace iox
 {
 namespace concurrent
@@ -29,6 +31,7 @@ inline IndexQueue<Capacity, ValueType>::IndexQueue(ConstructEmpty_t) noexcept
     : m_readPosition(Index(Capacity))
     , m_writePosition(Index(Capacity))
 {
+    static_assert(hasCacheLineSeparatedPositions(), "The positions must not share a cache line");
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
         m_cells[i].store(Index(0U), std::memory_order_relaxed);
@@ -40,12 +43,24 @@ IndexQueue<Capacity, ValueType>::IndexQueue(ConstructFull_t) noexcept
     : m_readPosition(Index(0U))
     , m_writePosition(Index(Capacity))
 {
+    static_assert(hasCacheLineSeparatedPositions(), "The positions must not share a cache line");
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
         m_cells[i].store(Index(i), std::memory_order_relaxed);
     }
 }
 
+template <uint64_t Capacity, typename ValueType>
+constexpr bool IndexQueue<Capacity, ValueType>::hasCacheLineSeparatedPositions() noexcept
+{
+    return offsetof(IndexQueue, m_readPosition)
+               >= offsetof(IndexQueue, m_cells) + sizeof(m_cells) + CACHE_LINE_PADDING_SIZE
+           && offsetof(IndexQueue, m_writePosition)
+                  >= offsetof(IndexQueue, m_readPosition) + sizeof(m_readPosition) + CACHE_LINE_PADDING_SIZE
+           && sizeof(IndexQueue)
+                  >= offsetof(IndexQueue, m_writePosition) + sizeof(m_writePosition) + CACHE_LINE_PADDING_SIZE;
+}
+
 template <uint64_t Capacity, typename ValueType>
 constexpr uint64_t IndexQueue<Capacity, ValueType>::capacity() const noexcept
 {
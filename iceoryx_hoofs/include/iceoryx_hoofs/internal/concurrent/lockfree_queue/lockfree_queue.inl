@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 
+#include <cstddef>
 #include <utility>
 
 namespace iox
@@ -32,6 +33,11 @@ LockFreeQueue<ElementType, Capacity>::LockFreeQueue() noexcept
     : m_freeIndices(IndexQueue<Capacity>::ConstructFull)
     , m_usedIndices(IndexQueue<Capacity>::ConstructEmpty)
 {
+    static_assert(offsetof(LockFreeQueue, m_size)
+                      >= offsetof(LockFreeQueue, m_buffer) + sizeof(m_buffer) + CACHE_LINE_PADDING_SIZE,
+                  "m_size must not share a cache line with the buffer");
+    static_assert(sizeof(LockFreeQueue) >= offsetof(LockFreeQueue, m_size) + sizeof(m_size) + CACHE_LINE_PADDING_SIZE,
+                  "m_size must not share a cache line with a neighbouring object");
 }
 
 template <typename ElementType, uint64_t Capacity>
@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_LOFFLI_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 
 #include <atomic>
@@ -70,8 +71,12 @@ class LoFFLi
 
     uint32_t m_size{0U};
     Index_t m_invalidIndex{0U};
-    std::atomic<Node> m_head{{0U, 1U}};
     iox::memory::RelativePointer<Index_t> m_nextFreeIndex;
+    /// @brief m_head is modified by every pop and push, the paddings keep the members above, which are only read
+    /// after init, and neighbouring objects out of its cache line
+    CacheLinePadding m_paddingBeforeHead;
+    std::atomic<Node> m_head{{0U, 1U}};
+    CacheLinePadding m_paddingAfterHead;
 
   public:
     LoFFLi() noexcept = default;
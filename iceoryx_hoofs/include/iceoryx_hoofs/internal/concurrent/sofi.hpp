@@ -18,6 +18,7 @@
 #define IOX_HOOFS_CONCURRENT_SOFI_HPP
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 
 #include <atomic>
@@ -61,7 +62,7 @@ class SoFi
 
   public:
     /// @brief default constructor which constructs an empty sofi
-    SoFi() noexcept = default;
+    SoFi() noexcept;
 
     /// @brief pushs an element into sofi. if sofi is full the oldest data will be
     ///         returned and the pushed element is stored in its place instead.
@@ -159,8 +160,13 @@ class SoFi
 
     /// @brief the write/read pointers are "atomic pointers" so that they are not
     /// reordered (read or written too late)
+    /// @note the read position is modified by the consumer and the write position by the producer, the paddings
+    /// keep them in separate cache lines
+    CacheLinePadding m_paddingBeforeReadPosition;
     std::atomic<uint64_t> m_readPosition{0};
+    CacheLinePadding m_paddingBeforeWritePosition;
     std::atomic<uint64_t> m_writePosition{0};
+    CacheLinePadding m_paddingAfterWritePosition;
 };
 
 } // namespace concurrent
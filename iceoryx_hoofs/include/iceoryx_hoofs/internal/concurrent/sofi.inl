@@ -19,10 +19,24 @@
 
 #include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
 
+#include <cstddef>
+
 namespace iox
 {
 namespace concurrent
 {
+template <class ValueType, uint64_t CapacityValue>
+SoFi<ValueType, CapacityValue>::SoFi() noexcept
+{
+    static_assert(offsetof(SoFi, m_readPosition) >= offsetof(SoFi, m_size) + sizeof(m_size) + CACHE_LINE_PADDING_SIZE,
+                  "m_readPosition must not share a cache line with the data");
+    static_assert(offsetof(SoFi, m_writePosition)
+                      >= offsetof(SoFi, m_readPosition) + sizeof(m_readPosition) + CACHE_LINE_PADDING_SIZE,
+                  "m_readPosition and m_writePosition must not share a cache line");
+    static_assert(sizeof(SoFi) >= offsetof(SoFi, m_writePosition) + sizeof(m_writePosition) + CACHE_LINE_PADDING_SIZE,
+                  "m_writePosition must not share a cache line with a neighbouring object");
+}
+
 template <class ValueType, uint64_t CapacityValue>
 uint64_t SoFi<ValueType, CapacityValue>::capacity() const noexcept
 {
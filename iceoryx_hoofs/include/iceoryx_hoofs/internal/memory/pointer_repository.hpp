@@ -21,6 +21,8 @@
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace memory
@@ -105,7 +107,10 @@ class PointerRepository
     /// and each needs to initialize it via register calls above
 
     iox::cxx::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    /// @note an id can be registered while other threads search the ids which are already registered, e.g. when a
+    /// shared memory segment is mapped after the start of the application; the entry of the new id is published
+    /// with this maximum
+    std::atomic<uint64_t> m_maxRegistered{0U};
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
 };
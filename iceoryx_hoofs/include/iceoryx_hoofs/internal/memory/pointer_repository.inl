@@ -81,7 +81,7 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
     {
         info.basePtr = nullptr;
     }
-    m_maxRegistered = 0U;
+    m_maxRegistered.store(0U, std::memory_order_release);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -102,7 +102,8 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
 {
-    for (id_t id = 1U; id <= m_maxRegistered; ++id)
+    const auto maxRegistered = m_maxRegistered.load(std::memory_order_acquire);
+    for (id_t id = 1U; id <= maxRegistered; ++id)
     {
         // return first id where the ptr is in the corresponding interval
         if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
@@ -127,9 +128,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + size - 1U);
 
-        if (id > m_maxRegistered)
+        if (id > m_maxRegistered.load(std::memory_order_relaxed))
         {
-            m_maxRegistered = id;
+            m_maxRegistered.store(id, std::memory_order_release);
         }
         return true;
     }
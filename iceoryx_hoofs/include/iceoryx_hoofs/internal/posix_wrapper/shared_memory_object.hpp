@@ -37,6 +37,7 @@ enum class SharedMemoryObjectError
 {
     SHARED_MEMORY_CREATION_FAILED,
     MAPPING_SHARED_MEMORY_FAILED,
+    LOCKING_SHARED_MEMORY_FAILED,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -131,6 +132,33 @@ class SharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(cxx::perms, permissions, cxx::perms::none)
 
+    /// @brief If this is set to true the kernel is advised to back the mapped memory
+    ///        with huge pages to reduce the TLB pressure for large memory. When huge
+    ///        pages are not available the memory is backed with regular pages.
+    IOX_BUILDER_PARAMETER(bool, useHugePages, false)
+
+    /// @brief If this is set to true every page of the shared memory is touched during the
+    ///        creation so that the first access to the memory does not cause a page fault
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+    /// @brief The number of threads which touch the pages concurrently when prefault is set.
+    ///        It is limited to MemoryMap::MAX_NUMBER_OF_PREFAULT_THREADS.
+    IOX_BUILDER_PARAMETER(uint32_t, numberOfPrefaultThreads, 1U)
+
+    /// @brief If this is set to true the shared memory is locked into RAM and never paged out.
+    ///        The creation fails when the memory cannot be locked, e.g. when the limit of
+    ///        locked memory of the process is exceeded.
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+    /// @brief If this is set the shared memory is backed by the file at the given path, e.g. on a
+    ///        tmpfs, hugetlbfs or DAX-capable filesystem, see SharedMemoryBuilder::filePath
+    IOX_BUILDER_PARAMETER(cxx::optional<SharedMemory::FilePath_t>, filePath, cxx::nullopt)
+
+    /// @brief If this is set to true changes to a backing file on a DAX-capable filesystem are
+    ///        durable without an explicit msync. The creation fails when the filesystem does not
+    ///        support it.
+    IOX_BUILDER_PARAMETER(bool, synchronousMapping, false)
+
   public:
     cxx::expected<SharedMemoryObject, SharedMemoryObjectError> create() noexcept;
 };
@@ -62,6 +62,10 @@ enum class MemoryMapFlags : int32_t
     /// @brief PRIVATE and enforce the base address hint
     // NOLINTNEXTLINE(hicpp-signed-bitwise) enum type is defined POSIX, no logical fault
     PRIVATE_CHANGES_AND_FORCE_BASE_ADDRESS_HINT = MAP_PRIVATE | MAP_FIXED,
+
+    /// @brief SHARED and changes to a file on a DAX-capable filesystem are durable without an explicit msync,
+    ///        equal to SHARE_CHANGES when the platform does not support it
+    SHARE_CHANGES_SYNCHRONOUSLY = IOX_MAP_SHARED_SYNC,
 };
 
 class MemoryMap;
@@ -90,6 +94,16 @@ class MemoryMapBuilder
     /// @brief Offset of the memory location
     IOX_BUILDER_PARAMETER(off_t, offset, 0)
 
+    /// @brief If this is set to true the page tables of the mapping are populated during the
+    ///        creation so that the first access to the memory does not cause a page fault.
+    ///        On platforms without MAP_POPULATE every page is touched after the mapping.
+    IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+    /// @brief If this is set to true the mapped memory is locked into RAM and never paged out.
+    ///        The creation fails with MemoryMapError::UNABLE_TO_LOCK when the memory cannot be
+    ///        locked, e.g. when the limit of locked memory of the process is exceeded.
+    IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
   public:
     /// @brief creates a valid MemoryMap object. If the construction failed the expected
     ///        contains an enum value describing the error.
@@ -104,6 +118,8 @@ class MemoryMapBuilder
 class MemoryMap
 {
   public:
+    static constexpr uint32_t MAX_NUMBER_OF_PREFAULT_THREADS{64U};
+
     /// @brief copy operations are removed since we are handling a system resource
     MemoryMap(const MemoryMap&) = delete;
     MemoryMap& operator=(const MemoryMap&) = delete;
@@ -126,6 +142,18 @@ class MemoryMap
     /// @brief returns the base address, if the object was moved it returns nullptr
     void* getBaseAddress() noexcept;
 
+    /// @brief reads every page of the mapped memory so that the page tables are populated
+    ///        and a later access does not cause a page fault
+    /// @param[in] numberOfThreads the pages are split into this many parts which are touched
+    ///            concurrently, it is limited to MAX_NUMBER_OF_PREFAULT_THREADS; the parts for
+    ///            which no thread can be created are touched by the calling thread
+    void prefault(const uint32_t numberOfThreads = 1U) noexcept;
+
+    /// @brief locks the mapped memory into RAM so that it is never paged out, the lock is
+    ///        released when the memory is unmapped
+    /// @return MemoryMapError::UNABLE_TO_LOCK when the memory could not be locked
+    cxx::expected<MemoryMapError> lock() noexcept;
+
     friend class MemoryMapBuilder;
 
   private:
@@ -51,7 +51,7 @@ enum class SharedMemoryError
 };
 
 /// @brief Creates a bare metal shared memory object with the posix functions
-///        shm_open, shm_unlink etc.
+///        shm_open, shm_unlink etc. or alternatively backs it with a regular file.
 ///        It must be used in combination with MemoryMap (or manual mmap calls)
 ///        to gain access to the created/opened shared memory
 class SharedMemory
@@ -60,6 +60,7 @@ class SharedMemory
     static constexpr uint64_t NAME_SIZE = platform::IOX_MAX_SHM_NAME_LENGTH;
     static constexpr int INVALID_HANDLE = -1;
     using Name_t = cxx::string<NAME_SIZE>;
+    using FilePath_t = cxx::string<platform::IOX_MAX_PATH_LENGTH>;
 
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory& operator=(const SharedMemory&) = delete;
@@ -77,6 +78,9 @@ class SharedMemory
     ///        is opened then this class does not have the ownership.
     bool hasOwnership() const noexcept;
 
+    /// @brief returns true when the shared memory is backed by a file, see SharedMemoryBuilder::filePath
+    bool isBackedByFile() const noexcept;
+
     /// @brief removes shared memory with a given name from the system
     /// @param[in] name name of the shared memory
     /// @return true if the shared memory was removed, false if the shared memory did not exist and
@@ -86,7 +90,7 @@ class SharedMemory
     friend class SharedMemoryBuilder;
 
   private:
-    SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept;
+    SharedMemory(const Name_t& name, const int handle, const bool hasOwnership, const bool isBackedByFile) noexcept;
 
     bool unlink() noexcept;
     bool close() noexcept;
@@ -98,6 +102,7 @@ class SharedMemory
     Name_t m_name;
     int m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
+    bool m_isBackedByFile{false};
 };
 
 class SharedMemoryBuilder
@@ -120,6 +125,12 @@ class SharedMemoryBuilder
     /// @brief Defines the size of the shared memory
     IOX_BUILDER_PARAMETER(uint64_t, size, 0U)
 
+    /// @brief Backs the shared memory with the file at the given path instead of a POSIX shared memory object,
+    ///        e.g. on a tmpfs, hugetlbfs or DAX-capable filesystem. The name is then only used for diagnostics.
+    ///        The file is never removed by the SharedMemory so that its content outlives the process and an
+    ///        existing file which is opened with OPEN_OR_CREATE and write access is resized to the requested size.
+    IOX_BUILDER_PARAMETER(cxx::optional<SharedMemory::FilePath_t>, filePath, cxx::nullopt)
+
   public:
     /// @brief creates a valid SharedMemory object. If the construction failed the expected
     ///        contains an enum value describing the error.
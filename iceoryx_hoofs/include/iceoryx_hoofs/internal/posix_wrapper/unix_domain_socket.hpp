@@ -47,6 +47,14 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
     using UdsName_t = cxx::string<LONGEST_VALID_NAME>;
     using Message_t = cxx::string<MAX_MESSAGE_SIZE>;
 
+    /// @brief A received message together with the file descriptor which was transferred with it
+    struct MessageWithFileDescriptor
+    {
+        std::string message;
+        /// @brief is -1 when the message carries no file descriptor
+        int32_t fileDescriptor{-1};
+    };
+
     /// @brief for calling private constructor in create method
     friend class DesignPattern::Creation<UnixDomainSocket, IpcChannelError>;
 
@@ -93,6 +101,20 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
     /// @return received message. In case of an error, IpcChannelError is returned and msg is empty.
     cxx::expected<std::string, IpcChannelError> timedReceive(const units::Duration& timeout) const noexcept;
 
+    /// @brief send a message together with a file descriptor which is duplicated into the receiving process
+    /// @param msg to send
+    /// @param fileDescriptor to transfer, it stays open in the sending process
+    /// @return IpcChannelError if error occured
+    cxx::expected<IpcChannelError> sendWithFileDescriptor(const std::string& msg,
+                                                          const int32_t fileDescriptor) const noexcept;
+
+    /// @brief try to receive a message and the file descriptor which was sent with it for a given timeout duration
+    /// @param timout for the receive operation
+    /// @return received message and file descriptor, the caller owns the file descriptor and has to close it. In case
+    ///         of an error, IpcChannelError is returned.
+    cxx::expected<MessageWithFileDescriptor, IpcChannelError>
+    timedReceiveWithFileDescriptor(const units::Duration& timeout) const noexcept;
+
   private:
     UnixDomainSocket(const IpcChannelName_t& name,
                      const IpcChannelSide channelSide,
@@ -112,6 +134,7 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
     IpcChannelError convertErrnoToIpcChannelError(const int32_t errnum) const noexcept;
 
     cxx::expected<IpcChannelError> closeFileDescriptor() noexcept;
+    cxx::expected<IpcChannelError> setTimeout(const int32_t option, const units::Duration& timeout) const noexcept;
 
   private:
     static constexpr int32_t ERROR_CODE = -1;
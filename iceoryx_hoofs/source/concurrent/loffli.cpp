@@ -19,12 +19,20 @@
 #include "iceoryx_hoofs/cxx/requires.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 
+#include <cstddef>
+
 namespace iox
 {
 namespace concurrent
 {
 void LoFFLi::init(cxx::not_null<Index_t*> freeIndicesMemory, const uint32_t capacity) noexcept
 {
+    static_assert(offsetof(LoFFLi, m_head)
+                      >= offsetof(LoFFLi, m_nextFreeIndex) + sizeof(m_nextFreeIndex) + CACHE_LINE_PADDING_SIZE,
+                  "m_head must not share a cache line with the members which are only read");
+    static_assert(sizeof(LoFFLi) >= offsetof(LoFFLi, m_head) + sizeof(m_head) + CACHE_LINE_PADDING_SIZE,
+                  "m_head must not share a cache line with a neighbouring object");
+
     cxx::Expects(capacity > 0 && "A capacity of 0 is not supported!");
     constexpr uint32_t INTERNALLY_RESERVED_INDICES{1U};
     cxx::Expects(capacity < (std::numeric_limits<Index_t>::max() - INTERNALLY_RESERVED_INDICES)
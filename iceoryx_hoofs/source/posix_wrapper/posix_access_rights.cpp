@@ -25,11 +25,23 @@
 #include "iceoryx_platform/unistd.hpp"
 
 #include <limits>
+#include <mutex>
 
 namespace iox
 {
 namespace posix
 {
+namespace
+{
+/// @brief getpwnam, getpwuid, getgrnam and getgrgid return pointers to static buffers which are overwritten by the
+/// next call from any thread; the results are copied under this mutex
+std::mutex& userAndGroupDatabaseMutex() noexcept
+{
+    static std::mutex mutex;
+    return mutex;
+}
+} // namespace
+
 PosixGroup::PosixGroup(gid_t id) noexcept
     : m_id(id)
     , m_doesExist(getGroupName(id).has_value())
@@ -62,6 +74,7 @@ PosixGroup PosixGroup::getGroupOfCurrentProcess() noexcept
 
 cxx::optional<gid_t> PosixGroup::getGroupID(const PosixGroup::groupName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(userAndGroupDatabaseMutex());
     auto getgrnamCall = posixCall(getgrnam)(name.c_str()).failureReturnValue(nullptr).evaluate();
 
     if (getgrnamCall.has_error())
@@ -75,6 +88,7 @@ cxx::optional<gid_t> PosixGroup::getGroupID(const PosixGroup::groupName_t& name)
 
 cxx::optional<PosixGroup::groupName_t> PosixGroup::getGroupName(gid_t id) noexcept
 {
+    std::lock_guard<std::mutex> lock(userAndGroupDatabaseMutex());
     auto getgrgidCall = posixCall(getgrgid)(id).failureReturnValue(nullptr).evaluate();
 
     if (getgrgidCall.has_error())
@@ -109,6 +123,7 @@ bool PosixGroup::doesExist() const noexcept
 
 cxx::optional<uid_t> PosixUser::getUserID(const userName_t& name) noexcept
 {
+    std::lock_guard<std::mutex> lock(userAndGroupDatabaseMutex());
     auto getpwnamCall = posixCall(getpwnam)(name.c_str()).failureReturnValue(nullptr).evaluate();
 
     if (getpwnamCall.has_error())
@@ -121,6 +136,7 @@ cxx::optional<uid_t> PosixUser::getUserID(const userName_t& name) noexcept
 
 cxx::optional<PosixUser::userName_t> PosixUser::getUserName(uid_t id) noexcept
 {
+    std::lock_guard<std::mutex> lock(userAndGroupDatabaseMutex());
     auto getpwuidCall = posixCall(getpwuid)(id).failureReturnValue(nullptr).evaluate();
 
     if (getpwuidCall.has_error())
@@ -139,15 +155,19 @@ PosixUser::groupVector_t PosixUser::getGroups() const noexcept
         return groupVector_t();
     }
 
-    auto getpwnamCall = posixCall(getpwnam)(userName->c_str()).failureReturnValue(nullptr).evaluate();
-    if (getpwnamCall.has_error())
+    gid_t userDefaultGroup{0};
     {
-        std::cerr << "Error: getpwnam call failed" << std::endl;
-        return groupVector_t();
+        std::lock_guard<std::mutex> lock(userAndGroupDatabaseMutex());
+        auto getpwnamCall = posixCall(getpwnam)(userName->c_str()).failureReturnValue(nullptr).evaluate();
+        if (getpwnamCall.has_error())
+        {
+            std::cerr << "Error: getpwnam call failed" << std::endl;
+            return groupVector_t();
+        }
+
+        userDefaultGroup = getpwnamCall->value->pw_gid;
     }
 
-    gid_t userDefaultGroup = getpwnamCall->value->pw_gid;
-
     /// NOLINTJUSTIFICATION @todo iox-#1614 use upcoming cxx::array
     /// NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
     gid_t groups[MaxNumberOfGroups];
@@ -18,9 +18,11 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/cxx/attributes.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/unistd.hpp"
 
 #include <bitset>
@@ -84,6 +86,7 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
                             .openMode(m_openMode)
                             .filePermissions(m_permissions)
                             .size(m_memorySizeInBytes)
+                            .filePath(m_filePath)
                             .create();
 
     if (!sharedMemory)
@@ -98,7 +101,8 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
                          .length(m_memorySizeInBytes)
                          .fileDescriptor(sharedMemory->getHandle())
                          .accessMode(m_accessMode)
-                         .flags(MemoryMapFlags::SHARE_CHANGES)
+                         .flags((m_synchronousMapping) ? MemoryMapFlags::SHARE_CHANGES_SYNCHRONOUSLY
+                                                       : MemoryMapFlags::SHARE_CHANGES)
                          .offset(0)
                          .create();
 
@@ -109,8 +113,23 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
         return cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
     }
 
+    bool isHugePageAdviceAccepted{false};
+    if (m_useHugePages)
+    {
+        // must be done before the memory is touched since the pages are acquired with the first access
+        posixCall(iox_madvise_hugepage)(memoryMap->getBaseAddress(), m_memorySizeInBytes)
+            .failureReturnValue(-1)
+            .evaluate()
+            .and_then([&](auto&) { isHugePageAdviceAccepted = true; })
+            .or_else([this](auto& r) {
+                IOX_LOG(WARN) << "Unable to back the shared memory [" << m_name << "] with huge pages ("
+                              << r.getHumanReadableErrnum() << "), falling back to regular pages";
+            });
+    }
+
     Allocator allocator(memoryMap->getBaseAddress(), m_memorySizeInBytes);
 
+    bool isPrefaulted{false};
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(DEBUG) << "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name
@@ -145,12 +164,56 @@ cxx::expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBui
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 std::bitset<sizeof(mode_t)>(static_cast<mode_t>(m_permissions)).to_ulong()));
 
+            if (m_prefault)
+            {
+                // the pages are acquired concurrently before they are zeroed, this happens within the
+                // SIGBUS guard since acquiring the pages fails when not enough memory is available
+                memoryMap->prefault(m_numberOfPrefaultThreads);
+                isPrefaulted = true;
+            }
+
             memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
         }
         IOX_LOG(DEBUG) << "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name
                        << "]";
     }
 
+    if (m_prefault && !isPrefaulted)
+    {
+        memoryMap->prefault(m_numberOfPrefaultThreads);
+    }
+
+    const bool isTouched =
+        m_prefault || (sharedMemory->hasOwnership() && platform::IOX_SHM_WRITE_ZEROS_ON_CREATION);
+    if (isHugePageAdviceAccepted && isTouched)
+    {
+        // the advice is accepted even when the filesystem does not provide transparent huge pages, e.g. for /dev/shm
+        // without the mount option huge=advise, therefore the backing of the already touched pages is verified
+        size_t hugePageBackedSize{0U};
+        posixCall(iox_hugepage_backed_size)(memoryMap->getBaseAddress(), &hugePageBackedSize)
+            .failureReturnValue(-1)
+            .evaluate()
+            .and_then([&](auto&) {
+                if (hugePageBackedSize == 0U)
+                {
+                    IOX_LOG(WARN) << "The shared memory [" << m_name
+                                  << "] is backed by regular pages although huge pages were requested. Either mount "
+                                     "the filesystem with 'huge=advise' or place the segment in a file on hugetlbfs";
+                }
+            })
+            .or_else([this](auto& r) {
+                IOX_LOG(DEBUG) << "Unable to verify the huge page backing of the shared memory [" << m_name << "] ("
+                               << r.getHumanReadableErrnum() << ")";
+            });
+    }
+
+    if (m_lockMemory && memoryMap->lock().has_error())
+    {
+        printErrorDetails();
+        IOX_LOG(ERROR) << "Unable to lock the shared memory [" << m_name << "] into RAM";
+        return cxx::error<SharedMemoryObjectError>(SharedMemoryObjectError::LOCKING_SHARED_MEMORY_FAILED);
+    }
+
     return cxx::success<SharedMemoryObject>(
         SharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap), std::move(allocator), m_memorySizeInBytes));
 }
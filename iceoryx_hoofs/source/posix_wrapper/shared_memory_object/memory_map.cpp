@@ -16,7 +16,12 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 
 #include <bitset>
@@ -38,12 +43,19 @@ cxx::expected<MemoryMap, MemoryMapError> MemoryMapBuilder::create() noexcept
         l_memoryProtection = PROT_READ | PROT_WRITE;
         break;
     }
+    auto mapFlags = static_cast<int32_t>(m_flags);
+    if (m_prefault)
+    {
+        // NOLINTNEXTLINE(hicpp-signed-bitwise) flags are defined by POSIX, no logical fault
+        mapFlags |= IOX_MAP_POPULATE;
+    }
+
     // AXIVION Next Construct AutosarC++19_03-A5.2.3, CertC++-EXP55 : Incompatibility with POSIX definition of mmap
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) low-level memory management
     auto result = posixCall(mmap)(const_cast<void*>(m_baseAddressHint),
                                   m_length,
                                   l_memoryProtection,
-                                  static_cast<int32_t>(m_flags),
+                                  mapFlags,
                                   m_fileDescriptor,
                                   m_offset)
 
@@ -55,7 +67,19 @@ cxx::expected<MemoryMap, MemoryMapError> MemoryMapBuilder::create() noexcept
 
     if (result)
     {
-        return cxx::success<MemoryMap>(MemoryMap(result.value().value, m_length));
+        MemoryMap memoryMap(result.value().value, m_length);
+
+        if (m_prefault && IOX_MAP_POPULATE == 0)
+        {
+            memoryMap.prefault();
+        }
+
+        if (m_lockMemory && memoryMap.lock().has_error())
+        {
+            return cxx::error<MemoryMapError>(MemoryMapError::UNABLE_TO_LOCK);
+        }
+
+        return cxx::success<MemoryMap>(std::move(memoryMap));
     }
 
     constexpr uint64_t FLAGS_BIT_SIZE = 32U;
@@ -109,6 +133,9 @@ MemoryMapError MemoryMap::errnoToEnum(const int32_t errnum) noexcept
     case ENODEV:
         std::cerr << "Memory mappings are not supported by the underlying filesystem." << std::endl;
         return MemoryMapError::FILESYSTEM_DOES_NOT_SUPPORT_MEMORY_MAPPING;
+    case EOPNOTSUPP:
+        std::cerr << "The requested mapping flags are not supported by the underlying filesystem." << std::endl;
+        return MemoryMapError::FILESYSTEM_DOES_NOT_SUPPORT_MEMORY_MAPPING;
     case ENOMEM:
         std::cerr << "One or more of the following failures happened:\n"
                   << "  1. Not enough memory available.\n"
@@ -178,6 +205,65 @@ void* MemoryMap::getBaseAddress() noexcept
     return m_baseAddress;
 }
 
+void MemoryMap::prefault(const uint32_t numberOfThreads) noexcept
+{
+    if (m_baseAddress == nullptr)
+    {
+        return;
+    }
+
+    const uint64_t pageSizeInBytes = pageSize();
+    const uint64_t numberOfPages = (m_length + pageSizeInBytes - 1U) / pageSizeInBytes;
+    const uint64_t numberOfParts = algorithm::minVal(
+        static_cast<uint64_t>(algorithm::maxVal(numberOfThreads, 1U)),
+        static_cast<uint64_t>(MAX_NUMBER_OF_PREFAULT_THREADS),
+        algorithm::maxVal(numberOfPages, static_cast<uint64_t>(1U)));
+    const uint64_t pagesPerPart = (numberOfPages + numberOfParts - 1U) / numberOfParts;
+
+    // reading is sufficient to populate the page tables and does not modify memory which is
+    // possibly already in use by another process
+    auto touchPages = [this, pageSizeInBytes, numberOfPages](const uint64_t beginPage, const uint64_t endPage) {
+        const volatile uint8_t* memory = static_cast<const volatile uint8_t*>(m_baseAddress);
+        uint8_t checksum{0U};
+        for (uint64_t page = beginPage; page < algorithm::minVal(endPage, numberOfPages); ++page)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) low-level memory management
+            checksum ^= memory[page * pageSizeInBytes];
+        }
+        IOX_DISCARD_RESULT(checksum);
+    };
+
+    // the threads are joined when they go out of scope; a part whose thread cannot be created is touched by the
+    // calling thread, the prefault is then slower but still complete
+    cxx::vector<cxx::optional<Thread>, MAX_NUMBER_OF_PREFAULT_THREADS> threads;
+    for (uint64_t part = 1U; part < numberOfParts; ++part)
+    {
+        const uint64_t beginPage = part * pagesPerPart;
+        const uint64_t endPage = beginPage + pagesPerPart;
+        threads.emplace_back();
+        ThreadBuilder()
+            .name("iox-prefault")
+            .create(threads.back(), [&touchPages, beginPage, endPage] { touchPages(beginPage, endPage); })
+            .or_else([&](auto&) { touchPages(beginPage, endPage); });
+    }
+    touchPages(0U, pagesPerPart);
+}
+
+cxx::expected<MemoryMapError> MemoryMap::lock() noexcept
+{
+    auto result = posixCall(mlock)(m_baseAddress, m_length).failureReturnValue(-1).evaluate();
+    if (result.has_error())
+    {
+        std::cerr << "Unable to lock the mapped memory [ address = " << std::hex << m_baseAddress
+                  << ", size = " << std::dec << m_length << " ] into RAM ("
+                  << result.get_error().getHumanReadableErrnum()
+                  << "). Is the limit of locked memory of the process (RLIMIT_MEMLOCK) sufficient?" << std::endl;
+        return cxx::error<MemoryMapError>(MemoryMapError::UNABLE_TO_LOCK);
+    }
+
+    return cxx::success<>();
+}
+
 bool MemoryMap::destroy() noexcept
 {
     if (m_baseAddress != nullptr)
@@ -65,59 +65,89 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
         return cxx::error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
     }
 
+    if (m_filePath && !cxx::isValidPathToFile(*m_filePath))
+    {
+        std::cerr << "Shared memory requires a valid path to a file as backing file and \"" << *m_filePath
+                  << "\" is not a valid path to a file" << std::endl;
+        return cxx::error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
+    }
+
     auto nameWithLeadingSlash = addLeadingSlash(m_name);
 
+    // a file backed shared memory is opened and removed like a regular file, everything else is identical; the
+    // posix calls are evaluated inside the lambdas since the verificator must not outlive the call builder
+    auto openResource = [&](const int oflags, const int suppressedErrno) {
+        if (m_filePath)
+        {
+            return posixCall(iox_open)(m_filePath->c_str(), oflags, static_cast<mode_t>(m_filePermissions))
+                .failureReturnValue(SharedMemory::INVALID_HANDLE)
+                .suppressErrorMessagesForErrnos(suppressedErrno)
+                .evaluate();
+        }
+        return posixCall(iox_shm_open)(nameWithLeadingSlash.c_str(), oflags, static_cast<mode_t>(m_filePermissions))
+            .failureReturnValue(SharedMemory::INVALID_HANDLE)
+            .suppressErrorMessagesForErrnos(suppressedErrno)
+            .evaluate();
+    };
+    auto removeResource = [&](const int ignoredErrno) {
+        if (m_filePath)
+        {
+            return posixCall(unlink)(m_filePath->c_str())
+                .failureReturnValue(SharedMemory::INVALID_HANDLE)
+                .ignoreErrnos(ignoredErrno)
+                .evaluate();
+        }
+        return posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            .failureReturnValue(SharedMemory::INVALID_HANDLE)
+            .ignoreErrnos(ignoredErrno)
+            .evaluate();
+    };
+
     // the mask will be applied to the permissions, therefore we need to set it to 0
     int sharedMemoryFileHandle = SharedMemory::INVALID_HANDLE;
+    const bool isBackedByFile = m_filePath.has_value();
+    bool hasOwnership = false;
     mode_t umaskSaved = umask(0U);
     {
         cxx::ScopeGuard umaskGuard([&] { umask(umaskSaved); });
 
         if (m_openMode == OpenMode::PURGE_AND_CREATE)
         {
-            IOX_DISCARD_RESULT(posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
-                                   .failureReturnValue(SharedMemory::INVALID_HANDLE)
-                                   .ignoreErrnos(ENOENT)
-                                   .evaluate());
+            IOX_DISCARD_RESULT(removeResource(ENOENT));
         }
 
-        auto result =
-            posixCall(iox_shm_open)(
-                nameWithLeadingSlash.c_str(),
-                convertToOflags(m_accessMode,
-                                (m_openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : m_openMode),
-                static_cast<mode_t>(m_filePermissions))
-                .failureReturnValue(SharedMemory::INVALID_HANDLE)
-                .suppressErrorMessagesForErrnos((m_openMode == OpenMode::OPEN_OR_CREATE) ? EEXIST : 0)
-                .evaluate();
+        auto result = openResource(
+            convertToOflags(m_accessMode,
+                            (m_openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : m_openMode),
+            (m_openMode == OpenMode::OPEN_OR_CREATE) ? EEXIST : 0);
         if (result.has_error())
         {
             // if it was not possible to create the shm exclusively someone else has the
             // ownership and we just try to open it
             if (m_openMode == OpenMode::OPEN_OR_CREATE && result.get_error().errnum == EEXIST)
             {
-                result = posixCall(iox_shm_open)(nameWithLeadingSlash.c_str(),
-                                                 convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
-                                                 static_cast<mode_t>(m_filePermissions))
-                             .failureReturnValue(SharedMemory::INVALID_HANDLE)
-                             .evaluate();
-                if (!result.has_error())
-                {
-                    constexpr bool HAS_NO_OWNERSHIP = false;
-                    sharedMemoryFileHandle = result->value;
-                    return cxx::success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, HAS_NO_OWNERSHIP));
-                }
+                result = openResource(convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING), 0);
             }
 
-            printError();
-            return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result.get_error().errnum));
+            if (result.has_error())
+            {
+                printError();
+                return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result.get_error().errnum));
+            }
+        }
+        else
+        {
+            hasOwnership = (m_openMode == OpenMode::EXCLUSIVE_CREATE || m_openMode == OpenMode::PURGE_AND_CREATE
+                            || m_openMode == OpenMode::OPEN_OR_CREATE);
         }
         sharedMemoryFileHandle = result->value;
     }
 
-    const bool hasOwnership = (m_openMode == OpenMode::EXCLUSIVE_CREATE || m_openMode == OpenMode::PURGE_AND_CREATE
-                               || m_openMode == OpenMode::OPEN_OR_CREATE);
-    if (hasOwnership)
+    // a backing file outlives the process which created it, therefore an already existing file has to be resized
+    // when it is reused
+    const bool resizeExistingFile =
+        isBackedByFile && m_openMode == OpenMode::OPEN_OR_CREATE && m_accessMode == AccessMode::READ_WRITE;
+    if (hasOwnership || resizeExistingFile)
     {
         auto result = posixCall(ftruncate)(sharedMemoryFileHandle, static_cast<int64_t>(m_size))
                           .failureReturnValue(SharedMemory::INVALID_HANDLE)
@@ -134,25 +164,29 @@ cxx::expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noe
                               << " for SharedMemory \"" << m_name << "\"" << std::endl;
                 });
 
-            posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
-                .failureReturnValue(SharedMemory::INVALID_HANDLE)
-                .evaluate()
-                .or_else([&](auto&) {
+            if (hasOwnership)
+            {
+                removeResource(0).or_else([&](auto&) {
                     std::cerr << "Unable to remove previously created SharedMemory \"" << m_name
                               << "\". This may be a SharedMemory leak." << std::endl;
                 });
+            }
 
-            return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result->errnum));
+            return cxx::error<SharedMemoryError>(SharedMemory::errnoToEnum(result.get_error().errnum));
         }
     }
 
-    return cxx::success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, hasOwnership));
+    return cxx::success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, hasOwnership, isBackedByFile));
 }
 
-SharedMemory::SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept
+SharedMemory::SharedMemory(const Name_t& name,
+                           const int handle,
+                           const bool hasOwnership,
+                           const bool isBackedByFile) noexcept
     : m_name{name}
     , m_handle{handle}
     , m_hasOwnership{hasOwnership}
+    , m_isBackedByFile{isBackedByFile}
 {
 }
 
@@ -170,6 +204,7 @@ void SharedMemory::destroy() noexcept
 void SharedMemory::reset() noexcept
 {
     m_hasOwnership = false;
+    m_isBackedByFile = false;
     m_name = Name_t();
     m_handle = INVALID_HANDLE;
 }
@@ -187,6 +222,7 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& rhs) noexcept
 
         m_name = rhs.m_name;
         m_hasOwnership = rhs.m_hasOwnership;
+        m_isBackedByFile = rhs.m_isBackedByFile;
         m_handle = rhs.m_handle;
 
         rhs.reset();
@@ -204,6 +240,11 @@ bool SharedMemory::hasOwnership() const noexcept
     return m_hasOwnership;
 }
 
+bool SharedMemory::isBackedByFile() const noexcept
+{
+    return m_isBackedByFile;
+}
+
 cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name) noexcept
 {
     auto nameWithLeadingSlash = addLeadingSlash(name);
@@ -223,7 +264,8 @@ cxx::expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t&
 
 bool SharedMemory::unlink() noexcept
 {
-    if (m_hasOwnership)
+    // the backing file is owned by the user and is kept so that its content outlives the process
+    if (m_hasOwnership && !m_isBackedByFile)
     {
         auto unlinkResult = unlinkIfExist(m_name);
         if (unlinkResult.has_error() || !unlinkResult.value())
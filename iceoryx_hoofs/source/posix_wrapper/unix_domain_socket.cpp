@@ -227,15 +227,10 @@ cxx::expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& ms
         return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
     }
 
-    auto tv = timeout.timeval();
-    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv))
-                              .failureReturnValue(ERROR_CODE)
-                              .ignoreErrnos(EWOULDBLOCK)
-                              .evaluate();
-
-    if (setsockoptCall.has_error())
+    auto timeoutResult = setTimeout(SO_SNDTIMEO, timeout);
+    if (timeoutResult.has_error())
     {
-        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+        return timeoutResult;
     }
     auto sendCall = posixCall(iox_sendto)(m_sockfd, msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE, 0, nullptr, 0)
                         .failureReturnValue(ERROR_CODE)
@@ -268,15 +263,10 @@ UnixDomainSocket::timedReceive(const units::Duration& timeout) const noexcept
         return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
     }
 
-    auto tv = timeout.timeval();
-    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv))
-                              .failureReturnValue(ERROR_CODE)
-                              .ignoreErrnos(EWOULDBLOCK)
-                              .evaluate();
-
-    if (setsockoptCall.has_error())
+    auto timeoutResult = setTimeout(SO_RCVTIMEO, timeout);
+    if (timeoutResult.has_error())
     {
-        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+        return cxx::error<IpcChannelError>(timeoutResult.get_error());
     }
     // NOLINTJUSTIFICATION needed for recvfrom
     // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
@@ -295,6 +285,86 @@ UnixDomainSocket::timedReceive(const units::Duration& timeout) const noexcept
     return cxx::success<std::string>(message);
 }
 
+cxx::expected<IpcChannelError> UnixDomainSocket::sendWithFileDescriptor(const std::string& msg,
+                                                                        const int32_t fileDescriptor) const noexcept
+{
+    if (msg.size() > m_maxMessageSize)
+    {
+        return cxx::error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
+    if (IpcChannelSide::SERVER == m_channelSide)
+    {
+        std::cerr << "sending on server side not supported for unix domain socket \"" << m_name << "\"" << std::endl;
+        return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+    }
+
+    auto timeoutResult = setTimeout(SO_SNDTIMEO, units::Duration::fromSeconds(0ULL));
+    if (timeoutResult.has_error())
+    {
+        return timeoutResult;
+    }
+
+    auto sendCall =
+        posixCall(iox_send_with_fd)(m_sockfd, msg.c_str(), msg.size() + NULL_TERMINATOR_SIZE, fileDescriptor)
+            .failureReturnValue(ERROR_CODE)
+            .evaluate();
+
+    if (sendCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(sendCall.get_error().errnum));
+    }
+    return cxx::success<void>();
+}
+
+cxx::expected<UnixDomainSocket::MessageWithFileDescriptor, IpcChannelError>
+UnixDomainSocket::timedReceiveWithFileDescriptor(const units::Duration& timeout) const noexcept
+{
+    if (IpcChannelSide::CLIENT == m_channelSide)
+    {
+        std::cerr << "receiving on client side not supported for unix domain socket \"" << m_name << "\"" << std::endl;
+        return cxx::error<IpcChannelError>(IpcChannelError::INTERNAL_LOGIC_ERROR);
+    }
+
+    auto timeoutResult = setTimeout(SO_RCVTIMEO, timeout);
+    if (timeoutResult.has_error())
+    {
+        return cxx::error<IpcChannelError>(timeoutResult.get_error());
+    }
+    // NOLINTJUSTIFICATION needed for recvmsg
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char message[MAX_MESSAGE_SIZE + 1];
+    int fileDescriptor{INVALID_FD};
+
+    auto recvCall = posixCall(iox_recv_with_fd)(m_sockfd, &message[0], MAX_MESSAGE_SIZE, &fileDescriptor)
+                        .failureReturnValue(ERROR_CODE)
+                        .suppressErrorMessagesForErrnos(EAGAIN, EWOULDBLOCK)
+                        .evaluate();
+    message[MAX_MESSAGE_SIZE] = 0;
+
+    if (recvCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(recvCall.get_error().errnum));
+    }
+    return cxx::success<MessageWithFileDescriptor>(MessageWithFileDescriptor{message, fileDescriptor});
+}
+
+cxx::expected<IpcChannelError> UnixDomainSocket::setTimeout(const int32_t option,
+                                                            const units::Duration& timeout) const noexcept
+{
+    auto tv = timeout.timeval();
+    auto setsockoptCall = posixCall(iox_setsockopt)(m_sockfd, SOL_SOCKET, option, &tv, sizeof(tv))
+                              .failureReturnValue(ERROR_CODE)
+                              .ignoreErrnos(EWOULDBLOCK)
+                              .evaluate();
+
+    if (setsockoptCall.has_error())
+    {
+        return cxx::error<IpcChannelError>(convertErrnoToIpcChannelError(setsockoptCall.get_error().errnum));
+    }
+    return cxx::success<void>();
+}
+
 cxx::expected<IpcChannelError> UnixDomainSocket::initalizeSocket() noexcept
 {
     // initialize the sockAddr data structure with the provided name
@@ -17,8 +17,12 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <cstdio>
+
 namespace
 {
 using namespace testing;
@@ -82,6 +86,59 @@ TEST_F(SharedMemoryObject_Test, CTorOpenNonExistingSharedMemoryObject)
     EXPECT_THAT(sut.has_error(), Eq(true));
 }
 
+TEST_F(SharedMemoryObject_Test, CTorWithHugePagesSucceedsAndFallsBackToRegularPagesWhenUnavailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "24da62a1-5c43-4211-8697-b51a0eaba00e");
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("hugePagesShmMem")
+                   .memorySizeInBytes(4096)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .useHugePages(true)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    int* test = static_cast<int*>(sut->allocate(sizeof(int), 1));
+    ASSERT_THAT(test, Ne(nullptr));
+    *test = 123;
+    EXPECT_THAT(*test, Eq(123));
+}
+
+TEST_F(SharedMemoryObject_Test, HugePageBackedSizeOfTouchedSharedMemoryIsAtMostItsSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f4d756b-9a15-430d-a8f3-978e5d11732f");
+#if !defined(__linux__)
+    GTEST_SKIP() << "The huge page backing can only be determined on Linux";
+#endif
+    constexpr uint64_t MEMORY_SIZE{4U * 1024U * 1024U};
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("hugePagesBackedShmMem")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .useHugePages(true)
+                   .prefault(true)
+                   .create();
+    ASSERT_THAT(sut.has_error(), Eq(false));
+
+    size_t backedSize{MEMORY_SIZE + 1U};
+    ASSERT_THAT(iox_hugepage_backed_size(sut->getBaseAddress(), &backedSize), Eq(0));
+    EXPECT_THAT(backedSize, Le(MEMORY_SIZE));
+}
+
+TEST_F(SharedMemoryObject_Test, HugePageBackedSizeOfUnmappedAddressFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "912cc7da-8112-40b0-8e15-21428ff8f728");
+#if !defined(__linux__)
+    GTEST_SKIP() << "The huge page backing can only be determined on Linux";
+#endif
+    size_t backedSize{0U};
+    EXPECT_THAT(iox_hugepage_backed_size(nullptr, &backedSize), Eq(-1));
+    EXPECT_THAT(errno, Eq(ENOENT));
+}
+
 TEST_F(SharedMemoryObject_Test, AllocateMemoryInSharedMemoryAndReadIt)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6169ac70-a08e-4a19-80e4-57f0d5f89233");
@@ -228,4 +285,151 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, CTorWithPrefaultUsingMultipleThreadsProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70ce2b4e-d658-4ec9-ae92-51e30bc9b167");
+    constexpr uint64_t MEMORY_SIZE{1024U * 1024U + 123U};
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("validShmMem")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .prefault(true)
+                   .numberOfPrefaultThreads(4U)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    const auto* memory = static_cast<const uint8_t*>(sut->getBaseAddress());
+    EXPECT_THAT(std::count(memory, memory + MEMORY_SIZE, 0U), Eq(static_cast<int64_t>(MEMORY_SIZE)));
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryWithPrefaultPreservesTheContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6251374-c2d9-4b45-8111-30015715ee4b");
+    uint64_t memorySize = 128;
+
+    auto shmMemory = iox::posix::SharedMemoryObjectBuilder()
+                         .name("shmSut")
+                         .memorySizeInBytes(memorySize)
+                         .accessMode(iox::posix::AccessMode::READ_WRITE)
+                         .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                         .permissions(cxx::perms::owner_all)
+                         .create();
+
+    ASSERT_THAT(shmMemory.has_error(), Eq(false));
+    int* test = static_cast<int*>(shmMemory->allocate(sizeof(int), 1));
+    *test = 4557;
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmSut")
+                   .memorySizeInBytes(memorySize)
+                   .accessMode(iox::posix::AccessMode::READ_ONLY)
+                   .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                   .permissions(cxx::perms::owner_all)
+                   .prefault(true)
+                   .numberOfPrefaultThreads(2U)
+                   .create();
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(*static_cast<const int*>(sut->getBaseAddress()), Eq(4557));
+}
+
+TEST_F(SharedMemoryObject_Test, CTorWithLockMemorySucceedsForSmallSharedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96ddbcb8-4362-4da1-99bd-86419edb47bc");
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("validShmMem")
+                   .memorySizeInBytes(1024U)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .prefault(true)
+                   .lockMemory(true)
+                   .create();
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(SharedMemoryObject_Test, FileBackedSharedMemoryKeepsItsContentAfterDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b6f3a54-97ef-4c66-9d38-5f0b3e1c2a7d");
+    const posix::SharedMemory::FilePath_t filePath{
+        cxx::TruncateToCapacity, std::string(platform::IOX_LOCK_FILE_PATH_PREFIX) + "iox_shm_object_test_file"};
+    IOX_DISCARD_RESULT(std::remove(filePath.c_str()));
+    constexpr uint64_t MEMORY_SIZE{4096U};
+
+    {
+        auto sut = iox::posix::SharedMemoryObjectBuilder()
+                       .name("fileBackedShm")
+                       .memorySizeInBytes(MEMORY_SIZE)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(iox::posix::OpenMode::OPEN_OR_CREATE)
+                       .permissions(cxx::perms::owner_all)
+                       .filePath(filePath)
+                       .create();
+
+        ASSERT_FALSE(sut.has_error());
+        EXPECT_TRUE(sut->hasOwnership());
+        *static_cast<int*>(sut->allocate(sizeof(int), 1)) = 1337;
+    }
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("fileBackedShm")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::OPEN_OR_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .filePath(filePath)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_FALSE(sut->hasOwnership());
+    EXPECT_THAT(*static_cast<const int*>(sut->getBaseAddress()), Eq(1337));
+    EXPECT_THAT(std::remove(filePath.c_str()), Eq(0));
+}
+
+TEST_F(SharedMemoryObject_Test, FileBackedSharedMemoryResizesAnExistingFile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f2d7c1e-4b5a-4e93-a6c0-2d9e1f7b3c58");
+    const posix::SharedMemory::FilePath_t filePath{
+        cxx::TruncateToCapacity, std::string(platform::IOX_LOCK_FILE_PATH_PREFIX) + "iox_shm_object_test_file"};
+    IOX_DISCARD_RESULT(std::remove(filePath.c_str()));
+    FILE* file = std::fopen(filePath.c_str(), "w");
+    ASSERT_THAT(file, Ne(nullptr));
+    ASSERT_THAT(std::fclose(file), Eq(0));
+
+    constexpr uint64_t MEMORY_SIZE{8192U};
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("fileBackedShm")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::OPEN_OR_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .filePath(filePath)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    auto* memory = static_cast<uint8_t*>(sut->getBaseAddress());
+    memory[MEMORY_SIZE - 1U] = 42U;
+    EXPECT_THAT(memory[MEMORY_SIZE - 1U], Eq(42U));
+    EXPECT_THAT(std::remove(filePath.c_str()), Eq(0));
+}
+
+TEST_F(SharedMemoryObject_Test, FileBackedSharedMemoryWithInvalidPathFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a9e5d2-71f4-4b8e-9a6d-0e5b2c8f4d17");
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("fileBackedShm")
+                   .memorySizeInBytes(1024U)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::OPEN_OR_CREATE)
+                   .permissions(cxx::perms::owner_all)
+                   .filePath(posix::SharedMemory::FilePath_t("/path/to/a/directory/"))
+                   .create();
+
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.get_error(), Eq(posix::SharedMemoryObjectError::SHARED_MEMORY_CREATION_FAILED));
+}
 } // namespace
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_platform/socket.hpp"
+#include "iceoryx_platform/unistd.hpp"
 
 #include "test.hpp"
 
@@ -418,6 +419,62 @@ TEST_F(UnixDomainSocket_test, ReceivingOnClientLeadsToErrorWithTimedReceive)
     receivingOnClientLeadsToError([&] { return client.timedReceive(1_ms); });
 }
 
+TEST_F(UnixDomainSocket_test, SendWithFileDescriptorTransfersMessageAndFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a462bd99-1e86-4d3c-acd6-2e9573411074");
+    // NOLINTJUSTIFICATION required by pipe
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    int pipeFds[2];
+    ASSERT_THAT(pipe(&pipeFds[0]), Eq(0));
+
+    const std::string message = "let me pass";
+    ASSERT_FALSE(client.sendWithFileDescriptor(message, pipeFds[1]).has_error());
+
+    auto received = server.timedReceiveWithFileDescriptor(1_s);
+    ASSERT_FALSE(received.has_error());
+    EXPECT_THAT(received->message, Eq(message));
+    ASSERT_THAT(received->fileDescriptor, Ne(-1));
+    EXPECT_THAT(received->fileDescriptor, Ne(pipeFds[1]));
+
+    constexpr char DATA{'x'};
+    char readData{0};
+    EXPECT_THAT(write(received->fileDescriptor, &DATA, 1U), Eq(1));
+    EXPECT_THAT(read(pipeFds[0], &readData, 1U), Eq(1));
+    EXPECT_THAT(readData, Eq(DATA));
+
+    close(received->fileDescriptor);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+TEST_F(UnixDomainSocket_test, TimedReceiveWithFileDescriptorOfMessageWithoutFileDescriptorProvidesNoFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c0f9f89-ed15-4155-ba5b-e0da09fd3c80");
+    const std::string message = "nothing attached";
+    ASSERT_FALSE(client.send(message).has_error());
+
+    auto received = server.timedReceiveWithFileDescriptor(1_s);
+    ASSERT_FALSE(received.has_error());
+    EXPECT_THAT(received->message, Eq(message));
+    EXPECT_THAT(received->fileDescriptor, Eq(-1));
+}
+
+TEST_F(UnixDomainSocket_test, SendingWithFileDescriptorOnServerLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4f11378-b8dd-4cda-9f22-ecfa0e18711e");
+    auto result = server.sendWithFileDescriptor("hello", STDOUT_FILENO);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(IpcChannelError::INTERNAL_LOGIC_ERROR));
+}
+
+TEST_F(UnixDomainSocket_test, ReceivingWithFileDescriptorOnClientLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d150e625-711c-4b0a-9f6f-77f4f06857be");
+    auto result = client.timedReceiveWithFileDescriptor(1_ms);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(IpcChannelError::INTERNAL_LOGIC_ERROR));
+}
+
 // is not supported on mac os and behaves there like receive
 #if !defined(__APPLE__)
 TIMING_TEST_F(UnixDomainSocket_test, TimedReceiveBlocks, Repeat(5), [&] {
@@ -0,0 +1,269 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_hoofs/iceoryx_hoofs_deployment.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "iceoryx_hoofs/internal/concurrent/sofi.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// @brief separates the synthetic counters and positions independent of IOX_CACHE_LINE_PADDING, so that both
+/// layouts are always compared
+struct FullCacheLine
+{
+    // NOLINTJUSTIFICATION the padding is never accessed, only its size is relevant
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint8_t m_bytes[iox::concurrent::CACHE_LINE_SIZE]{};
+};
+
+/// @brief runs the workload of every thread until the duration elapsed and returns the sum of the operations the
+/// threads performed
+template <typename Workload>
+uint64_t runConcurrently(const uint64_t numberOfThreads, const iox::units::Duration& duration, Workload workload)
+{
+    std::atomic_bool keepRunning{true};
+    std::vector<uint64_t> numberOfOperations(numberOfThreads, 0U);
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([&, i] { numberOfOperations[i] = workload(i, keepRunning); });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration.toMilliseconds()));
+    keepRunning = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    uint64_t sum{0U};
+    for (const auto operations : numberOfOperations)
+    {
+        sum += operations;
+    }
+    return sum;
+}
+
+void printResult(const char* name, const iox::units::Duration& duration, const uint64_t numberOfOperations)
+{
+    std::cout << "[ " << duration << " ] " << std::setw(15) << numberOfOperations << " : " << name << std::endl;
+}
+
+struct AdjacentCounter
+{
+    std::atomic<uint64_t> value{0U};
+};
+
+struct PaddedCounter
+{
+    std::atomic<uint64_t> value{0U};
+    FullCacheLine padding;
+};
+
+/// @brief every thread increments its own counter, the counters are neighbours in an array like the usage counters
+/// of the mempools of a segment
+template <typename Counter>
+uint64_t independentCounters(const uint64_t numberOfThreads, const iox::units::Duration& duration)
+{
+    std::unique_ptr<Counter[]> counters(new Counter[numberOfThreads]);
+    return runConcurrently(numberOfThreads, duration, [&](const uint64_t index, const std::atomic_bool& keepRunning) {
+        uint64_t operations{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            counters[index].value.fetch_add(1U, std::memory_order_relaxed);
+            ++operations;
+        }
+        return operations;
+    });
+}
+
+/// @brief a single producer single consumer ring buffer whose read and write positions are either adjacent or
+/// separated by a cache line like the positions of the SoFi
+template <bool SeparatePositions>
+class SpscRing
+{
+  public:
+    static constexpr uint64_t CAPACITY{1024U};
+
+    bool push(const uint64_t value) noexcept
+    {
+        const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+        if (writePosition - m_readPosition.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+        m_data[writePosition % CAPACITY] = value;
+        m_writePosition.store(writePosition + 1U, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(uint64_t& value) noexcept
+    {
+        const auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+        if (readPosition == m_writePosition.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = m_data[readPosition % CAPACITY];
+        m_readPosition.store(readPosition + 1U, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    struct Empty
+    {
+    };
+    using Padding_t = typename std::conditional<SeparatePositions, FullCacheLine, Empty>::type;
+
+    uint64_t m_data[CAPACITY]{};
+    Padding_t m_paddingBeforeReadPosition;
+    std::atomic<uint64_t> m_readPosition{0U};
+    Padding_t m_paddingBeforeWritePosition;
+    std::atomic<uint64_t> m_writePosition{0U};
+};
+
+template <typename Queue, typename Push, typename Pop>
+uint64_t producerConsumer(Queue& queue, const iox::units::Duration& duration, Push push, Pop pop)
+{
+    constexpr uint64_t PRODUCER{0U};
+    return runConcurrently(2U, duration, [&](const uint64_t index, const std::atomic_bool& keepRunning) {
+        uint64_t operations{0U};
+        uint64_t value{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (index == PRODUCER)
+            {
+                push(queue, value);
+                ++value;
+            }
+            else if (pop(queue, value))
+            {
+                ++operations;
+            }
+        }
+        return operations;
+    });
+}
+
+template <bool SeparatePositions>
+uint64_t spscRing(const iox::units::Duration& duration)
+{
+    std::unique_ptr<SpscRing<SeparatePositions>> ring(new SpscRing<SeparatePositions>());
+    return producerConsumer(
+        *ring,
+        duration,
+        [](SpscRing<SeparatePositions>& queue, const uint64_t value) { queue.push(value); },
+        [](SpscRing<SeparatePositions>& queue, uint64_t& value) { return queue.pop(value); });
+}
+
+uint64_t sofi(const iox::units::Duration& duration)
+{
+    using SoFi_t = iox::concurrent::SoFi<uint64_t, 1024U>;
+    std::unique_ptr<SoFi_t> queue(new SoFi_t());
+    return producerConsumer(
+        *queue,
+        duration,
+        [](SoFi_t& sofi, const uint64_t value) {
+            uint64_t overflowValue{0U};
+            sofi.push(value, overflowValue);
+        },
+        [](SoFi_t& sofi, uint64_t& value) { return sofi.pop(value); });
+}
+
+uint64_t lockFreeQueue(const iox::units::Duration& duration)
+{
+    using Queue_t = iox::concurrent::LockFreeQueue<uint64_t, 1024U>;
+    std::unique_ptr<Queue_t> queue(new Queue_t());
+    return producerConsumer(
+        *queue,
+        duration,
+        [](Queue_t& lockFreeQueue, const uint64_t value) { lockFreeQueue.tryPush(value); },
+        [](Queue_t& lockFreeQueue, uint64_t& value) {
+            auto maybeValue = lockFreeQueue.pop();
+            if (maybeValue.has_value())
+            {
+                value = *maybeValue;
+                return true;
+            }
+            return false;
+        });
+}
+
+/// @brief every thread pops and pushes an index of its own LoFFLi, the LoFFLis are neighbours in an array like the
+/// free-lists of the mempools of a segment
+uint64_t loffliPerThread(const uint64_t numberOfThreads, const iox::units::Duration& duration)
+{
+    using iox::concurrent::LoFFLi;
+    constexpr uint32_t CAPACITY{64U};
+    std::unique_ptr<LoFFLi[]> loffli(new LoFFLi[numberOfThreads]);
+    std::vector<LoFFLi::Index_t> indexMemory(numberOfThreads * LoFFLi::requiredIndexMemorySize(CAPACITY));
+    for (uint64_t i = 0U; i < numberOfThreads; ++i)
+    {
+        loffli[i].init(&indexMemory[i * LoFFLi::requiredIndexMemorySize(CAPACITY)], CAPACITY);
+    }
+
+    return runConcurrently(numberOfThreads, duration, [&](const uint64_t index, const std::atomic_bool& keepRunning) {
+        uint64_t operations{0U};
+        LoFFLi::Index_t freeIndex{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (loffli[index].pop(freeIndex))
+            {
+                loffli[index].push(freeIndex);
+                ++operations;
+            }
+        }
+        return operations;
+    });
+}
+
+int main()
+{
+    using namespace iox::units::duration_literals;
+    auto timeout = 1_s;
+
+    constexpr uint64_t MAX_NUMBER_OF_THREADS{8U};
+    const uint64_t numberOfThreads =
+        std::min(std::max<uint64_t>(std::thread::hardware_concurrency(), 2U), MAX_NUMBER_OF_THREADS);
+    std::cout << "cache line size: " << iox::concurrent::CACHE_LINE_SIZE << " bytes, threads: " << numberOfThreads
+              << ", IOX_CACHE_LINE_PADDING: " << (iox::build::IOX_CACHE_LINE_PADDING ? "ON" : "OFF") << std::endl;
+    if (std::thread::hardware_concurrency() < 2U)
+    {
+        std::cout << "Only a single core is available, the results do not show the effect of false sharing"
+                  << std::endl;
+    }
+
+    printResult("independentCounters<AdjacentCounter>",
+                timeout,
+                independentCounters<AdjacentCounter>(numberOfThreads, timeout));
+    printResult(
+        "independentCounters<PaddedCounter>", timeout, independentCounters<PaddedCounter>(numberOfThreads, timeout));
+    printResult("spscRing<adjacent positions>", timeout, spscRing<false>(timeout));
+    printResult("spscRing<separate positions>", timeout, spscRing<true>(timeout));
+    printResult("SoFi", timeout, sofi(timeout));
+    printResult("LockFreeQueue", timeout, lockFreeQueue(timeout));
+    printResult("loffliPerThread", timeout, loffliPerThread(numberOfThreads, timeout));
+}
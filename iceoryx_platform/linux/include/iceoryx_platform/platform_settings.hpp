@@ -17,6 +17,7 @@
 #define IOX_HOOFS_LINUX_PLATFORM_PLATFORM_SETTINGS_HPP
 
 #include <cstdint>
+#include <type_traits>
 #include <linux/limits.h>
 
 namespace iox
@@ -26,6 +27,7 @@ namespace platform
 /// defined in the man sem_overview
 constexpr uint64_t IOX_MAX_SEMAPHORE_NAME_LENGTH = NAME_MAX - 4;
 constexpr bool IOX_SUPPORT_NAMED_SEMAPHORE_OVERFLOW_DETECTION = true;
+constexpr bool IOX_SUPPORT_MEMFD = true;
 
 constexpr uint64_t IOX_MAX_FILENAME_LENGTH = 255U;
 constexpr uint64_t IOX_MAX_PATH_LENGTH = 1023U;
@@ -36,6 +38,7 @@ constexpr const char IOX_PATH_SEPARATORS[IOX_NUMBER_OF_PATH_SEPARATORS] = {'/'};
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 4096;
 constexpr const char IOX_UDS_SOCKET_PATH_PREFIX[] = "/tmp/";
 constexpr const char IOX_LOCK_FILE_PATH_PREFIX[] = "/tmp/";
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
 
 template <typename C, typename... Cargs>
 using invoke_result = std::result_of<C(Cargs...)>;
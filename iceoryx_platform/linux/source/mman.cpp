@@ -16,6 +16,11 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
@@ -27,3 +32,89 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_hugepage_backed_size(const void* addr, size_t* backedSize)
+{
+    // the smaps of the process list every mapping followed by its statistics in kB; a mapping is backed by huge pages
+    // when it resides on hugetlbfs or when transparent huge pages are in use for it
+    FILE* smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == nullptr)
+    {
+        return -1;
+    }
+
+    constexpr unsigned long REGULAR_PAGE_SIZE_IN_KB{4U};
+    constexpr size_t BYTES_PER_KB{1024U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) required as buffer for fgets
+    char line[256];
+    bool isInMapping{false};
+    bool wasFound{false};
+    unsigned long sizeInKb{0U};
+    unsigned long hugePagesInKb{0U};
+    while (fgets(&line[0], sizeof(line), smaps) != nullptr)
+    {
+        unsigned long begin{0U};
+        unsigned long end{0U};
+        unsigned long value{0U};
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg, hicpp-vararg) sscanf is required to parse the smaps
+        if (sscanf(&line[0], "%lx-%lx ", &begin, &end) == 2)
+        {
+            if (wasFound)
+            {
+                break;
+            }
+            isInMapping = (begin == reinterpret_cast<unsigned long>(addr));
+            wasFound = isInMapping;
+        }
+        else if (!isInMapping)
+        {
+            continue;
+        }
+        else if (sscanf(&line[0], "Size: %lu kB", &value) == 1)
+        {
+            sizeInKb = value;
+        }
+        else if (sscanf(&line[0], "KernelPageSize: %lu kB", &value) == 1)
+        {
+            hugePagesInKb += (value > REGULAR_PAGE_SIZE_IN_KB) ? sizeInKb : 0U;
+        }
+        else if (sscanf(&line[0], "AnonHugePages: %lu kB", &value) == 1
+                 || sscanf(&line[0], "ShmemPmdMapped: %lu kB", &value) == 1
+                 || sscanf(&line[0], "FilePmdMapped: %lu kB", &value) == 1)
+        {
+            hugePagesInKb += value;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    }
+    fclose(smaps);
+
+    if (!wasFound)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+
+    *backedSize = static_cast<size_t>(hugePagesInKb) * BYTES_PER_KB;
+    return 0;
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_memfd_create(const char* name)
+{
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) flags are defined by the kernel, no logical fault
+    return memfd_create(name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_memfd_seal(int fd)
+{
+    // NOLINTNEXTLINE(hicpp-signed-bitwise, cppcoreguidelines-pro-type-vararg) defined by the kernel, no logical fault
+    return fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+}
@@ -15,6 +15,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/socket.hpp"
+#include <cstring>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -59,3 +61,73 @@ int iox_closesocket(int sockfd)
 {
     return close(sockfd);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+ssize_t iox_send_with_fd(int sockfd, const void* buf, size_t len, int fd)
+{
+    struct iovec iov;
+    iov.iov_base = const_cast<void*>(buf);
+    iov.iov_len = len;
+
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr alignment;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(header), &fd, sizeof(int));
+
+    return sendmsg(sockfd, &message, 0);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+ssize_t iox_recv_with_fd(int sockfd, void* buf, size_t len, int* fd)
+{
+    struct iovec iov;
+    iov.iov_base = buf;
+    iov.iov_len = len;
+
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr alignment;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    *fd = -1;
+    // the received file descriptor must not leak into processes which are started with exec
+    ssize_t result = recvmsg(sockfd, &message, MSG_CMSG_CLOEXEC);
+    if (result < 0)
+    {
+        return result;
+    }
+
+    for (struct cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header))
+    {
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS)
+        {
+            memcpy(fd, CMSG_DATA(header), sizeof(int));
+        }
+    }
+
+    return result;
+}
@@ -17,6 +17,7 @@
 #define IOX_HOOFS_MAC_PLATFORM_PLATFORM_SETTINGS_HPP
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -25,6 +26,7 @@ namespace platform
 /// defined so that it is consistent to linux
 constexpr uint64_t IOX_MAX_SEMAPHORE_NAME_LENGTH = 251U;
 constexpr bool IOX_SUPPORT_NAMED_SEMAPHORE_OVERFLOW_DETECTION = false;
+constexpr bool IOX_SUPPORT_MEMFD = false;
 
 constexpr uint64_t IOX_MAX_FILENAME_LENGTH = 255U;
 constexpr uint64_t IOX_MAX_PATH_LENGTH = 1023U;
@@ -37,6 +39,13 @@ constexpr const char IOX_PATH_SEPARATORS[IOX_NUMBER_OF_PATH_SEPARATORS] = {'/'};
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 2048;
 constexpr const char IOX_UDS_SOCKET_PATH_PREFIX[] = "/tmp/";
 constexpr const char IOX_LOCK_FILE_PATH_PREFIX[] = "/tmp/";
+/// Apple silicon fetches pairs of 64 byte cache lines, two objects which are closer than 128 bytes can falsely share
+/// a cache line
+#if defined(__aarch64__)
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 128U;
+#else
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
+#endif
 
 template <typename C, typename... Cargs>
 using invoke_result = std::invoke_result<C, Cargs...>;
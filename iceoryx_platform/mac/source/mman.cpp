@@ -37,3 +37,33 @@ int iox_shm_unlink(const char* name)
     }
     return state;
 }
+
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_hugepage_backed_size(const void* addr, size_t* backedSize)
+{
+    static_cast<void>(addr);
+    static_cast<void>(backedSize);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_memfd_create(const char* name)
+{
+    static_cast<void>(name);
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_memfd_seal(int fd)
+{
+    static_cast<void>(fd);
+    errno = ENOSYS;
+    return -1;
+}
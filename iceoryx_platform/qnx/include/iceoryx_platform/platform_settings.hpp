@@ -17,6 +17,7 @@
 #define IOX_HOOFS_QNX_PLATFORM_PLATFORM_SETTINGS_HPP
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -25,6 +26,7 @@ namespace platform
 /// defined so that it is consistent to linux
 constexpr uint64_t IOX_MAX_SEMAPHORE_NAME_LENGTH = 251U;
 constexpr bool IOX_SUPPORT_NAMED_SEMAPHORE_OVERFLOW_DETECTION = true;
+constexpr bool IOX_SUPPORT_MEMFD = false;
 
 constexpr uint64_t IOX_MAX_FILENAME_LENGTH = 255U;
 constexpr uint64_t IOX_MAX_PATH_LENGTH = 1023U;
@@ -35,6 +37,7 @@ constexpr const char IOX_PATH_SEPARATORS[IOX_NUMBER_OF_PATH_SEPARATORS] = {'/'};
 constexpr uint64_t IOX_UDS_SOCKET_MAX_MESSAGE_SIZE = 2048;
 constexpr const char IOX_UDS_SOCKET_PATH_PREFIX[] = "/tmp/";
 constexpr const char IOX_LOCK_FILE_PATH_PREFIX[] = "/var/lock/";
+constexpr uint64_t IOX_CACHE_LINE_SIZE = 64U;
 
 template <typename C, typename... Cargs>
 using invoke_result = std::result_of<C(Cargs...)>;
@@ -16,6 +16,8 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     return shm_open(name, oflag, mode);
@@ -25,3 +27,33 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_hugepage_backed_size(const void* addr, size_t* backedSize)
+{
+    static_cast<void>(addr);
+    static_cast<void>(backedSize);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_memfd_create(const char* name)
+{
+    static_cast<void>(name);
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_memfd_seal(int fd)
+{
+    static_cast<void>(fd);
+    errno = ENOSYS;
+    return -1;
+}
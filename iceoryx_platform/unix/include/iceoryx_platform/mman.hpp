@@ -19,7 +19,33 @@
 
 #include <sys/mman.h>
 
+/// @brief mmap flag which populates the page tables of a mapping during its creation,
+///        it is 0 when the platform does not support it
+constexpr int IOX_MAP_POPULATE = 0;
+
+/// @brief mmap flags for a shared mapping of a file on a DAX-capable filesystem whose changes are durable without
+///        an explicit msync, it is a plain MAP_SHARED when the platform does not support it
+constexpr int IOX_MAP_SHARED_SYNC = MAP_SHARED;
+
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 
+/// @brief advises the kernel to back the memory range with huge pages
+/// @return 0 on success, -1 and errno set otherwise, errno is EINVAL when the platform does not support huge pages
+int iox_madvise_hugepage(void* addr, size_t length);
+
+/// @brief determines how many bytes of the mapping which starts at addr are backed by huge pages, only the pages which
+/// were already accessed are considered
+/// @return 0 on success, -1 and errno set otherwise, errno is EINVAL when the platform does not support huge pages
+int iox_hugepage_backed_size(const void* addr, size_t* backedSize);
+
+/// @brief creates an anonymous memory file which supports sealing and is closed on exec
+/// @return the file descriptor, -1 and errno set otherwise, errno is ENOSYS when the platform does not support it
+int iox_memfd_create(const char* name);
+
+/// @brief seals the size of a memory file created with iox_memfd_create, it can neither grow nor shrink afterwards
+///        and no further seals can be added
+/// @return 0 on success, -1 and errno set otherwise, errno is ENOSYS when the platform does not support it
+int iox_memfd_seal(int fd);
+
 #endif // IOX_HOOFS_UNIX_PLATFORM_MMAN_HPP
@@ -35,4 +35,13 @@ ssize_t iox_recvfrom(int sockfd, void* buf, size_t len, int flags, struct sockad
 int iox_connect(int sockfd, const struct sockaddr* addr, socklen_t addrlen);
 int iox_closesocket(int sockfd);
 
+/// @brief sends a message together with a file descriptor as SCM_RIGHTS ancillary data over a unix domain socket
+/// @return the number of sent bytes, -1 and errno set otherwise, errno is ENOSYS when the platform does not support it
+ssize_t iox_send_with_fd(int sockfd, const void* buf, size_t len, int fd);
+
+/// @brief receives a message which was sent with iox_send_with_fd, fd is -1 when the message carries no file descriptor
+/// @return the number of received bytes, -1 and errno set otherwise, errno is ENOSYS when the platform does not
+///         support it
+ssize_t iox_recv_with_fd(int sockfd, void* buf, size_t len, int* fd);
+
 #endif // IOX_HOOFS_WIN_PLATFORM_SOCKET_HPP
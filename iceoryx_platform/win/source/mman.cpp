@@ -82,6 +82,17 @@ int munmap(void* addr, size_t length)
     return -1;
 }
 
+int mlock(const void* addr, size_t length)
+{
+    if (Win32Call(VirtualLock, const_cast<void*>(addr), length).value)
+    {
+        return 0;
+    }
+
+    errno = ENOMEM;
+    return -1;
+}
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     HANDLE sharedMemoryHandle{nullptr};
@@ -172,3 +183,33 @@ int iox_shm_unlink(const char* name)
     errno = ENOENT;
     return -1;
 }
+
+int iox_madvise_hugepage(void* addr, size_t length)
+{
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_hugepage_backed_size(const void* addr, size_t* backedSize)
+{
+    static_cast<void>(addr);
+    static_cast<void>(backedSize);
+    errno = EINVAL;
+    return -1;
+}
+
+int iox_memfd_create(const char* name)
+{
+    static_cast<void>(name);
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_memfd_seal(int fd)
+{
+    static_cast<void>(fd);
+    errno = ENOSYS;
+    return -1;
+}
@@ -15,6 +15,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/socket.hpp"
+#include <cerrno>
 #include <cstdio>
 
 int iox_bind(int sockfd, const struct sockaddr* addr, socklen_t addrlen)
@@ -59,3 +60,18 @@ int iox_closesocket(int sockfd)
     fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
     return 0;
 }
+
+ssize_t iox_send_with_fd(int sockfd, const void* buf, size_t len, int fd)
+{
+    fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
+    errno = ENOSYS;
+    return -1;
+}
+
+ssize_t iox_recv_with_fd(int sockfd, void* buf, size_t len, int* fd)
+{
+    fprintf(stderr, "%s is not implemented in windows!\n", __PRETTY_FUNCTION__);
+    *fd = -1;
+    errno = ENOSYS;
+    return -1;
+}
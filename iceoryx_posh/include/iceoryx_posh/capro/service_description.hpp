@@ -148,9 +148,19 @@ class ServiceDescription
     ClassHash getClassHash() const noexcept;
     ///@}
 
+    /// @brief Returns the hash of the service, instance and event string. It is calculated once on construction and
+    ///        equal ServiceDescriptions have an equal hash. This allows a fast pre-check before the strings are
+    ///        compared and to use the ServiceDescription as key in hash based lookups.
+    uint64_t getHash() const noexcept;
+
     /// @brief Returns the interface form where the service is coming from.
     Interfaces getSourceInterface() const noexcept;
 
+  private:
+    static uint64_t calculateHash(const IdString_t& service,
+                                  const IdString_t& instance,
+                                  const IdString_t& event) noexcept;
+
   private:
     /// @brief string representation of the service
     IdString_t m_serviceString;
@@ -159,6 +169,9 @@ class ServiceDescription
     /// @brief string representation of the event
     IdString_t m_eventString;
 
+    /// @brief hash of the service, instance and event string, see getHash
+    uint64_t m_hash{0U};
+
     /// @brief 128-Bit class hash (32-Bit * 4)
     ClassHash m_classHash{0, 0, 0, 0};
 
@@ -82,6 +82,7 @@ namespace iox
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER) \
+    error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_APPEND_SEGMENT_FROM_USER) \
     error(POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER) \
     error(POPO__CHUNK_TRY_LOCK_ERROR) \
     error(POPO__CHUNK_LOCKING_ERROR) \
@@ -111,6 +112,10 @@ namespace iox
     error(MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS) \
     error(MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT) \
     error(MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL) \
+    error(MEPOO__BUDDY_MEMPOOL_INVALID_CONFIGURATION) \
+    error(MEPOO__BUDDY_MEMPOOL_MUTEX_CREATION_FAILED) \
+    error(MEPOO__BUDDY_MEMPOOL_LOCKING_ERROR) \
+    error(MEPOO__BUDDY_MEMPOOL_UNLOCKING_ERROR) \
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
     error(MEPOO__TYPED_MEMPOOL_MANAGEMENT_SEGMENT_IS_BROKEN) \
     error(MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT) \
@@ -150,6 +155,7 @@ namespace iox
     error(IPC_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_CHANNEL) \
     error(IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS) \
     error(IPC_INTERFACE__REG_ACK_NO_RESPONSE) \
+    error(IPC_INTERFACE__REG_ACK_WITHOUT_MGMT_MEMORY_FILE_DESCRIPTOR) \
     error(IPC_INTERFACE__APP_WITH_SAME_NAME_STILL_RUNNING) \
     error(IPC_INTERFACE__COULD_NOT_ACQUIRE_FILE_LOCK)
 
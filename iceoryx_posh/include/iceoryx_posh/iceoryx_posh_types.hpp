@@ -65,6 +65,20 @@ constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+/// @brief the number of publishers per subscriber whose publish-to-take latency is recorded in a separate histogram
+constexpr uint32_t MAX_LATENCY_HISTOGRAMS_PER_SUBSCRIBER = 4U;
+/// @brief the number of buckets of a latency histogram, the bucket bounds are powers of two microseconds and the last
+/// bucket counts all latencies of 2^18 us and more
+constexpr uint32_t NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS = 20U;
+/// @brief the number of slots of a subscriber queue into which the samples of publishers with inline delivery are
+/// copied, it limits the pending and the held inline samples together
+constexpr uint32_t MAX_INLINE_SLOTS_PER_SUBSCRIBER = 8U;
+/// @brief the number of subscribers which can have inline slots, the slots are taken from a pool of this size when a
+/// subscriber is connected to its first publisher with inline delivery; further subscribers receive the samples of
+/// such publishers as chunks
+constexpr uint32_t MAX_SUBSCRIBERS_WITH_INLINE_SLOTS = (MAX_SUBSCRIBERS < 64U) ? MAX_SUBSCRIBERS : 64U;
+/// @brief the largest user-payload which can be delivered inline
+constexpr uint32_t MAX_INLINE_USER_PAYLOAD_SIZE = 64U;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
@@ -121,9 +135,13 @@ constexpr uint32_t CHUNK_NO_USER_HEADER_ALIGNMENT{1U};
 
 // Message Queue
 constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
-constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
+/// @brief the messages between the runtimes and RouDi use the full message size of the unix domain sockets, without
+/// the null terminator, so that a batch of port requests of PoshRuntime::createPorts fits into a single message
+constexpr uint32_t ROUDI_MESSAGE_SIZE = static_cast<uint32_t>(platform::IOX_UDS_SOCKET_MAX_MESSAGE_SIZE - 1U);
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
-constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+constexpr uint32_t APP_MESSAGE_SIZE = ROUDI_MESSAGE_SIZE;
+/// @brief maximum number of ports which can be requested with a single call to PoshRuntime::createPorts
+constexpr uint32_t MAX_PORT_REQUESTS_PER_BATCH = 64U;
 
 
 // Processes
@@ -223,6 +241,14 @@ constexpr const char SHM_NAME[] = "iceoryx_mgmt";
 // this is used by the UniquePortId
 constexpr uint16_t DEFAULT_UNIQUE_ROUDI_ID{0U};
 
+/// @brief maximum number of worker threads which process the messages from the runtimes
+constexpr uint32_t MAX_RUNTIME_MESSAGE_WORKERS{16U};
+/// @brief number of messages which can be queued for a single runtime message worker
+constexpr uint32_t RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY{64U};
+/// @brief default number of threads processing the messages from the runtimes; with one thread, the messages are
+/// processed by the thread which receives them
+constexpr uint32_t DEFAULT_RUNTIME_MESSAGE_WORKERS{1U};
+
 // Timeout
 using namespace units::duration_literals;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
@@ -254,6 +280,12 @@ using BaseClock_t = std::chrono::steady_clock;
 // when sleep_until() is used with a timepoint in the past
 using DurationNs_t = std::chrono::duration<std::int64_t, std::nano>;
 using TimePointNs_t = std::chrono::time_point<BaseClock_t, DurationNs_t>;
+
+/// @brief identifies mempools which are reserved for the publishers and servers requesting the reservation,
+/// these ports never allocate from the shared mempools and all other ports never allocate from the reserved ones
+using MemPoolReservation_t = uint32_t;
+/// @brief the reservation of the mempools which are shared by all ports without a reservation
+constexpr MemPoolReservation_t NO_MEMPOOL_RESERVATION{0U};
 } // namespace mepoo
 
 namespace runtime
@@ -0,0 +1,133 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_BUDDY_MEM_POOL_HPP
+#define IOX_POSH_MEPOO_BUDDY_MEM_POOL_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A mempool with variable-size chunks which are carved out of a single arena by a buddy allocator. A chunk
+/// has the size of the smallest power-of-two multiple of the min chunk size which fits the requested size, therefore
+/// the internal fragmentation is below 50% for every chunk size instead of only for the chunk sizes in the vicinity
+/// of a fixed-size mempool. The allocation and deallocation is bounded by the number of orders and protected by a
+/// robust inter-process mutex since the split and merge of the blocks cannot be done lock-free.
+/// @note The block states and the free-list links are stored in the management memory, like the free indices of a
+/// MemPool, the arena is therefore never written by the mempool. This allows processes which map the arena read-only
+/// to release chunks. The management memory is nine bytes per min chunk size.
+class BuddyMemPool
+{
+  public:
+    static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = MemPool::CHUNK_MEMORY_ALIGNMENT;
+    /// @brief the chunk size is stored as uint32_t in the ChunkHeader, this limits the size of the largest chunk
+    static constexpr uint64_t MAX_CHUNK_SIZE = 1ULL << 31U;
+    static constexpr uint32_t MAX_NUMBER_OF_ORDERS = 32U;
+
+    /// @brief Creates the arena and puts the whole arena into the free lists
+    /// @param[in] size of the arena, is rounded down to a multiple of the min chunk size
+    /// @param[in] minChunkSize size of the smallest chunk, must be a power of two and at least
+    /// CHUNK_MEMORY_ALIGNMENT
+    /// @param[in] managementAllocator for the block states and the free-list links
+    /// @param[in] chunkMemoryAllocator for the arena
+    BuddyMemPool(const uint64_t size,
+                 const uint32_t minChunkSize,
+                 posix::Allocator& managementAllocator,
+                 posix::Allocator& chunkMemoryAllocator) noexcept;
+
+    BuddyMemPool(const BuddyMemPool&) = delete;
+    BuddyMemPool(BuddyMemPool&&) = delete;
+    BuddyMemPool& operator=(const BuddyMemPool&) = delete;
+    BuddyMemPool& operator=(BuddyMemPool&&) = delete;
+
+    /// @brief acquires a chunk with the size returned by getChunkSize
+    /// @param[in] requiredChunkSize the minimal size of the chunk
+    /// @return pointer to the chunk or nullptr if there is no free block which is large enough
+    void* getChunk(const uint32_t requiredChunkSize) noexcept;
+
+    /// @brief returns a chunk which was acquired by getChunk
+    void freeChunk(const void* chunk) noexcept;
+
+    /// @brief returns the index of the first block of a chunk, it can be used to store data per chunk in a parallel
+    /// array of numberOfBlocks() entries
+    uint32_t getBlockIndex(const void* chunk) const noexcept;
+
+    /// @brief returns true if the address is within the arena, otherwise false
+    bool containsChunk(const void* chunk) const noexcept;
+
+    /// @brief returns the size of the chunk which is acquired for the required chunk size
+    /// @return the chunk size or 0 if the required chunk size exceeds the largest chunk of the arena
+    uint32_t getChunkSize(const uint32_t requiredChunkSize) const noexcept;
+
+    uint64_t getSize() const noexcept;
+    uint32_t getMinChunkSize() const noexcept;
+    uint32_t getMaxChunkSize() const noexcept;
+    uint32_t getUsedChunks() const noexcept;
+    uint64_t getUsedSize() const noexcept;
+
+    /// @brief the number of min chunk sized blocks of the arena which is also the maximum number of chunks
+    static uint32_t numberOfBlocks(const uint64_t size, const uint32_t minChunkSize) noexcept;
+    static uint64_t requiredChunkMemorySize(const uint64_t size, const uint32_t minChunkSize) noexcept;
+    static uint64_t requiredManagementMemorySize(const uint64_t size, const uint32_t minChunkSize) noexcept;
+
+  private:
+    using BlockState_t = uint8_t;
+    static constexpr BlockState_t FREE_FLAG{0x80U};
+    static constexpr BlockState_t NO_BLOCK_HEAD{0x7FU};
+    static constexpr uint32_t INVALID_BLOCK{std::numeric_limits<uint32_t>::max()};
+
+    struct FreeBlockLinks
+    {
+        uint32_t m_next{INVALID_BLOCK};
+        uint32_t m_previous{INVALID_BLOCK};
+    };
+
+    uint32_t orderOf(const uint32_t requiredChunkSize) const noexcept;
+    void pushFreeBlock(const uint32_t block, const uint32_t order) noexcept;
+    void removeFreeBlock(const uint32_t block, const uint32_t order) noexcept;
+    void rebuildFreeLists() noexcept;
+    bool lock() noexcept;
+    void unlock() noexcept;
+
+    memory::RelativePointer<uint8_t> m_rawMemory;
+    memory::RelativePointer<BlockState_t> m_blockStates;
+    memory::RelativePointer<FreeBlockLinks> m_freeBlockLinks;
+
+    uint32_t m_minChunkSize{0U};
+    uint32_t m_numberOfBlocks{0U};
+    uint32_t m_maxOrder{0U};
+
+    uint32_t m_freeListHeads[MAX_NUMBER_OF_ORDERS];
+
+    std::atomic<uint32_t> m_usedChunks{0U};
+    std::atomic<uint64_t> m_usedSize{0U};
+
+    cxx::optional<posix::mutex> m_mutex;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_BUDDY_MEM_POOL_HPP
@@ -28,6 +28,7 @@ namespace iox
 namespace mepoo
 {
 class MemPool;
+class BuddyMemPool;
 struct ChunkHeader;
 
 struct ChunkManagement
@@ -40,11 +41,36 @@ struct ChunkManagement
                     const cxx::not_null<MemPool*> mempool,
                     const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief creates the management for a chunk of a BuddyMemPool, m_mempool is then a nullptr
+    ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
+                    const cxx::not_null<BuddyMemPool*> buddyMemPool,
+                    const cxx::not_null<MemPool*> chunkManagementPool) noexcept;
+
+    /// @brief creates an unused entry of an array parallel to the chunks of a mempool, its reference counter is zero
+    /// until it is reinitialized for a chunk
+    ChunkManagement() noexcept;
+
+    /// @brief reinitializes an entry of an array parallel to the chunks of a mempool for a newly acquired chunk,
+    /// m_chunkManagementPool is then a nullptr since the ChunkManagement is released with the chunk. The entry is not
+    /// constructed again since a LatestValueSlot can concurrently try to acquire a reference to the previous chunk of
+    /// this entry, therefore the reference counter is set with an atomic store as last step
+    void reinitialize(const cxx::not_null<base_t*> chunkHeader, const cxx::not_null<MemPool*> mempool) noexcept;
+
+    /// @brief reinitializes an entry of an array parallel to the blocks of a BuddyMemPool for a newly acquired chunk,
+    /// see the overload for a MemPool
+    void reinitialize(const cxx::not_null<base_t*> chunkHeader,
+                      const cxx::not_null<BuddyMemPool*> buddyMemPool) noexcept;
+
     iox::memory::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
     iox::memory::RelativePointer<MemPool> m_mempool;
+    iox::memory::RelativePointer<BuddyMemPool> m_buddyMemPool;
+    /// @brief the pool the ChunkManagement is released to, a nullptr if it is stored in a parallel array
     iox::memory::RelativePointer<MemPool> m_chunkManagementPool;
+    /// @brief the next segment of a multi-chunk message, its reference is owned by this ChunkManagement and released
+    /// when this chunk is freed
+    iox::memory::RelativePointer<ChunkManagement> m_nextSegment;
 };
 } // namespace mepoo
 } // namespace iox
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_SIZE_RECORDING_HPP
+#define IOX_POSH_MEPOO_CHUNK_SIZE_RECORDING_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Records the chunk sizes which are requested from a MemoryManager in a log-scale histogram together with
+/// the number of requests and the wasted bytes of every mempool. The recording resides in the shared memory and is
+/// updated lock-free by all publishers, it is the input of the mempool sizing advisor.
+/// @note Every octave of chunk sizes is split into SUB_BUCKETS_PER_OCTAVE buckets, therefore the relative width of a
+/// bucket is at most 1/SUB_BUCKETS_PER_OCTAVE. Besides the number of requests a bucket stores the largest chunk size
+/// which was requested, this is the chunk size a mempool requires to serve all requests of the bucket.
+class ChunkSizeRecording
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS{3U};
+    static constexpr uint32_t SUB_BUCKETS_PER_OCTAVE{1U << SUB_BUCKET_BITS};
+    /// @brief the chunk sizes below SUB_BUCKETS_PER_OCTAVE have a bucket each, the octaves above have
+    /// SUB_BUCKETS_PER_OCTAVE buckets each
+    static constexpr uint32_t NUMBER_OF_BUCKETS{(32U - SUB_BUCKET_BITS + 1U) * SUB_BUCKETS_PER_OCTAVE};
+    /// @brief the mempool index of a request which was not served by a mempool, e.g. by the buddy mempool or when
+    /// no mempool is large enough
+    static constexpr uint32_t NO_MEMPOOL{MAX_NUMBER_OF_MEMPOOLS};
+
+    struct Bucket
+    {
+        uint32_t m_maxChunkSize{0U};
+        uint64_t m_count{0U};
+    };
+
+    struct MemPoolCounters
+    {
+        uint64_t m_requests{0U};
+        /// @brief the sum of the differences between the chunk size of the mempool and the required chunk size
+        uint64_t m_wastedBytes{0U};
+        /// @brief the requests which failed since the mempool was out of chunks
+        uint64_t m_failedRequests{0U};
+    };
+
+    ChunkSizeRecording() noexcept = default;
+    ChunkSizeRecording(const ChunkSizeRecording&) = delete;
+    ChunkSizeRecording(ChunkSizeRecording&&) = delete;
+    ChunkSizeRecording& operator=(const ChunkSizeRecording&) = delete;
+    ChunkSizeRecording& operator=(ChunkSizeRecording&&) = delete;
+    ~ChunkSizeRecording() noexcept = default;
+
+    /// @brief records a chunk request
+    /// @param[in] requiredChunkSize the chunk size which was requested including the ChunkHeader
+    /// @param[in] memPoolIndex the index of the mempool which served the request or NO_MEMPOOL
+    /// @param[in] acquiredChunkSize the chunk size which was acquired, 0 if the request failed
+    void
+    record(const uint32_t requiredChunkSize, const uint32_t memPoolIndex, const uint32_t acquiredChunkSize) noexcept;
+
+    /// @brief returns the bucket with the given index, an empty bucket if the index is out of range
+    Bucket getBucket(const uint32_t index) const noexcept;
+
+    /// @brief returns the counters of the mempool with the given index, empty counters if the index is out of range
+    MemPoolCounters getMemPoolCounters(const uint32_t memPoolIndex) const noexcept;
+
+    /// @brief returns the number of requests which were not served by a mempool
+    uint64_t getRequestsWithoutMemPool() const noexcept;
+
+    /// @brief returns the index of the bucket to which the chunk size belongs
+    static uint32_t bucketIndex(const uint32_t chunkSize) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_bucketCounts[NUMBER_OF_BUCKETS]{};
+    std::atomic<uint32_t> m_bucketMaxChunkSizes[NUMBER_OF_BUCKETS]{};
+    std::atomic<uint64_t> m_memPoolRequests[MAX_NUMBER_OF_MEMPOOLS]{};
+    std::atomic<uint64_t> m_memPoolWastedBytes[MAX_NUMBER_OF_MEMPOOLS]{};
+    std::atomic<uint64_t> m_memPoolFailedRequests[MAX_NUMBER_OF_MEMPOOLS]{};
+    std::atomic<uint64_t> m_requestsWithoutMemPool{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_SIZE_RECORDING_HPP
@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
@@ -67,6 +68,13 @@ class MemPool
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief returns the index of a chunk of this mempool, it can be used to store data per chunk in a parallel
+    /// array of getChunkCount() entries
+    uint32_t getChunkIndex(const void* chunk) const noexcept;
+
+    /// @brief returns true if the address is within the chunk memory of this mempool, otherwise false
+    bool containsChunk(const void* chunk) const noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
   private:
@@ -80,8 +88,12 @@ class MemPool
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
 
+    /// the usage counters are modified by every getChunk and freeChunk, the paddings keep the members above, which
+    /// are read when a mempool is selected, and the free-list out of their cache line
+    concurrent::CacheLinePadding m_paddingBeforeUsage;
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    concurrent::CacheLinePadding m_paddingAfterUsage;
 
     freeList_t m_freeIndices;
 };
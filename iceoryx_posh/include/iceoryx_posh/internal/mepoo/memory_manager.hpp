@@ -20,10 +20,13 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/buddy_mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_recording.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -64,15 +67,44 @@ class MemoryManager
                                 posix::Allocator& managementAllocator,
                                 posix::Allocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the mempools or, when no mempool fits, from the buddy mempool. When the mempool
+    /// is out of chunks the chunk is obtained from the overflow memory manager if there is one.
     /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] reservation of the mempools to obtain the chunk from, only these mempools are considered
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
-    cxx::expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
+    cxx::expected<SharedChunk, Error>
+    getChunk(const ChunkSettings& chunkSettings,
+             const MemPoolReservation_t reservation = NO_MEMPOOL_RESERVATION) noexcept;
 
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief returns the reservation of the mempool with the given index
+    MemPoolReservation_t getMemPoolReservation(const uint32_t index) const noexcept;
+
+    /// @brief returns the buddy mempool or a nullptr if none is configured
+    const BuddyMemPool* getBuddyMemPool() const noexcept;
+
+    /// @brief links the memory manager which provides the chunks when the mempools of this memory manager are out of
+    /// chunks, the link is stored relative to this memory manager, therefore both must be in the same shared memory
+    /// @note the link can be set while other processes acquire chunks but it cannot be changed afterwards
+    void setOverflowMemoryManager(MemoryManager& overflowMemoryManager) noexcept;
+
+    /// @brief returns the overflow memory manager or a nullptr if none is linked
+    MemoryManager* getOverflowMemoryManager() const noexcept;
+
+    /// @brief returns true if the chunk was obtained from the mempools or the buddy mempool of this memory manager or
+    /// of its overflow memory manager, otherwise false
+    bool containsChunk(const void* chunk) const noexcept;
+
+    /// @brief returns the usage of the most used mempool or buddy mempool in percent
+    uint32_t getMaxUsagePercent() const noexcept;
+
+    /// @brief returns the recording of the requested chunk sizes or a nullptr if the recording is not enabled in the
+    /// MePooConfig, a request which is served by the overflow memory manager is recorded there
+    const ChunkSizeRecording* getChunkSizeRecording() const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -84,15 +116,29 @@ class MemoryManager
     void addMemPool(posix::Allocator& managementAllocator,
                     posix::Allocator& chunkMemoryAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
-    void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+                    const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const MemPoolReservation_t reservation) noexcept;
+    static ChunkManagement* allocateChunkManagements(posix::Allocator& managementAllocator,
+                                                     const uint32_t numberOfChunks) noexcept;
+    void recordChunkSize(const uint32_t requiredChunkSize,
+                         const MemPoolReservation_t reservation,
+                         const uint32_t memPoolIndex,
+                         const uint32_t acquiredChunkSize) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
-    uint32_t m_totalNumberOfChunks{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
-    cxx::vector<MemPool, 1> m_chunkManagementPool;
+    cxx::vector<MemPoolReservation_t, MAX_NUMBER_OF_MEMPOOLS> m_memPoolReservations;
+    cxx::vector<BuddyMemPool, 1> m_buddyMemPool;
+    /// @brief the ChunkManagement of a chunk is stored at the index of the chunk in the array of its mempool, this
+    /// avoids a second free-list operation per chunk and the contention of all mempools on a shared free-list
+    cxx::vector<memory::RelativePointer<ChunkManagement>, MAX_NUMBER_OF_MEMPOOLS> m_chunkManagements;
+    /// @brief the ChunkManagement of a chunk of the buddy mempool is stored at the index of its first block
+    memory::RelativePointer<ChunkManagement> m_buddyChunkManagements;
+    memory::RelativePointer<ChunkSizeRecording> m_chunkSizeRecording;
+    /// @brief offset from this to the overflow memory manager, 0 if there is none
+    std::atomic<int64_t> m_overflowMemoryManagerOffset{0};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 
 namespace iox
 {
@@ -37,26 +38,52 @@ class MePooSegment
                  posix::Allocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const bool useHugePages = false,
+                 const bool prefault = false,
+                 const bool lockMemory = false,
+                 const cxx::optional<SegmentFile>& file = cxx::nullopt,
+                 const cxx::optional<ShmName_t>& sharedMemoryName = cxx::nullopt) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
     const SharedMemoryObjectType& getSharedMemoryObject() const noexcept;
+
+    /// @brief returns the name of the shared memory object, this is the name of the writer group unless another name
+    /// was provided to the ctor
+    const ShmName_t& getSharedMemoryName() const noexcept;
     MemoryManagerType& getMemoryManager() noexcept;
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief returns true if the pages of the segment are touched when it is mapped
+    bool isPrefaulted() const noexcept;
+
+    /// @brief returns true if the segment is locked into RAM when it is mapped
+    bool isLocked() const noexcept;
+
+    /// @brief returns the file in which the segment is placed or a cxx::nullopt when it is a POSIX shared memory object
+    const cxx::optional<SegmentFile>& getFile() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const ShmName_t& sharedMemoryName,
+                                                    const bool useHugePages,
+                                                    const bool prefault,
+                                                    const bool lockMemory,
+                                                    const cxx::optional<SegmentFile>& file) noexcept;
 
   protected:
+    ShmName_t m_sharedMemoryName;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
     posix::PosixGroup m_readerGroup;
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    bool m_prefault{false};
+    bool m_lockMemory{false};
+    cxx::optional<SegmentFile> m_file;
 
     static constexpr cxx::perms SEGMENT_PERMISSIONS =
         cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
@@ -24,6 +25,8 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include <thread>
+
 namespace iox
 {
 namespace mepoo
@@ -37,11 +40,22 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     posix::Allocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const bool useHugePages,
+    const bool prefault,
+    const bool lockMemory,
+    const cxx::optional<SegmentFile>& file,
+    const cxx::optional<ShmName_t>& sharedMemoryName) noexcept
+    : m_sharedMemoryName(
+        sharedMemoryName.value_or(ShmName_t(cxx::TruncateToCapacity, writerGroup.getName().c_str())))
+    , m_sharedMemoryObject(std::move(
+          createSharedMemoryObject(mempoolConfig, m_sharedMemoryName, useHugePages, prefault, lockMemory, file)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_prefault(prefault)
+    , m_lockMemory(lockMemory)
+    , m_file(file)
 {
     using namespace posix;
     AccessController accessController;
@@ -56,7 +70,17 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
     if (!accessController.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
     {
-        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        if (m_file)
+        {
+            // not every filesystem supports ACLs, e.g. hugetlbfs, the access is then restricted by the permissions
+            // of the file and its directory
+            LogWarn() << "Unable to apply the access rights of the reader and writer group to the segment file "
+                      << m_file->m_path;
+        }
+        else
+        {
+            errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        }
     }
 
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, m_sharedMemoryObject.getAllocator());
@@ -65,15 +89,46 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const ShmName_t& sharedMemoryName,
+    const bool useHugePages,
+    const bool prefault,
+    const bool lockMemory,
+    const cxx::optional<SegmentFile>& file) noexcept
 {
+    // RouDi acquires the whole segment at startup, therefore the pages are touched by all cores
+    const uint32_t numberOfPrefaultThreads = algorithm::maxVal(std::thread::hardware_concurrency(), 1U);
+
+    uint64_t memorySizeInBytes = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    cxx::optional<posix::SharedMemory::FilePath_t> filePath;
+    if (file)
+    {
+        filePath.emplace(file->m_path);
+        if (file->m_size >= memorySizeInBytes)
+        {
+            memorySizeInBytes = file->m_size;
+        }
+        else if (file->m_size != 0U)
+        {
+            LogWarn() << "The size of the segment file " << file->m_path << " is " << file->m_size
+                      << " bytes but the mempools require " << memorySizeInBytes << " bytes, using the latter";
+        }
+    }
+
+    // a segment file is reused without zeroing it, so that its content is available after a restart of RouDi
     return std::move(
         typename SharedMemoryObjectType::Builder()
-            .name(writerGroup.getName())
-            .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
+            .name(posix::SharedMemory::Name_t(cxx::TruncateToCapacity, sharedMemoryName.c_str()))
+            .memorySizeInBytes(memorySizeInBytes)
             .accessMode(posix::AccessMode::READ_WRITE)
-            .openMode(posix::OpenMode::PURGE_AND_CREATE)
+            .openMode((file) ? posix::OpenMode::OPEN_OR_CREATE : posix::OpenMode::PURGE_AND_CREATE)
             .permissions(SEGMENT_PERMISSIONS)
+            .filePath(filePath)
+            .synchronousMapping(file && file->m_synchronousMapping)
+            .useHugePages(useHugePages)
+            .prefault(prefault)
+            .numberOfPrefaultThreads(numberOfPrefaultThreads)
+            .lockMemory(lockMemory)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::memory::UntypedRelativePointer::registerPtr(
@@ -104,6 +159,31 @@ inline posix::PosixGroup MePooSegment<SharedMemoryObjectType, MemoryManagerType>
     return m_readerGroup;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::isPrefaulted() const noexcept
+{
+    return m_prefault;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::isLocked() const noexcept
+{
+    return m_lockMemory;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const cxx::optional<SegmentFile>&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getFile() const noexcept
+{
+    return m_file;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const ShmName_t& MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryName() const noexcept
+{
+    return m_sharedMemoryName;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline MemoryManagerType& MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMemoryManager() noexcept
 {
@@ -0,0 +1,40 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_MONOTONIC_TIMESTAMP_HPP
+#define IOX_POSH_MEPOO_MONOTONIC_TIMESTAMP_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief the current time of the BaseClock_t in nanoseconds, it is used for the publish timestamp of the chunks and
+/// can be compared between the processes of a system
+/// @return the current monotonic timestamp in nanoseconds
+inline uint64_t monotonicTimestamp() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(BaseClock_t::now().time_since_epoch()).count());
+}
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MONOTONIC_TIMESTAMP_HPP
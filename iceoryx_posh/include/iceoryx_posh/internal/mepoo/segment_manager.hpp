@@ -28,6 +28,8 @@
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/segment_config.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace roudi
@@ -59,14 +61,19 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       bool prefault = false,
+                       bool lockMemory = false,
+                       const cxx::optional<SegmentFile>& file = cxx::nullopt) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
-
+            , m_prefault(prefault)
+            , m_lockMemory(lockMemory)
+            , m_file(file)
         {
         }
 
@@ -76,6 +83,9 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        bool m_prefault{false};              // the application touches every page when it maps the segment
+        bool m_lockMemory{false};            // the application locks the segment into RAM when it maps it
+        cxx::optional<SegmentFile> m_file;   // the application maps this file instead of a shared memory object
     };
 
     struct SegmentUserInformation
@@ -89,12 +99,45 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief Creates the next overflow segment for every configured segment whose last segment exceeds the usage
+    /// threshold of its overflow configuration. The new segment is announced to the applications but the publishers
+    /// use it only after it was linked with linkOverflowSegments. This is called cyclically by RouDi.
+    void createOverflowSegmentsOnDemand() noexcept;
+
+    /// @brief Links the announced overflow segments to the memory manager of their previous segment, from then on the
+    /// publishers acquire chunks from them. This is called cyclically by RouDi.
+    /// @param[in] numberOfMappedSegments is the number of announced segments which all applications have mapped,
+    /// only overflow segments below this number are linked
+    void linkOverflowSegments(const uint64_t numberOfMappedSegments) noexcept;
+
+    /// @brief returns the number of segments including the overflow segments which were announced so far
+    uint64_t getNumberOfSegments() const noexcept;
+
+    /// @brief returns the memory manager of the configured segment with the given index, the memory managers of its
+    /// overflow segments are linked to it
+    /// @param[in] index of the segment in the SegmentConfig
+    /// @return the memory manager or a nullopt if there is no configured segment with this index
+    cxx::optional<MemoryManager*> getMemoryManagerOfConfiguredSegment(const uint64_t index) noexcept;
+
+    /// @note includes the management memory of the overflow segments since the management segment cannot grow
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
 
   private:
+    struct OverflowState
+    {
+        MePooConfig m_mempoolConfig;
+        SegmentOverflow m_overflow;
+        bool m_useHugePages{false};
+        uint64_t m_lastSegmentIndex{0U};
+        cxx::optional<uint64_t> m_announcedSegmentIndex;
+        uint32_t m_numberOfSegments{0U};
+    };
+
     void createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+    void createOverflowSegment(OverflowState& overflowState) noexcept;
+    static uint64_t requiredOverflowManagementMemorySize(const SegmentConfig& config) noexcept;
 
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
@@ -103,6 +146,12 @@ class SegmentManager
     posix::Allocator* m_managementAllocator;
     cxx::vector<SegmentType, MAX_SHM_SEGMENTS> m_segmentContainer;
     bool m_createInterfaceEnabled{true};
+    cxx::optional<posix::Allocator> m_overflowManagementAllocator;
+    cxx::vector<OverflowState, MAX_SHM_SEGMENTS> m_overflowStates;
+    uint64_t m_numberOfConfiguredSegments{0U};
+    /// @brief the applications access the segment container concurrently to the creation of the overflow segments,
+    /// only the segments below this number are fully constructed
+    std::atomic<uint64_t> m_numberOfSegments{0U};
 };
 
 
@@ -20,8 +20,11 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
+#include <string>
+
 namespace iox
 {
 namespace mepoo
@@ -32,10 +35,31 @@ inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& segmentC
     : m_managementAllocator(managementAllocator)
 {
     cxx::Expects(segmentConfig.m_sharedMemorySegments.capacity() <= m_segmentContainer.capacity());
+
+    const auto overflowManagementMemorySize = requiredOverflowManagementMemorySize(segmentConfig);
+    if (overflowManagementMemorySize != 0U)
+    {
+        m_overflowManagementAllocator.emplace(
+            m_managementAllocator->allocate(overflowManagementMemorySize, MemPool::CHUNK_MEMORY_ALIGNMENT),
+            overflowManagementMemorySize);
+    }
+
     for (const auto& segmentEntry : segmentConfig.m_sharedMemorySegments)
     {
         createSegment(segmentEntry);
+        if (segmentEntry.m_overflow.m_maxSegments != 0U)
+        {
+            m_overflowStates.emplace_back();
+            auto& overflowState = m_overflowStates.back();
+            overflowState.m_mempoolConfig = segmentEntry.m_mempoolConfig;
+            overflowState.m_overflow = segmentEntry.m_overflow;
+            overflowState.m_useHugePages = segmentEntry.m_useHugePages;
+            overflowState.m_lastSegmentIndex = m_segmentContainer.size() - 1U;
+        }
     }
+
+    m_numberOfConfiguredSegments = m_segmentContainer.size();
+    m_numberOfSegments.store(m_segmentContainer.size(), std::memory_order_release);
 }
 
 template <typename SegmentType>
@@ -43,8 +67,109 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_useHugePages,
+                                    segmentEntry.m_prefault,
+                                    segmentEntry.m_lockMemory,
+                                    segmentEntry.m_file);
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::createOverflowSegmentsOnDemand() noexcept
+{
+    for (auto& overflowState : m_overflowStates)
+    {
+        if (overflowState.m_announcedSegmentIndex.has_value()
+            || overflowState.m_numberOfSegments >= overflowState.m_overflow.m_maxSegments
+            || m_segmentContainer[overflowState.m_lastSegmentIndex].getMemoryManager().getMaxUsagePercent()
+                   < overflowState.m_overflow.m_thresholdPercent)
+        {
+            continue;
+        }
+
+        if (m_segmentContainer.size() >= m_segmentContainer.capacity())
+        {
+            LogWarn() << "Unable to create an overflow segment for the writer group "
+                      << m_segmentContainer[overflowState.m_lastSegmentIndex].getWriterGroup().getName()
+                      << " since the maximum number of " << MAX_SHM_SEGMENTS << " segments is reached";
+            overflowState.m_numberOfSegments = overflowState.m_overflow.m_maxSegments;
+            continue;
+        }
+
+        createOverflowSegment(overflowState);
+    }
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::createOverflowSegment(OverflowState& overflowState) noexcept
+{
+    auto& lastSegment = m_segmentContainer[overflowState.m_lastSegmentIndex];
+    ++overflowState.m_numberOfSegments;
+
+    std::string sharedMemoryName = lastSegment.getWriterGroup().getName().c_str();
+    sharedMemoryName += "_overflow" + std::to_string(overflowState.m_numberOfSegments);
+
+    // overflow segments are never placed in a file since they are created on demand
+    m_segmentContainer.emplace_back(overflowState.m_mempoolConfig,
+                                    *m_overflowManagementAllocator,
+                                    lastSegment.getReaderGroup(),
+                                    lastSegment.getWriterGroup(),
+                                    iox::mepoo::MemoryInfo(),
+                                    overflowState.m_useHugePages,
+                                    lastSegment.isPrefaulted(),
+                                    lastSegment.isLocked(),
+                                    cxx::nullopt,
+                                    ShmName_t(cxx::TruncateToCapacity, sharedMemoryName));
+    const auto overflowSegmentIndex = m_segmentContainer.size() - 1U;
+    overflowState.m_announcedSegmentIndex.emplace(overflowSegmentIndex);
+
+    // the applications map the segment when they see it and report this to RouDi, the publishers acquire its first
+    // chunk only after all applications have mapped it
+    m_numberOfSegments.store(m_segmentContainer.size(), std::memory_order_release);
+
+    LogInfo() << "Announced overflow segment " << sharedMemoryName << " with id "
+              << m_segmentContainer[overflowSegmentIndex].getSegmentId() << " (" << overflowState.m_numberOfSegments
+              << " of " << overflowState.m_overflow.m_maxSegments << ")";
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::linkOverflowSegments(const uint64_t numberOfMappedSegments) noexcept
+{
+    for (auto& overflowState : m_overflowStates)
+    {
+        if (!overflowState.m_announcedSegmentIndex.has_value()
+            || overflowState.m_announcedSegmentIndex.value() >= numberOfMappedSegments)
+        {
+            continue;
+        }
+
+        const auto overflowSegmentIndex = overflowState.m_announcedSegmentIndex.value();
+        m_segmentContainer[overflowState.m_lastSegmentIndex].getMemoryManager().setOverflowMemoryManager(
+            m_segmentContainer[overflowSegmentIndex].getMemoryManager());
+        overflowState.m_lastSegmentIndex = overflowSegmentIndex;
+        overflowState.m_announcedSegmentIndex.reset();
+    }
+}
+
+template <typename SegmentType>
+inline uint64_t SegmentManager<SegmentType>::getNumberOfSegments() const noexcept
+{
+    return m_numberOfSegments.load(std::memory_order_acquire);
+}
+
+template <typename SegmentType>
+inline cxx::optional<MemoryManager*>
+SegmentManager<SegmentType>::getMemoryManagerOfConfiguredSegment(const uint64_t index) noexcept
+{
+    if (index >= m_numberOfConfiguredSegments)
+    {
+        return cxx::nullopt;
+    }
+    return &m_segmentContainer[index].getMemoryManager();
 }
 
 template <typename SegmentType>
@@ -56,23 +181,30 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
 
     SegmentManager::SegmentMappingContainer mappingContainer;
     bool foundInWriterGroup = false;
+    const auto numberOfSegments = getNumberOfSegments();
 
     // with the groups we can get all the segments (read or write) for the user
     for (const auto& groupID : groupContainer)
     {
-        for (const auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
         {
+            const auto& segment = m_segmentContainer[i];
             if (segment.getWriterGroup() == groupID)
             {
                 // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
+                // process; the overflow segments extend the memory manager of the writer group
+                const bool isOverflowSegment = i >= m_numberOfConfiguredSegments;
+                if (!foundInWriterGroup || isOverflowSegment)
                 {
-                    mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                    mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                                   segment.getSharedMemoryObject().getBaseAddress(),
                                                   segment.getSharedMemoryObject().getSizeInBytes(),
                                                   true,
-                                                  segment.getSegmentId());
+                                                  segment.getSegmentId(),
+                                                  iox::mepoo::MemoryInfo(),
+                                                  segment.isPrefaulted(),
+                                                  segment.isLocked(),
+                                                  segment.getFile());
                     foundInWriterGroup = true;
                 }
                 else
@@ -86,19 +218,24 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
 
     for (const auto& groupID : groupContainer)
     {
-        for (const auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
         {
+            const auto& segment = m_segmentContainer[i];
             // only add segments which are not yet added as writer
             if (segment.getReaderGroup() == groupID
                 && std::find_if(mappingContainer.begin(), mappingContainer.end(), [&](const SegmentMapping& mapping) {
                        return mapping.m_startAddress == segment.getSharedMemoryObject().getBaseAddress();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                mappingContainer.emplace_back(segment.getSharedMemoryName(),
                                               segment.getSharedMemoryObject().getBaseAddress(),
                                               segment.getSharedMemoryObject().getSizeInBytes(),
                                               false,
-                                              segment.getSegmentId());
+                                              segment.getSegmentId(),
+                                              iox::mepoo::MemoryInfo(),
+                                              segment.isPrefaulted(),
+                                              segment.isLocked(),
+                                              segment.getFile());
             }
         }
     }
@@ -114,11 +251,13 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
 
     SegmentUserInformation segmentInfo{cxx::nullopt_t(), 0u};
 
-    // with the groups we can search for the writable segment of this user
+    // with the groups we can search for the writable segment of this user, the overflow segments are reached via the
+    // memory manager of the configured segment
     for (const auto& groupID : groupContainer)
     {
-        for (auto& segment : m_segmentContainer)
+        for (uint64_t i = 0U; i < m_numberOfConfiguredSegments; ++i)
         {
+            auto& segment = m_segmentContainer[i];
             if (segment.getWriterGroup() == groupID)
             {
                 segmentInfo.m_memoryManager = segment.getMemoryManager();
@@ -139,6 +278,18 @@ uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const Segment
     {
         memorySize += MemoryManager::requiredManagementMemorySize(segment.m_mempoolConfig);
     }
+    return memorySize + requiredOverflowManagementMemorySize(config);
+}
+
+template <typename SegmentType>
+uint64_t SegmentManager<SegmentType>::requiredOverflowManagementMemorySize(const SegmentConfig& config) noexcept
+{
+    uint64_t memorySize{0U};
+    for (const auto& segment : config.m_sharedMemorySegments)
+    {
+        memorySize += segment.m_overflow.m_maxSegments
+                      * MemoryManager::requiredManagementMemorySize(segment.m_mempoolConfig);
+    }
     return memorySize;
 }
 
@@ -49,6 +49,15 @@ class SharedChunk
 
     ChunkManagement* release() noexcept;
 
+    /// @brief returns true if this is the only owner of the chunk, i.e. the chunk can be modified without affecting
+    /// other owners, otherwise false
+    bool hasNoOtherOwners() const noexcept;
+
+    /// @brief appends a chunk as last segment to the multi-chunk message of this chunk, the ownership of the segment is
+    /// transferred to the message and the segment is freed together with it
+    /// @param[in] segment the chunk to append, it must not be part of another message
+    void appendSegment(SharedChunk&& segment) noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
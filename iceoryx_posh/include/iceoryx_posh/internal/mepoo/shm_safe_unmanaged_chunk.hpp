@@ -1,4 +1,4 @@
-// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+// Copyright (c) 2021 - 2022 by Apex.AI Inc. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -41,6 +41,14 @@ class ShmSafeUnmanagedChunk
     /// @brief Creates a SharedChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedChunk cloneToSharedChunk() noexcept;
 
+    /// @brief Creates a SharedChunk with incrementing the chunk reference counter if the chunk is still referenced
+    /// by another owner and does not invalidate itself
+    /// @return the SharedChunk or an empty SharedChunk if the reference counter already dropped to zero
+    /// @note this is used by readers which obtained the ShmSafeUnmanagedChunk without owning it, e.g. from the
+    /// LatestValueSlot, the ChunkManagement of a freed chunk remains accessible since it is located in the persistent
+    /// ChunkManagement array of its mempool
+    SharedChunk cloneToSharedChunkIfReferenced() noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
     /// @return true if logically a nullptr otherwise false
     bool isLogicalNullptr() const noexcept;
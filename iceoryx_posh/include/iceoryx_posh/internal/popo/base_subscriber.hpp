@@ -40,12 +40,17 @@ using uid_t = UniquePortId;
 
 enum class SubscriberEvent : EventEnumIdentifier
 {
-    DATA_RECEIVED
+    DATA_RECEIVED,
+    /// @brief RouDi notifies once per missed deadline, the resolution is the discovery interval of RouDi
+    DEADLINE_MISSED
 };
 
 enum class SubscriberState : StateEnumIdentifier
 {
-    HAS_DATA
+    HAS_DATA,
+    /// @brief is set while the deadline configured in the SubscriberOptions is missed, RouDi checks it with the
+    /// resolution of its discovery interval
+    DEADLINE_MISSED
 };
 
 /// @brief base class for all types of subscriber
@@ -99,11 +104,31 @@ class BaseSubscriber
     ///
     bool hasMissedData() noexcept;
 
+    ///
+    /// @brief Check if no sample arrived within the deadline configured in the SubscriberOptions.
+    /// @return True if a deadline is configured and it was missed.
+    /// @details A WaitSet or Listener can be notified about a missed deadline by attaching the subscriber with
+    ///          SubscriberState::DEADLINE_MISSED or SubscriberEvent::DEADLINE_MISSED.
+    ///
+    bool hasMissedDeadline() const noexcept;
+
+    ///
+    /// @brief The number of samples which were discarded since they exceeded the maximum sample age configured in the
+    ///        SubscriberOptions.
+    /// @return The number of expired samples since the creation of the subscriber.
+    ///
+    uint64_t numberOfExpiredSamples() const noexcept;
+
     /// @brief Releases any unread queued data.
     void releaseQueuedData() noexcept;
 
     friend class NotificationAttorney;
     friend class iox::runtime::ServiceDiscovery;
+    /// @brief the publishers need the port to adopt a taken chunk
+    template <typename, typename, typename>
+    friend class PublisherImpl;
+    template <typename>
+    friend class UntypedPublisherImpl;
 
   protected:
     /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
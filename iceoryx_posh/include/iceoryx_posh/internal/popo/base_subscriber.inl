@@ -86,6 +86,18 @@ inline bool BaseSubscriber<port_t>::hasMissedData() noexcept
     return m_port.hasLostChunksSinceLastCall();
 }
 
+template <typename port_t>
+inline bool BaseSubscriber<port_t>::hasMissedDeadline() const noexcept
+{
+    return m_port.hasMissedDeadline();
+}
+
+template <typename port_t>
+inline uint64_t BaseSubscriber<port_t>::numberOfExpiredSamples() const noexcept
+{
+    return m_port.numberOfExpiredChunks();
+}
+
 template <typename port_t>
 inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscriber<port_t>::takeChunk() noexcept
 {
@@ -110,26 +122,29 @@ inline void BaseSubscriber<port_t>::invalidateTrigger(const uint64_t uniqueTrigg
 
 template <typename port_t>
 inline void BaseSubscriber<port_t>::enableState(iox::popo::TriggerHandle&& triggerHandle,
-                                                IOX_MAYBE_UNUSED const SubscriberState subscriberState) noexcept
+                                                const SubscriberState subscriberState) noexcept
 
 {
+    if (m_trigger)
+    {
+        LogWarn() << "The subscriber is already attached with a SubscriberState or SubscriberEvent to a "
+                     "WaitSet/Listener. Detaching it from previous one and attaching it to the new one with the "
+                     "SubscriberState. Best practice is to call detach first.";
+
+        errorHandler(
+            PoshError::POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_STATE_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED,
+            ErrorLevel::MODERATE);
+    }
+    m_trigger = std::move(triggerHandle);
+
     switch (subscriberState)
     {
     case SubscriberState::HAS_DATA:
-        if (m_trigger)
-        {
-            LogWarn()
-                << "The subscriber is already attached with either the SubscriberState::HAS_DATA or "
-                   "SubscriberEvent::DATA_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
-                   "attaching it to the new one with SubscriberState::HAS_DATA. Best practice is to call detach first.";
-
-            errorHandler(
-                PoshError::POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_STATE_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED,
-                ErrorLevel::MODERATE);
-        }
-        m_trigger = std::move(triggerHandle);
         m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberState::DEADLINE_MISSED:
+        m_port.setConditionVariableForMissedDeadline(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
     }
 }
 
@@ -142,6 +157,8 @@ BaseSubscriber<port_t>::getCallbackForIsStateConditionSatisfied(const Subscriber
     {
     case SubscriberState::HAS_DATA:
         return WaitSetIsConditionSatisfiedCallback(cxx::in_place, *this, &SelfType::hasData);
+    case SubscriberState::DEADLINE_MISSED:
+        return WaitSetIsConditionSatisfiedCallback(cxx::in_place, *this, &SelfType::hasMissedDeadline);
     }
     return cxx::nullopt;
 }
@@ -152,6 +169,7 @@ inline void BaseSubscriber<port_t>::disableState(const SubscriberState subscribe
     switch (subscriberState)
     {
     case SubscriberState::HAS_DATA:
+    case SubscriberState::DEADLINE_MISSED:
         m_trigger.reset();
         m_port.unsetConditionVariable();
         break;
@@ -162,23 +180,25 @@ template <typename port_t>
 inline void BaseSubscriber<port_t>::enableEvent(iox::popo::TriggerHandle&& triggerHandle,
                                                 const SubscriberEvent subscriberEvent) noexcept
 {
+    if (m_trigger)
+    {
+        LogWarn() << "The subscriber is already attached with a SubscriberState or SubscriberEvent to a "
+                     "WaitSet/Listener. Detaching it from previous one and attaching it to the new one with the "
+                     "SubscriberEvent. Best practice is to call detach first.";
+        errorHandler(
+            PoshError::POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED,
+            ErrorLevel::MODERATE);
+    }
+    m_trigger = std::move(triggerHandle);
+
     switch (subscriberEvent)
     {
     case SubscriberEvent::DATA_RECEIVED:
-        if (m_trigger)
-        {
-            LogWarn()
-                << "The subscriber is already attached with either the SubscriberState::HAS_DATA or "
-                   "SubscriberEvent::DATA_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
-                   "attaching it to the new one with SubscriberEvent::DATA_RECEIVED. Best practice is to call detach "
-                   "first.";
-            errorHandler(
-                PoshError::POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED,
-                ErrorLevel::MODERATE);
-        }
-        m_trigger = std::move(triggerHandle);
         m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
         break;
+    case SubscriberEvent::DEADLINE_MISSED:
+        m_port.setConditionVariableForMissedDeadline(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
     }
 }
 
@@ -188,6 +208,7 @@ inline void BaseSubscriber<port_t>::disableEvent(const SubscriberEvent subscribe
     switch (subscriberEvent)
     {
     case SubscriberEvent::DATA_RECEIVED:
+    case SubscriberEvent::DEADLINE_MISSED:
         m_trigger.reset();
         m_port.unsetConditionVariable();
         break;
@@ -0,0 +1,132 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BYTE_RING_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BYTE_RING_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class ByteRingError
+{
+    /// @brief the record is larger than ByteRing::maxRecordSize
+    RECORD_TOO_LARGE,
+    /// @brief the buffer is smaller than the next record, the record is not consumed
+    BUFFER_TOO_SMALL,
+    /// @brief the reader already consumed all records which were written
+    NO_RECORD_AVAILABLE,
+    /// @brief there is no ring, e.g. since the chunk for it could not be loaned or was not received yet
+    RING_NOT_AVAILABLE
+};
+
+/// @brief The ByteRing is a single-producer, multi-consumer ring buffer for variable-size records which is placed in
+/// the user-payload of a single chunk. Every record is stored with a frame header containing its size and is padded to
+/// RECORD_ALIGNMENT. The positions in the ring are byte counters which only increase, the offset in the buffer is the
+/// position modulo the capacity.
+/// The writer never waits for the readers. Before it overwrites the oldest records, it advances the tail position
+/// past them. The readers, see ByteRingReader, only read from the ring and track their own cursors. A reader whose
+/// cursor fell behind the tail position lost records and continues with the oldest record which is still available.
+/// A record which is overwritten while it is copied is detected like in a sequence lock by checking the tail position
+/// after the copy.
+/// @note the memory for the records follows directly after the ByteRing, use requiredMemorySize to determine the size
+/// of the chunk
+class ByteRing
+{
+  public:
+    using RecordSize_t = uint32_t;
+    static constexpr uint64_t RECORD_ALIGNMENT{8U};
+    static constexpr uint64_t FRAME_HEADER_SIZE{8U};
+
+    /// @brief creates an empty ring
+    /// @param[in] capacity of the ring in bytes, must be valid according to isValidCapacity
+    explicit ByteRing(const uint64_t capacity) noexcept;
+
+    ByteRing(const ByteRing&) = delete;
+    ByteRing(ByteRing&&) = delete;
+    ByteRing& operator=(const ByteRing&) = delete;
+    ByteRing& operator=(ByteRing&&) = delete;
+    ~ByteRing() noexcept = default;
+
+    /// @brief checks if the capacity is a power of two which can hold at least one record with the size of a frame
+    /// header and whose ring fits into a chunk
+    static bool isValidCapacity(const uint64_t capacity) noexcept;
+
+    /// @brief returns the size of the memory for the ByteRing and its records
+    static uint64_t requiredMemorySize(const uint64_t capacity) noexcept;
+
+    /// @brief returns the capacity of the ring in bytes
+    uint64_t capacity() const noexcept;
+
+    /// @brief returns the size of the largest record which can be written
+    RecordSize_t maxRecordSize() const noexcept;
+
+    /// @brief copies a record into the ring and overwrites the oldest records if there is not enough space
+    /// @param[in] record pointer to the data of the record
+    /// @param[in] size of the record in bytes, a record can be empty
+    /// @return error if the record is larger than maxRecordSize
+    /// @concurrent must be called by a single writer only, can be called concurrently to the readers
+    cxx::expected<ByteRingError> write(const void* const record, const RecordSize_t size) noexcept;
+
+  private:
+    friend class ByteRingReader;
+
+    uint8_t* records() noexcept;
+    const uint8_t* records() const noexcept;
+    uint64_t offset(const uint64_t position) const noexcept;
+    RecordSize_t recordSizeAt(const uint64_t position) const noexcept;
+    void copyToRing(const uint64_t position, const void* const source, const uint64_t size) noexcept;
+    void copyFromRing(const uint64_t position, void* const destination, const uint64_t size) const noexcept;
+    static uint64_t framedSize(const RecordSize_t size) noexcept;
+
+    std::atomic<uint64_t> m_writePosition{0U};
+    std::atomic<uint64_t> m_tailPosition{0U};
+    uint64_t m_capacity{0U};
+};
+
+/// @brief Reads the records of a ByteRing with its own cursor, the reader does not modify the ring and can therefore
+/// be used with read-only memory
+class ByteRingReader
+{
+  public:
+    /// @brief creates a reader which starts with the oldest record which is available in the ring
+    explicit ByteRingReader(const ByteRing& ring) noexcept;
+
+    /// @brief copies the next record into the buffer
+    /// @param[in] buffer to which the record is copied
+    /// @param[in] bufferSize size of the buffer in bytes
+    /// @return the size of the record or an error if there is no record or the buffer is too small
+    cxx::expected<ByteRing::RecordSize_t, ByteRingError> read(void* const buffer,
+                                                              const ByteRing::RecordSize_t bufferSize) noexcept;
+
+    /// @brief checks if records were overwritten before they were read, the state is reset by the call
+    /// @return true if records were lost since the last call, otherwise false
+    bool hasLostRecords() noexcept;
+
+  private:
+    const ByteRing* m_ring{nullptr};
+    uint64_t m_cursor{0U};
+    bool m_hasLostRecords{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BYTE_RING_HPP
@@ -43,6 +43,8 @@ enum class ChunkDistributorError
 /// allows to provide a newly added queue a number of last chunks to start from. This is needed for functionality
 /// known as latched topic in ROS or field in ara::com. A ChunkDistributor is used to build elements of higher
 /// abstraction layers that also do memory managemet and provide an API towards the real user
+/// In the latest-value mode the chunks are not pushed into the queues but stored in a single LatestValueSlot which is
+/// attached to all queues, the cost of delivering a chunk is then independent of the number of queues
 ///
 /// About Concurrency:
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
@@ -97,7 +99,8 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. In the latest-value mode the chunk replaces the chunk in the LatestValueSlot which is attached to the
+    /// queues instead
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
@@ -143,7 +146,9 @@ class ChunkDistributor
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
-    bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
+    bool pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue, const mepoo::SharedChunk& chunk) noexcept;
+
+    uint64_t deliverToLatestValueSlot(mepoo::SharedChunk chunk) noexcept;
 
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
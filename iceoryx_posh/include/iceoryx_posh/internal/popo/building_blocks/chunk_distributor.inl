@@ -65,6 +65,14 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             // pushing will be fine
             getMembers()->m_queues.push_back(memory::RelativePointer<ChunkQueueData_t>(queueToAdd));
 
+            // in the latest-value mode the slot replaces the history, the queue provides the newest chunk of the slot
+            // right after attaching it
+            if (getMembers()->m_latestValueOnly)
+            {
+                ChunkQueuePusher_t(queueToAdd).attachLatestValueSlot(&getMembers()->m_latestValueSlot);
+                return cxx::success<void>();
+            }
+
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
             if (requestedHistory > getMembers()->m_historyCapacity)
@@ -77,9 +85,13 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             // total history
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
+            const auto& userHeaderFilter = static_cast<const ChunkQueueData_t*>(queueToAdd)->m_userHeaderFilter;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                if (userHeaderFilter.accepts(*getMembers()->m_history[i].getChunkHeader()))
+                {
+                    pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                }
             }
 
             return cxx::success<void>();
@@ -106,6 +118,11 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
     const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
     if (iter != getMembers()->m_queues.end())
     {
+        if (getMembers()->m_latestValueOnly)
+        {
+            ChunkQueuePusher_t(queueToRemove).detachLatestValueSlot(&getMembers()->m_latestValueSlot);
+        }
+
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
 
@@ -122,6 +139,14 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    if (getMembers()->m_latestValueOnly)
+    {
+        for (auto& queue : getMembers()->m_queues)
+        {
+            ChunkQueuePusher_t(queue.get()).detachLatestValueSlot(&getMembers()->m_latestValueSlot);
+        }
+    }
+
     getMembers()->m_queues.clear();
 }
 
@@ -136,6 +161,11 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    if (getMembers()->m_latestValueOnly)
+    {
+        return deliverToLatestValueSlot(chunk);
+    }
+
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
@@ -145,6 +175,14 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
+            // the chunk is neither pushed nor does it wake up the consumer when it is rejected by the filter or the
+            // rate limiter of the queue
+            if (!queue->m_userHeaderFilter.accepts(*chunk.getChunkHeader())
+                || !queue->m_deliveryRateLimiter.admitSample())
+            {
+                continue;
+            }
+
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
             if (pushToQueue(queue.get(), chunk))
@@ -216,11 +254,33 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToLatestValueSlot(mepoo::SharedChunk chunk) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    // a single store independent of the number of queues, the queues take the chunk from the attached slot and are
+    // only notified
+    getMembers()->m_latestValueSlot.store(chunk);
+    for (auto& queue : getMembers()->m_queues)
+    {
+        ChunkQueuePusher_t(queue.get()).notifyLatestValue();
+    }
+    return getMembers()->m_queues.size();
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
-                                                                    mepoo::SharedChunk chunk) noexcept
+                                                                    const mepoo::SharedChunk& chunk) noexcept
 {
-    return ChunkQueuePusher_t(queue).push(chunk);
+    // in the inline mode the chunk is copied into the queue and stays with the sender; a queue without InlineSlots,
+    // e.g. since their pool was exhausted, receives the chunk
+    ChunkQueuePusher_t pusher(queue);
+    if (getMembers()->m_inlineDelivery && InlineSlots::fits(*chunk.getChunkHeader()) && pusher.hasInlineSlots())
+    {
+        return pusher.pushInline(*chunk.getChunkHeader());
+    }
+    return pusher.push(chunk);
 }
 
 template <typename ChunkDistributorDataType>
@@ -295,7 +355,11 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    if (0u < getMembers()->m_historyCapacity)
+    if (getMembers()->m_latestValueOnly)
+    {
+        getMembers()->m_latestValueSlot.store(chunk);
+    }
+    else if (0u < getMembers()->m_historyCapacity)
     {
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
         {
@@ -335,6 +399,7 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
     }
 
     getMembers()->m_history.clear();
+    getMembers()->m_latestValueSlot.clear();
 }
 
 template <typename ChunkDistributorDataType>
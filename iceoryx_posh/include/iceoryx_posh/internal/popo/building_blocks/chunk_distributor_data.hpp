@@ -25,6 +25,7 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
 #include <cstdint>
@@ -43,7 +44,10 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const bool latestValueOnly = false,
+                         const bool inlineDelivery = false) noexcept;
 
     const uint64_t m_historyCapacity;
 
@@ -59,6 +63,15 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief in the latest-value mode the chunks are not pushed into the queues, the newest chunk is stored in the
+    /// m_latestValueSlot which is attached to the queues and replaces the history
+    const bool m_latestValueOnly;
+    LatestValueSlot m_latestValueSlot;
+
+    /// @brief in the inline mode the chunks are copied into the InlineSlots of the queues, the chunks stay with the
+    /// sender; it is disabled in the latest-value mode
+    const bool m_inlineDelivery;
 };
 
 } // namespace popo
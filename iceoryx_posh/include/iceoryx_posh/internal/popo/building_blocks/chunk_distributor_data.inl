@@ -35,10 +35,15 @@ constexpr T min(const T left, const T right) noexcept
 
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const ConsumerTooSlowPolicy policy,
+    const uint64_t historyCapacity,
+    const bool latestValueOnly,
+    const bool inlineDelivery) noexcept
     : LockingPolicy()
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_consumerTooSlowPolicy(policy)
+    , m_latestValueOnly(latestValueOnly)
+    , m_inlineDelivery(inlineDelivery && !latestValueOnly)
 {
     if (m_historyCapacity != historyCapacity)
     {
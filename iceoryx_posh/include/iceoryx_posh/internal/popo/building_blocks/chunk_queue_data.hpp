@@ -19,12 +19,17 @@
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_hoofs/internal/cxx/unique_id.hpp"
+#include "iceoryx_hoofs/internal/memory/relative_pointer_data.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/inline_slots.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -38,7 +43,9 @@ struct ChunkQueueData : public LockingPolicy
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
 
-    ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
+    ChunkQueueData(const QueueFullPolicy policy,
+                   const cxx::VariantQueueTypes queueType,
+                   const QueueConflationPolicy conflationPolicy = QueueConflationPolicy::NONE) noexcept;
 
     cxx::UniqueId m_uniqueId{};
 
@@ -46,9 +53,42 @@ struct ChunkQueueData : public LockingPolicy
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
+    /// @brief the LatestValueSlot of a publisher in the latest-value mode, it is attached by the ChunkDistributor and
+    /// the ChunkQueuePopper provides its newest chunk in addition to the chunks in the queue
+    std::atomic<memory::RelativePointerData> m_latestValueSlot{memory::RelativePointerData()};
+    /// @brief the slot and the sequence number of the last chunk the ChunkQueuePopper acquired from a LatestValueSlot
+    memory::RelativePointerData m_lastAcquiredLatestValueSlot;
+    uint64_t m_lastAcquiredLatestValueSequenceNumber{0U};
+
+    /// @brief the InlineSlots into which publishers with inline delivery copy their chunks, RouDi attaches them from a
+    /// pool when the queue is connected to such a publisher
+    std::atomic<memory::RelativePointerData> m_inlineSlots{memory::RelativePointerData()};
+    /// @brief the number of chunks which entered and left the queue, they are counted to provide the chunks of the
+    /// queue and of the InlineSlots in the order of their arrival
+    std::atomic<uint64_t> m_numberOfEnqueuedChunks{0U};
+    std::atomic<uint64_t> m_numberOfDequeuedChunks{0U};
+
     memory::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
+    /// @brief when set, the condition variable is notified on a missed deadline instead of on every push
+    bool m_conditionVariableNotifiesOnMissedDeadline{false};
     const QueueFullPolicy m_queueFullPolicy;
+    /// @brief with the KEEP_LATEST_PER_KEY policy the pushers and the popper access the queue under the lock since a
+    /// chunk can replace a pending one
+    const QueueConflationPolicy m_queueConflationPolicy;
+    /// @brief evaluated by the ChunkDistributor before a chunk is pushed, it must not be changed while the queue is
+    /// known by a ChunkDistributor
+    UserHeaderFilter m_userHeaderFilter;
+    /// @brief consulted by the ChunkDistributor for every sample which passed the filter, it must be configured before
+    /// the queue is known by a ChunkDistributor
+    DeliveryRateLimiter m_deliveryRateLimiter;
+    /// @brief the period in nanoseconds in which the consumer expects a new chunk, zero disables the deadline
+    /// monitoring; it must be configured before the queue is known by a ChunkDistributor
+    uint64_t m_deadlineNs{0U};
+    /// @brief the time of the last push, it is only updated when a deadline is configured
+    std::atomic<uint64_t> m_lastArrivalTimestampNs{0U};
+    /// @brief the arrival time for which the last missed deadline was notified, a missed deadline is notified once
+    uint64_t m_lastNotifiedMissedDeadlineArrivalNs{0U};
 };
 
 } // namespace popo
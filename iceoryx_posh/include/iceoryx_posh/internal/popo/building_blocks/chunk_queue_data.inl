@@ -23,9 +23,12 @@ namespace popo
 {
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
-    const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
+    const QueueFullPolicy policy,
+    const cxx::VariantQueueTypes queueType,
+    const QueueConflationPolicy conflationPolicy) noexcept
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
+    , m_queueConflationPolicy(conflationPolicy)
 {
 }
 
@@ -19,9 +19,11 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
 
 namespace iox
 {
@@ -46,16 +48,49 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
-    /// @return optional for a shared chunk that is set if the queue is not empty
+    /// @brief pop a chunk from the chunk queue, if the queue is empty the newest chunk of an attached
+    /// LatestValueSlot is acquired if it was not acquired before
+    /// @return optional for a shared chunk that is set if the queue is not empty or the slot has a new chunk
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief take the oldest chunk which was copied into an inline slot, the slot is held until it is released
+    /// @return the ChunkHeader in the inline slot or a nullptr if there is no such chunk
+    const mepoo::ChunkHeader* tryPopInline() noexcept;
+
+    /// @brief release an inline slot which was taken with tryPopInline
+    /// @param[in] chunkHeader which was returned by tryPopInline
+    /// @return false if the ChunkHeader does not belong to a taken inline slot, otherwise true
+    bool releaseInline(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief checks if the oldest inline chunk arrived before the chunks in the queue, i.e. if tryPopInline instead of
+    /// tryPop provides the next chunk in the order of arrival
+    /// @return true if an inline chunk is pending and no chunk in the queue arrived before it, otherwise false
+    bool isInlineChunkNext() noexcept;
+
+    /// @brief checks if InlineSlots are attached to the queue
+    /// @return true if InlineSlots are attached, otherwise false
+    bool hasInlineSlots() const noexcept;
+
+    /// @brief attaches the InlineSlots into which publishers with inline delivery copy their chunks
+    /// @param[in] slots which replace previously attached slots
+    /// @pre the queue is not connected to a publisher with inline delivery
+    void attachInlineSlots(cxx::not_null<InlineSlots* const> slots) noexcept;
+
+    /// @brief detaches the InlineSlots, e.g. to return them to their pool
+    /// @return the detached slots or a nullptr if no slots were attached
+    /// @pre the queue is not connected to a publisher with inline delivery and no inline chunk is held
+    InlineSlots* detachInlineSlots() noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
 
+    /// @brief check if the deadline of the queue was missed
+    /// @return true if a deadline is configured and no chunk was pushed within the deadline, otherwise false
+    bool hasMissedDeadline() const noexcept;
+
     /// @brief pop a chunk from the chunk queue
-    /// @return if the queue is empty return true, otherwise false
+    /// @return if the queue is empty and an attached LatestValueSlot has no new chunk return true, otherwise false
     bool empty() const noexcept;
 
     /// @brief get the current size of the queue. Caution, another thread can have changed the size just after reading
@@ -77,7 +112,7 @@ class ChunkQueuePopper
     /// @return maximum capacity of this queue
     uint64_t getMaximumCapacity() const noexcept;
 
-    /// @brief clear the queue
+    /// @brief clear the queue and the pending inline slots
     void clear() noexcept;
 
     /// @brief Attaches a condition variable
@@ -85,6 +120,17 @@ class ChunkQueuePopper
     void setConditionVariable(ConditionVariableData& conditionVariableDataRef,
                               const uint64_t notificationIndex) noexcept;
 
+    /// @brief Attaches a condition variable which is notified once per missed deadline instead of on every push
+    /// @param[in] conditionVariableDataRef, reference to a condition variable data object
+    /// @param[in] notificationIndex, the index with which the condition variable is notified
+    void setConditionVariableForMissedDeadline(ConditionVariableData& conditionVariableDataRef,
+                                               const uint64_t notificationIndex) noexcept;
+
+    /// @brief Notifies a condition variable attached with setConditionVariableForMissedDeadline when the deadline is
+    /// missed, a miss is notified only once until the next chunk arrives
+    /// @return true if the condition variable was notified, otherwise false
+    bool notifyOnMissedDeadline() noexcept;
+
     /// @brief Detaches a condition variable
     void unsetConditionVariable() noexcept;
 
@@ -95,8 +141,14 @@ class ChunkQueuePopper
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+    InlineSlots* inlineSlots() const noexcept;
 
   private:
+    cxx::optional<mepoo::ShmSafeUnmanagedChunk> popFromQueue() noexcept;
+    bool isQueueEmpty() const noexcept;
+    cxx::optional<mepoo::SharedChunk> tryAcquireLatestValue() noexcept;
+    uint64_t lastAcquiredLatestValueSequenceNumber(const memory::RelativePointerData slot) const noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
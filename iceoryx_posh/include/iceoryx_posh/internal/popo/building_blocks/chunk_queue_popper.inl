@@ -48,12 +48,15 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
 {
-    auto retVal = getMembers()->m_queue.pop();
+    auto retVal = popFromQueue();
+    auto maybeChunk = retVal.has_value()
+                          ? cxx::make_optional<mepoo::SharedChunk>(retVal.value().releaseToSharedChunk())
+                          : tryAcquireLatestValue();
 
-    // check if queue had an element that was poped and return if so
-    if (retVal.has_value())
+    // check if queue had an element that was poped or the slot had a new chunk and return if so
+    if (maybeChunk.has_value())
     {
-        auto chunk = retVal.value().releaseToSharedChunk();
+        auto& chunk = maybeChunk.value();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
         if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
@@ -64,7 +67,7 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
                          ErrorLevel::SEVERE);
             return cxx::nullopt_t();
         }
-        return cxx::make_optional<mepoo::SharedChunk>(chunk);
+        return maybeChunk;
     }
     else
     {
@@ -72,6 +75,125 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+inline const mepoo::ChunkHeader* ChunkQueuePopper<ChunkQueueDataType>::tryPopInline() noexcept
+{
+    auto* slots = inlineSlots();
+    return (slots != nullptr) ? slots->tryTake() : nullptr;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::releaseInline(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    auto* slots = inlineSlots();
+    return (slots != nullptr) && slots->release(chunkHeader);
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::isInlineChunkNext() noexcept
+{
+    auto* slots = inlineSlots();
+    if (slots == nullptr)
+    {
+        return false;
+    }
+
+    auto numberOfEnqueuedChunksBefore = slots->numberOfEnqueuedChunksBeforeOldest();
+    if (!numberOfEnqueuedChunksBefore.has_value())
+    {
+        return false;
+    }
+
+    // the inline chunk is next when all chunks which entered the queue before it left the queue; the counters of
+    // concurrent pushers can lag behind the queue, an empty queue therefore never delays the inline chunk
+    return numberOfEnqueuedChunksBefore.value()
+               <= getMembers()->m_numberOfDequeuedChunks.load(std::memory_order_relaxed)
+           || isQueueEmpty();
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::hasInlineSlots() const noexcept
+{
+    return inlineSlots() != nullptr;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::attachInlineSlots(cxx::not_null<InlineSlots* const> slots) noexcept
+{
+    getMembers()->m_inlineSlots.store(InlineSlots::toRelativePointerData(slots), std::memory_order_release);
+}
+
+template <typename ChunkQueueDataType>
+inline InlineSlots* ChunkQueuePopper<ChunkQueueDataType>::detachInlineSlots() noexcept
+{
+    return InlineSlots::fromRelativePointerData(
+        getMembers()->m_inlineSlots.exchange(memory::RelativePointerData(), std::memory_order_acq_rel));
+}
+
+template <typename ChunkQueueDataType>
+inline InlineSlots* ChunkQueuePopper<ChunkQueueDataType>::inlineSlots() const noexcept
+{
+    return InlineSlots::fromRelativePointerData(getMembers()->m_inlineSlots.load(std::memory_order_acquire));
+}
+
+template <typename ChunkQueueDataType>
+inline cxx::optional<mepoo::ShmSafeUnmanagedChunk> ChunkQueuePopper<ChunkQueueDataType>::popFromQueue() noexcept
+{
+    cxx::optional<mepoo::ShmSafeUnmanagedChunk> maybeUnmanagedChunk;
+    if (getMembers()->m_queueConflationPolicy == QueueConflationPolicy::KEEP_LATEST_PER_KEY)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        maybeUnmanagedChunk = getMembers()->m_queue.pop();
+    }
+    else
+    {
+        maybeUnmanagedChunk = getMembers()->m_queue.pop();
+    }
+
+    if (maybeUnmanagedChunk.has_value())
+    {
+        getMembers()->m_numberOfDequeuedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return maybeUnmanagedChunk;
+}
+
+template <typename ChunkQueueDataType>
+inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryAcquireLatestValue() noexcept
+{
+    const auto slotData = getMembers()->m_latestValueSlot.load(std::memory_order_acquire);
+    auto* slot = LatestValueSlot::fromRelativePointerData(slotData);
+    if (slot == nullptr)
+    {
+        return cxx::nullopt_t();
+    }
+
+    auto sequenceNumber = lastAcquiredLatestValueSequenceNumber(slotData);
+    auto maybeChunk = slot->tryAcquire(sequenceNumber);
+    getMembers()->m_lastAcquiredLatestValueSlot = slotData;
+    getMembers()->m_lastAcquiredLatestValueSequenceNumber = sequenceNumber;
+
+    // the slot is shared by all queues, therefore the filter is evaluated when the chunk is acquired
+    if (maybeChunk.has_value() && !getMembers()->m_userHeaderFilter.accepts(*maybeChunk.value().getChunkHeader()))
+    {
+        return cxx::nullopt_t();
+    }
+    return maybeChunk;
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::lastAcquiredLatestValueSequenceNumber(
+    const memory::RelativePointerData slot) const noexcept
+{
+    // the sequence numbers of different slots are unrelated, if another slot was attached none of its chunks was
+    // acquired so far
+    const auto& lastAcquiredSlot = getMembers()->m_lastAcquiredLatestValueSlot;
+    if (lastAcquiredSlot.id() == slot.id() && lastAcquiredSlot.offset() == slot.offset())
+    {
+        return getMembers()->m_lastAcquiredLatestValueSequenceNumber;
+    }
+    return 0U;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -83,18 +205,58 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
     return false;
 }
 
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::hasMissedDeadline() const noexcept
+{
+    const auto deadline = getMembers()->m_deadlineNs;
+    if (deadline == 0U)
+    {
+        return false;
+    }
+
+    const auto lastArrivalTimestamp = getMembers()->m_lastArrivalTimestampNs.load(std::memory_order_relaxed);
+    const auto now = mepoo::monotonicTimestamp();
+    return now > lastArrivalTimestamp && now - lastArrivalTimestamp > deadline;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
-    return getMembers()->m_queue.empty();
+    const auto* slots = inlineSlots();
+    if (!isQueueEmpty() || (slots != nullptr && !slots->empty()))
+    {
+        return false;
+    }
+
+    const auto slotData = getMembers()->m_latestValueSlot.load(std::memory_order_acquire);
+    const auto* slot = LatestValueSlot::fromRelativePointerData(slotData);
+    return (slot == nullptr) || !slot->hasNewChunk(lastAcquiredLatestValueSequenceNumber(slotData));
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
+    if (getMembers()->m_queueConflationPolicy == QueueConflationPolicy::KEEP_LATEST_PER_KEY)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        return getMembers()->m_queue.size();
+    }
     return getMembers()->m_queue.size();
 }
 
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::isQueueEmpty() const noexcept
+{
+    // a conflating pusher rotates the pending chunks through the queue, without the lock a single pending chunk could
+    // be missed
+    if (getMembers()->m_queueConflationPolicy == QueueConflationPolicy::KEEP_LATEST_PER_KEY)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        return getMembers()->m_queue.empty();
+    }
+    return getMembers()->m_queue.empty();
+}
+
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::setCapacity(const uint64_t newCapacity) noexcept
 {
@@ -121,6 +283,17 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        getMembers()->m_numberOfDequeuedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    auto* slots = inlineSlots();
+    if (slots == nullptr)
+    {
+        return;
+    }
+    while (auto chunkHeader = slots->tryTake())
+    {
+        slots->release(chunkHeader);
     }
 }
 
@@ -132,6 +305,45 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_conditionVariableNotifiesOnMissedDeadline = false;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariableForMissedDeadline(
+    ConditionVariableData& conditionVariableDataRef, const uint64_t notificationIndex) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
+    getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_conditionVariableNotifiesOnMissedDeadline = true;
+    // differs from the last arrival so that a deadline which is already missed is notified as well
+    getMembers()->m_lastNotifiedMissedDeadlineArrivalNs =
+        getMembers()->m_lastArrivalTimestampNs.load(std::memory_order_relaxed) - 1U;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::notifyOnMissedDeadline() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    if (!getMembers()->m_conditionVariableDataPtr || !getMembers()->m_conditionVariableNotifiesOnMissedDeadline
+        || !hasMissedDeadline())
+    {
+        return false;
+    }
+
+    const auto lastArrivalTimestamp = getMembers()->m_lastArrivalTimestampNs.load(std::memory_order_relaxed);
+    if (lastArrivalTimestamp == getMembers()->m_lastNotifiedMissedDeadlineArrivalNs)
+    {
+        return false;
+    }
+
+    getMembers()->m_lastNotifiedMissedDeadlineArrivalNs = lastArrivalTimestamp;
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .notify();
+    return true;
 }
 
 template <typename ChunkQueueDataType>
@@ -141,6 +353,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
+    getMembers()->m_conditionVariableNotifiesOnMissedDeadline = false;
 }
 
 template <typename ChunkQueueDataType>
@@ -19,9 +19,12 @@
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
+#include "iceoryx_posh/popo/conflation_key_header.hpp"
 
 namespace iox
 {
@@ -45,19 +48,49 @@ class ChunkQueuePusher
     ChunkQueuePusher& operator=(ChunkQueuePusher&& rhs) noexcept = default;
     ~ChunkQueuePusher() noexcept = default;
 
-    /// @brief push a new chunk to the chunk queue
+    /// @brief push a new chunk to the chunk queue, with the QueueConflationPolicy::KEEP_LATEST_PER_KEY the chunk
+    /// replaces a pending chunk with the same conflation key instead
     /// @param[in] shared chunk object
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief copies a chunk into a free inline slot of the queue instead of pushing the chunk, with the
+    /// QueueFullPolicy::DISCARD_OLDEST_DATA the oldest pending inline slot is overwritten if there is no free one
+    /// @param[in] chunkHeader of the chunk which must fit into an inline slot, see InlineSlots::fits
+    /// @return false if no InlineSlots are attached, the chunk could not be copied or a pending one was overwritten,
+    /// otherwise true
+    bool pushInline(const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief checks if InlineSlots are attached to the queue, otherwise pushInline cannot copy a chunk
+    /// @return true if InlineSlots are attached, otherwise false
+    bool hasInlineSlots() const noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief attaches the LatestValueSlot of a publisher in the latest-value mode, the queue then additionally
+    /// provides the newest chunk of the slot
+    /// @param[in] slot which replaces a previously attached slot
+    void attachLatestValueSlot(cxx::not_null<LatestValueSlot* const> slot) noexcept;
+
+    /// @brief detaches the LatestValueSlot if it is the currently attached one
+    /// @param[in] slot which shall be detached
+    void detachLatestValueSlot(cxx::not_null<LatestValueSlot* const> slot) noexcept;
+
+    /// @brief tells the queue that a new chunk was stored in its attached LatestValueSlot, it updates the arrival
+    /// timestamp and notifies an attached condition variable without pushing a chunk
+    void notifyLatestValue() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    void updateArrivalTimestamp() noexcept;
+    bool pushConflated(mepoo::SharedChunk chunk) noexcept;
+    bool replacePendingChunkWithSameKey(mepoo::SharedChunk chunk) noexcept;
+    void notify() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
 
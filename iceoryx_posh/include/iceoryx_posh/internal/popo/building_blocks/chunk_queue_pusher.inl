@@ -46,36 +46,181 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
+    updateArrivalTimestamp();
+
+    if (getMembers()->m_queueConflationPolicy == QueueConflationPolicy::KEEP_LATEST_PER_KEY)
+    {
+        return pushConflated(chunk);
+    }
+
     auto pushRet = getMembers()->m_queue.push(chunk);
+    getMembers()->m_numberOfEnqueuedChunks.fetch_add(1U, std::memory_order_relaxed);
     bool hasQueueOverflow = false;
 
     // drop the chunk if one is returned by an overflow
     if (pushRet.has_value())
     {
         pushRet.value().releaseToSharedChunk();
+        getMembers()->m_numberOfDequeuedChunks.fetch_add(1U, std::memory_order_relaxed);
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
     }
 
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        notify();
+    }
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushInline(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    auto* inlineSlots =
+        InlineSlots::fromRelativePointerData(getMembers()->m_inlineSlots.load(std::memory_order_acquire));
+    if (inlineSlots == nullptr)
+    {
+        lostAChunk();
+        return false;
+    }
+
+    updateArrivalTimestamp();
+
+    const bool discardOldest = getMembers()->m_queueFullPolicy == QueueFullPolicy::DISCARD_OLDEST_DATA;
+    const bool hasQueueOverflow = !inlineSlots->push(
+        chunkHeader, discardOldest, getMembers()->m_numberOfEnqueuedChunks.load(std::memory_order_relaxed));
+
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        notify();
+    }
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::hasInlineSlots() const noexcept
+{
+    return !getMembers()->m_inlineSlots.load(std::memory_order_relaxed).isLogicalNullptr();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyLatestValue() noexcept
+{
+    updateArrivalTimestamp();
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    notify();
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::updateArrivalTimestamp() noexcept
+{
+    if (getMembers()->m_deadlineNs > 0U)
+    {
+        getMembers()->m_lastArrivalTimestampNs.store(mepoo::monotonicTimestamp(), std::memory_order_relaxed);
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushConflated(mepoo::SharedChunk chunk) noexcept
+{
+    bool hasQueueOverflow = false;
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (!replacePendingChunkWithSameKey(chunk))
+    {
+        auto pushRet = getMembers()->m_queue.push(chunk);
+        getMembers()->m_numberOfEnqueuedChunks.fetch_add(1U, std::memory_order_relaxed);
+        if (pushRet.has_value())
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
+            pushRet.value().releaseToSharedChunk();
+            getMembers()->m_numberOfDequeuedChunks.fetch_add(1U, std::memory_order_relaxed);
+            hasQueueOverflow = true;
         }
     }
+    notify();
 
     return !hasQueueOverflow;
 }
 
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::replacePendingChunkWithSameKey(mepoo::SharedChunk chunk) noexcept
+{
+    auto key = ConflationKeyHeader::fromChunkHeader(*chunk.getChunkHeader());
+    if (!key.has_value())
+    {
+        return false;
+    }
+
+    // the queue has no random access, therefore the pending chunks are rotated once through it and the one with the
+    // same key is replaced in place which keeps the order of the other keys; this is safe since the pushers and the
+    // popper of a conflating queue hold the lock and a push always follows a pop
+    bool wasReplaced = false;
+    const auto numberOfPendingChunks = getMembers()->m_queue.size();
+    for (uint64_t i = 0U; i < numberOfPendingChunks; ++i)
+    {
+        auto maybePendingChunk = getMembers()->m_queue.pop();
+        if (!maybePendingChunk.has_value())
+        {
+            break;
+        }
+
+        auto& pendingChunk = maybePendingChunk.value();
+        if (!wasReplaced && (ConflationKeyHeader::fromChunkHeader(*pendingChunk.getChunkHeader()) == key))
+        {
+            pendingChunk.releaseToSharedChunk();
+            pendingChunk = mepoo::ShmSafeUnmanagedChunk(chunk);
+            wasReplaced = true;
+        }
+
+        auto pushRet = getMembers()->m_queue.push(pendingChunk);
+        if (pushRet.has_value())
+        {
+            pushRet.value().releaseToSharedChunk();
+            getMembers()->m_numberOfDequeuedChunks.fetch_add(1U, std::memory_order_relaxed);
+            lostAChunk();
+        }
+    }
+
+    return wasReplaced;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    if (getMembers()->m_conditionVariableDataPtr && !getMembers()->m_conditionVariableNotifiesOnMissedDeadline)
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
+}
+
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline void
+ChunkQueuePusher<ChunkQueueDataType>::attachLatestValueSlot(cxx::not_null<LatestValueSlot* const> slot) noexcept
+{
+    getMembers()->m_latestValueSlot.store(LatestValueSlot::toRelativePointerData(slot), std::memory_order_release);
+}
+
+template <typename ChunkQueueDataType>
+inline void
+ChunkQueuePusher<ChunkQueueDataType>::detachLatestValueSlot(cxx::not_null<LatestValueSlot* const> slot) noexcept
+{
+    // another publisher could have attached its slot in the meantime, this one must not be detached
+    auto attachedSlot = LatestValueSlot::toRelativePointerData(slot);
+    getMembers()->m_latestValueSlot.compare_exchange_strong(
+        attachedSlot, memory::RelativePointerData(), std::memory_order_release, std::memory_order_relaxed);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -19,6 +19,8 @@
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -50,6 +52,29 @@ inline std::ostream& operator<<(std::ostream& stream, ChunkReceiveResult value)
 /// @return the reference to `stream` which was provided as input parameter
 inline log::LogStream& operator<<(log::LogStream& stream, ChunkReceiveResult value) noexcept;
 
+enum class ChunkReleaseResult
+{
+    INVALID_CHUNK,
+    CHUNK_DELIVERED_INLINE
+};
+
+/// @brief Converts the ChunkReleaseResult to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const ChunkReleaseResult value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, ChunkReleaseResult value) noexcept;
+
+/// @brief Convenience stream operator to easily use the `asStringLiteral` function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to `stream` which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, ChunkReleaseResult value) noexcept;
+
 /// @brief The ChunkReceiver is a building block of the shared memory communication infrastructure. It extends
 /// the functionality of a ChunkQueuePopper with the abililty to pass chunks to the user side (user process).
 /// Together with the ChunkSender, they are the next abstraction layer on top of ChunkDistributor and ChunkQueuePopper.
@@ -73,7 +98,10 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
 
     /// @brief Tries to get the next received chunk. If there is a new one the ChunkHeader of this new chunk is received
     /// The ownerhip of the SharedChunk remains in the ChunkReceiver for being able to cleanup if the user process
-    /// disappears
+    /// disappears. Chunks which were copied into inline slots are provided in the order of their arrival together
+    /// with the chunks in the queue, the ChunkHeader then resides in the slot. Chunks which exceed the maximum sample
+    /// age are discarded and counted. The publish-to-take latency of the provided chunk is recorded in the latency
+    /// histogram of its publisher.
     /// @return New chunk header, ChunkReceiveResult on error
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
@@ -82,14 +110,31 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Releases a chunk that was obtained with get but hands over the ownership of the chunk instead of
+    /// dropping it, e.g. to forward the chunk with a ChunkSender without copying it
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @return the SharedChunk of the released chunk, ChunkReleaseResult::INVALID_CHUNK if the chunk was not obtained
+    /// with get or ChunkReleaseResult::CHUNK_DELIVERED_INLINE if the chunk resides in an inline slot, the slot is then
+    /// still held and must be released with release
+    cxx::expected<mepoo::SharedChunk, ChunkReleaseResult>
+    releaseToSharedChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
     void releaseAll() noexcept;
 
+    /// @brief the number of chunks which were discarded since they exceeded the maximum sample age
+    /// @return the number of expired chunks since the creation of the ChunkReceiverData
+    uint64_t numberOfExpiredChunks() const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    bool isExpired(const mepoo::ChunkHeader& chunkHeader, uint64_t& now) const noexcept;
+
+    void recordLatency(const mepoo::ChunkHeader& chunkHeader, uint64_t& now) noexcept;
 };
 
 } // namespace popo
@@ -49,6 +49,31 @@ inline log::LogStream& operator<<(log::LogStream& stream, ChunkReceiveResult val
     return stream;
 }
 
+inline constexpr const char* asStringLiteral(const ChunkReleaseResult value) noexcept
+{
+    switch (value)
+    {
+    case ChunkReleaseResult::INVALID_CHUNK:
+        return "ChunkReleaseResult::INVALID_CHUNK";
+    case ChunkReleaseResult::CHUNK_DELIVERED_INLINE:
+        return "ChunkReleaseResult::CHUNK_DELIVERED_INLINE";
+    }
+
+    return "[Undefined ChunkReleaseResult]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, ChunkReleaseResult value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, ChunkReleaseResult value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
 template <typename ChunkReceiverDataType>
 inline ChunkReceiver<ChunkReceiverDataType>::ChunkReceiver(
     cxx::not_null<MemberType_t* const> chunkReceiverDataPtr) noexcept
@@ -74,15 +99,44 @@ template <typename ChunkReceiverDataType>
 inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
 ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
 {
-    auto popRet = this->tryPop();
-
-    if (popRet.has_value())
+    // the current time is only acquired when it is required to check the age of a chunk
+    uint64_t now{0U};
+    while (true)
     {
+        // the chunks in the queue and in the inline slots are provided in the order of their arrival; the inline
+        // slots are not tracked in the chunks in use, their number already limits how many can be held
+        if (this->isInlineChunkNext())
+        {
+            const auto* chunkHeader = this->tryPopInline();
+            if (isExpired(*chunkHeader, now))
+            {
+                getMembers()->m_numberOfExpiredChunks.fetch_add(1U, std::memory_order_relaxed);
+                this->releaseInline(chunkHeader);
+                continue;
+            }
+
+            recordLatency(*chunkHeader, now);
+            return cxx::success<const mepoo::ChunkHeader*>(chunkHeader);
+        }
+
+        auto popRet = this->tryPop();
+        if (!popRet.has_value())
+        {
+            return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+        }
         auto sharedChunk = *popRet;
 
+        // expired chunks are released and the next chunk is tried
+        if (isExpired(*sharedChunk.getChunkHeader(), now))
+        {
+            getMembers()->m_numberOfExpiredChunks.fetch_add(1U, std::memory_order_relaxed);
+            continue;
+        }
+
         // if the application holds too many chunks, don't provide more
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
+            recordLatency(*sharedChunk.getChunkHeader(), now);
             return cxx::success<const mepoo::ChunkHeader*>(
                 const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -93,12 +147,16 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
             return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
         }
     }
-    return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    if (this->releaseInline(chunkHeader))
+    {
+        return;
+    }
+
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
     if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
@@ -107,13 +165,82 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
     }
 }
 
+template <typename ChunkReceiverDataType>
+inline cxx::expected<mepoo::SharedChunk, ChunkReleaseResult>
+ChunkReceiver<ChunkReceiverDataType>::releaseToSharedChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    // a chunk which was copied into an inline slot has no SharedChunk, the slot stays held until it is released
+    const auto* slots = this->inlineSlots();
+    if (slots != nullptr && slots->isHeld(chunkHeader))
+    {
+        return cxx::error<ChunkReleaseResult>(ChunkReleaseResult::CHUNK_DELIVERED_INLINE);
+    }
+
+    mepoo::SharedChunk chunk(nullptr);
+    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    {
+        errorHandler(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, ErrorLevel::SEVERE);
+        return cxx::error<ChunkReleaseResult>(ChunkReleaseResult::INVALID_CHUNK);
+    }
+    return cxx::success<mepoo::SharedChunk>(std::move(chunk));
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    auto* slots = this->inlineSlots();
+    if (slots != nullptr)
+    {
+        slots->releaseAll();
+    }
     this->clear();
 }
 
+template <typename ChunkReceiverDataType>
+inline uint64_t ChunkReceiver<ChunkReceiverDataType>::numberOfExpiredChunks() const noexcept
+{
+    return getMembers()->m_numberOfExpiredChunks.load(std::memory_order_relaxed);
+}
+
+template <typename ChunkReceiverDataType>
+inline bool ChunkReceiver<ChunkReceiverDataType>::isExpired(const mepoo::ChunkHeader& chunkHeader,
+                                                            uint64_t& now) const noexcept
+{
+    const auto maximumSampleAge = getMembers()->m_maximumSampleAgeNs;
+    const auto publishTimestamp = chunkHeader.publishTimestamp();
+    // chunks which were not sent by a ChunkSender have no publish timestamp and never expire
+    if (maximumSampleAge == 0U || publishTimestamp == 0U)
+    {
+        return false;
+    }
+
+    if (now == 0U)
+    {
+        now = mepoo::monotonicTimestamp();
+    }
+    return now > publishTimestamp && now - publishTimestamp > maximumSampleAge;
+}
+
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::recordLatency(const mepoo::ChunkHeader& chunkHeader,
+                                                                uint64_t& now) noexcept
+{
+    const auto publishTimestamp = chunkHeader.publishTimestamp();
+    // chunks which were not sent by a ChunkSender have no publish timestamp and are not recorded
+    if (publishTimestamp == 0U)
+    {
+        return;
+    }
+
+    if (now == 0U)
+    {
+        now = mepoo::monotonicTimestamp();
+    }
+    const uint64_t latency = (now > publishTimestamp) ? now - publishTimestamp : 0U;
+    getMembers()->m_latencyHistograms.record(chunkHeader.originId(), latency);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -20,9 +20,12 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histograms.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -30,9 +33,11 @@ namespace popo
 template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
 struct ChunkReceiverData : public ChunkQueueDataType
 {
-    explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
-                               const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+    explicit ChunkReceiverData(
+        const cxx::VariantQueueTypes queueType,
+        const QueueFullPolicy queueFullPolicy,
+        const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+        const QueueConflationPolicy queueConflationPolicy = QueueConflationPolicy::NONE) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
@@ -43,6 +48,14 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
     UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// @brief chunks which were published longer ago than the maximum sample age in nanoseconds are discarded by the
+    /// ChunkReceiver instead of being passed to the user, zero disables the check
+    uint64_t m_maximumSampleAgeNs{0U};
+    std::atomic<uint64_t> m_numberOfExpiredChunks{0U};
+
+    /// @brief publish-to-take latency of the chunks which were passed to the user, read by the port introspection
+    LatencyHistograms m_latencyHistograms;
 };
 
 } // namespace popo
@@ -40,6 +40,8 @@ enum class AllocationError
     TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
     INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
     INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    /// @brief a sample passed to adopt resides in an inline slot of the subscriber and cannot be adopted
+    CHUNK_DELIVERED_INLINE,
 };
 } // namespace popo
 
@@ -99,13 +101,39 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
     /// to omit a user-header
     /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
-    /// user-payload fields, error if not
+    /// user-payload fields, error if not, e.g. if the chunk does not fit into an inline slot in the inline mode
     cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocate(const UniquePortId originId,
                                                                     const uint32_t userPayloadSize,
                                                                     const uint32_t userPayloadAlignment,
                                                                     const uint32_t userHeaderSize,
                                                                     const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate a further segment of a multi-chunk message, the segment is owned by the message and released or
+    /// sent together with it
+    /// @param[in] messageChunkHeader, pointer to the ChunkHeader of an allocated chunk which is the first segment of
+    /// the message
+    /// @param[in] userPayloadSize, size of the user-payload of the segment
+    /// @param[in] userPayloadAlignment, alignment of the user-payload of the segment
+    /// @return on success pointer to the ChunkHeader of the segment, error if not or in the inline mode
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateSegment(const mepoo::ChunkHeader* const messageChunkHeader,
+                       const uint32_t userPayloadSize,
+                       const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Takes over a chunk which was obtained elsewhere, e.g. received by a ChunkReceiver, as if it was allocated
+    /// with tryAllocate. The chunk is adopted without a copy if this is its only owner and it was obtained from the
+    /// MemoryManager of this ChunkSender, otherwise a new chunk is allocated and the user-header and user-payload are
+    /// copied into it.
+    /// @param[in] originId, the unique id of the entity which requested this adopt
+    /// @param[in] chunk, the chunk to adopt; it is consumed in any case
+    /// @return on success pointer to the ChunkHeader of the adopted chunk which can be sent like an allocated chunk,
+    /// error if not
+    /// @note The ChunkSender which sent the chunk keeps a reference to its last chunk and to the chunks in its history.
+    /// In a pipeline the adopt is therefore only copy-free once the upstream ChunkSender sent its next chunk and the
+    /// adopted chunk is no longer in its history.
+    cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAdopt(const UniquePortId originId,
+                                                                 mepoo::SharedChunk&& chunk) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -131,6 +159,12 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Deliver the last sent chunk once more to all stored queues, e.g. to notify the subscribers that the
+    /// content of a chunk which they hold was extended
+    /// @return the number of receivers the chunk was delivered to, 0 if there is no last sent chunk
+    /// @note The chunk header is not modified and the chunk is not added to the history again
+    uint64_t resendPreviousChunk() noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
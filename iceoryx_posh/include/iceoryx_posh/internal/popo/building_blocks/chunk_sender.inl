@@ -18,8 +18,11 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_INL
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_INL
 
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 
+#include <cstring>
+
 namespace iox
 {
 namespace cxx
@@ -59,6 +62,8 @@ inline constexpr const char* asStringLiteral(const AllocationError value) noexce
         return "AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER";
     case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
         return "AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER";
+    case AllocationError::CHUNK_DELIVERED_INLINE:
+        return "AllocationError::CHUNK_DELIVERED_INLINE";
     }
 
     return "[Undefined AllocationError]";
@@ -103,9 +108,17 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
                                               const uint32_t userHeaderSize,
                                               const uint32_t userHeaderAlignment) noexcept
 {
+    // in the inline mode the samples are copied into the queues of the receivers, a sample which does not fit into
+    // an inline slot would have to be delivered as chunk and could overtake the previous samples
+    if (getMembers()->m_inlineDelivery && !InlineSlots::fits(userPayloadSize, userPayloadAlignment, userHeaderSize))
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
     // use the chunk stored in m_lastChunkUnmanaged if:
     //   - there is a valid chunk
     //   - there is no other owner
+    //   - it is not a multi-chunk message whose segments would have to be released first
     //   - the new user-payload still fits in it
     const auto chunkSettingsResult =
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
@@ -121,7 +134,8 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
 
-    if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
+    if (lastChunkChunkHeader && (lastChunkChunkHeader->nextSegment() == nullptr)
+        && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
         auto sharedChunk = lastChunkUnmanaged.cloneToSharedChunk();
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
@@ -141,7 +155,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_mempoolReservation);
 
         if (!getChunkResult.has_error())
         {
@@ -169,6 +183,116 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline cxx::expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateSegment(const mepoo::ChunkHeader* const messageChunkHeader,
+                                                     const uint32_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment) noexcept
+{
+    // the chunk of the message is only looked up, it is put back to the chunks in use right away which cannot fail
+    // since its slot was just freed
+    mepoo::SharedChunk messageChunk(nullptr);
+    if (!getMembers()->m_chunksInUse.remove(messageChunkHeader, messageChunk))
+    {
+        errorHandler(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_APPEND_SEGMENT_FROM_USER, ErrorLevel::SEVERE);
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+    const bool isMessageChunkReinserted = getMembers()->m_chunksInUse.insert(messageChunk);
+    cxx::Ensures(isMessageChunkReinserted);
+
+    // multi-chunk messages cannot be copied into inline slots
+    if (getMembers()->m_inlineDelivery)
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    const auto chunkSettingsResult = mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    auto getChunkResult =
+        getMembers()->m_memoryMgr->getChunk(chunkSettingsResult.value(), getMembers()->m_mempoolReservation);
+    if (getChunkResult.has_error())
+    {
+        /// @todo iox-#1012 use cxx::error<E2>::from(E1); once available
+        return cxx::error<AllocationError>(cxx::into<AllocationError>(getChunkResult.get_error()));
+    }
+
+    auto segmentChunkHeader = getChunkResult.value().getChunkHeader();
+    segmentChunkHeader->setOriginId(messageChunkHeader->originId());
+    messageChunk.appendSegment(std::move(getChunkResult.value()));
+    return cxx::success<mepoo::ChunkHeader*>(segmentChunkHeader);
+}
+
+template <typename ChunkSenderDataType>
+inline cxx::expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAdopt(const UniquePortId originId, mepoo::SharedChunk&& chunk) noexcept
+{
+    auto sourceChunk = std::move(chunk);
+    auto* sourceChunkHeader = sourceChunk.getChunkHeader();
+    if (sourceChunkHeader == nullptr
+        || (getMembers()->m_inlineDelivery && !InlineSlots::fits(*sourceChunkHeader)))
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the chunk can be reused without a copy if:
+    //   - there is no other owner which would observe the modifications of the chunk header and the user-payload
+    //   - the chunk and all its segments reside in the memory of this sender, i.e. they can be accessed by the
+    //     subscribers of this sender
+    bool isInMemoryOfThisSender{true};
+    for (auto segment = sourceChunkHeader; segment != nullptr; segment = segment->nextSegment())
+    {
+        isInMemoryOfThisSender = isInMemoryOfThisSender && getMembers()->m_memoryMgr->containsChunk(segment);
+    }
+
+    if (sourceChunk.hasNoOtherOwners() && isInMemoryOfThisSender)
+    {
+        if (!getMembers()->m_chunksInUse.insert(sourceChunk))
+        {
+            return cxx::error<AllocationError>(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+        }
+        sourceChunkHeader->setOriginId(originId);
+        return cxx::success<mepoo::ChunkHeader*>(sourceChunkHeader);
+    }
+
+    // the user-header is always placed right after the ChunkHeader, therefore its alignment does not influence the
+    // layout of the chunk and the user-header of the new chunk is at the same offset as the one of the source chunk
+    const auto userHeaderSize = sourceChunkHeader->userHeaderSize();
+    auto allocationResult = tryAllocate(originId,
+                                        sourceChunkHeader->userPayloadSize(),
+                                        sourceChunkHeader->userPayloadAlignment(),
+                                        userHeaderSize,
+                                        CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (allocationResult.has_error())
+    {
+        return allocationResult;
+    }
+
+    auto* chunkHeader = allocationResult.value();
+    if (userHeaderSize != 0U)
+    {
+        std::memcpy(chunkHeader->userHeader(), sourceChunkHeader->userHeader(), userHeaderSize);
+        chunkHeader->setUserHeaderId(sourceChunkHeader->userHeaderId());
+    }
+    std::memcpy(chunkHeader->userPayload(), sourceChunkHeader->userPayload(), sourceChunkHeader->userPayloadSize());
+
+    for (auto segment = sourceChunkHeader->nextSegment(); segment != nullptr; segment = segment->nextSegment())
+    {
+        auto segmentResult =
+            tryAllocateSegment(chunkHeader, segment->userPayloadSize(), segment->userPayloadAlignment());
+        if (segmentResult.has_error())
+        {
+            release(chunkHeader);
+            return segmentResult;
+        }
+        std::memcpy(segmentResult.value()->userPayload(), segment->userPayload(), segment->userPayloadSize());
+    }
+    return allocationResult;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -234,6 +358,17 @@ inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader*
     // END of critical section
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::resendPreviousChunk() noexcept
+{
+    auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
+    if (lastChunkUnmanaged.isLogicalNullptr())
+    {
+        return 0U;
+    }
+    return this->deliverToAllStoredQueues(lastChunkUnmanaged.cloneToSharedChunk());
+}
+
 template <typename ChunkSenderDataType>
 inline cxx::optional<const mepoo::ChunkHeader*> ChunkSender<ChunkSenderDataType>::tryGetPreviousChunk() const noexcept
 {
@@ -262,6 +397,7 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        chunk.getChunkHeader()->setPublishTimestamp(mepoo::monotonicTimestamp());
         return true;
     }
     else
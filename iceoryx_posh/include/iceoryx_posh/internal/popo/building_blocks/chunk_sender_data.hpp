@@ -35,12 +35,16 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const mepoo::MemPoolReservation_t mempoolReservation = mepoo::NO_MEMPOOL_RESERVATION,
+                             const bool latestValueOnly = false,
+                             const bool inlineDelivery = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
     const memory::RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
+    const mepoo::MemPoolReservation_t m_mempoolReservation;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
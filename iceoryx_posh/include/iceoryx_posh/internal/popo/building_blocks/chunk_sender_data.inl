@@ -26,10 +26,14 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const mepoo::MemPoolReservation_t mempoolReservation,
+    const bool latestValueOnly,
+    const bool inlineDelivery) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, latestValueOnly, inlineDelivery)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_mempoolReservation(mempoolReservation)
 {
 }
 
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
+#include "iceoryx_hoofs/internal/concurrent/cache_line_padding.hpp"
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -38,11 +39,15 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
-    cxx::optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
+    /// @brief the semaphore and the flags are modified by the notifiers and the listener, the paddings keep the
+    /// runtime name and the neighbouring ConditionVariableData out of their cache lines
+    concurrent::CacheLinePadding m_paddingBeforeNotifications;
+    cxx::optional<posix::UnnamedSemaphore> m_semaphore;
     std::atomic_bool m_toBeDestroyed{false};
     std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
     std::atomic_bool m_wasNotified{false};
+    concurrent::CacheLinePadding m_paddingAfterNotifications;
 };
 
 } // namespace popo
@@ -0,0 +1,75 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The DeliveryRateLimiter decides for a subscriber queue which samples the ChunkDistributor delivers. With a
+/// decimation of N only every Nth sample is delivered and with a minimum interval a sample is only delivered when the
+/// interval elapsed since the last delivered sample. If both are configured a sample must satisfy both conditions.
+/// Samples which are not admitted are neither pushed into the queue nor do they wake up the subscriber.
+/// @note the limiter lives in the shared memory and can be used by multiple publishers concurrently
+class DeliveryRateLimiter
+{
+  public:
+    DeliveryRateLimiter() noexcept = default;
+
+    DeliveryRateLimiter(const DeliveryRateLimiter&) = delete;
+    DeliveryRateLimiter(DeliveryRateLimiter&&) = delete;
+    DeliveryRateLimiter& operator=(const DeliveryRateLimiter&) = delete;
+    DeliveryRateLimiter& operator=(DeliveryRateLimiter&&) = delete;
+    ~DeliveryRateLimiter() noexcept = default;
+
+    /// @brief configures the limiter, must be called before the queue is known by a ChunkDistributor
+    /// @param[in] decimation only every Nth sample is delivered, 0 and 1 deliver every sample
+    /// @param[in] minimumInterval between two delivered samples, zero disables the check
+    void configure(const uint64_t decimation, const units::Duration minimumInterval) noexcept;
+
+    /// @brief checks if the limiter skips samples at all
+    /// @return true if a decimation or a minimum interval is configured, otherwise false
+    bool isActive() const noexcept;
+
+    /// @brief decides whether the next sample is delivered, the current time is only acquired when a minimum interval
+    /// is configured
+    /// @return true if the sample shall be delivered, otherwise false
+    bool admitSample() noexcept;
+
+    /// @brief decides whether the next sample is delivered
+    /// @param[in] timestampNs the current time in nanoseconds of a monotonic clock
+    /// @return true if the sample shall be delivered, otherwise false
+    bool admitSample(const uint64_t timestampNs) noexcept;
+
+  private:
+    static constexpr uint64_t NO_DELIVERY_YET{0U};
+
+    uint64_t m_decimation{1U};
+    uint64_t m_minimumIntervalNs{0U};
+    std::atomic<uint64_t> m_numberOfSamples{0U};
+    std::atomic<uint64_t> m_lastDeliveryTimestampNs{NO_DELIVERY_YET};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_RATE_LIMITER_HPP
@@ -0,0 +1,136 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_INLINE_SLOTS_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_INLINE_SLOTS_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/concurrent/lockfree_queue/index_queue.hpp"
+#include "iceoryx_hoofs/internal/memory/relative_pointer_data.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Fixed-size slots of a chunk queue into which small chunks are copied instead of pushing a reference to the
+/// chunk. RouDi takes the slots from a pool and attaches them to a queue when it is connected to a publisher with
+/// inline delivery. A slot holds a copy of the ChunkHeader and the user-payload with the layout of the chunk,
+/// the consumer can therefore use the ChunkHeader in the slot like the one of a chunk. This avoids the reference
+/// counting and the release of a shared chunk per consumer.
+/// @note A slot is either free, written by a producer, ready to be taken or held by the consumer. The ownership is
+/// passed with two lock-free index queues, one for the free and one for the ready slots. Every slot stores the number
+/// of chunks which were pushed into the queue before it, this allows the consumer to provide the chunks of the queue
+/// and of the slots in the order of their arrival.
+/// @concurrent push can be called concurrently by multiple producers, the other methods must be called by a single
+/// consumer
+class InlineSlots
+{
+  public:
+    static constexpr uint64_t CAPACITY{MAX_INLINE_SLOTS_PER_SUBSCRIBER};
+    static constexpr uint32_t MAX_USER_PAYLOAD_SIZE{MAX_INLINE_USER_PAYLOAD_SIZE};
+    static constexpr uint64_t SLOT_SIZE{sizeof(mepoo::ChunkHeader) + MAX_USER_PAYLOAD_SIZE};
+
+    InlineSlots() noexcept = default;
+    explicit InlineSlots(const RuntimeName_t& runtimeName) noexcept;
+    InlineSlots(const InlineSlots&) = delete;
+    InlineSlots(InlineSlots&&) = delete;
+    InlineSlots& operator=(const InlineSlots&) = delete;
+    InlineSlots& operator=(InlineSlots&&) = delete;
+    ~InlineSlots() noexcept = default;
+
+    /// @brief checks if a chunk with the given parameters can be copied into a slot, this is the case if it has no
+    /// user-header, the user-payload follows directly after the ChunkHeader and is not larger than
+    /// MAX_USER_PAYLOAD_SIZE
+    static bool fits(const uint32_t userPayloadSize,
+                     const uint32_t userPayloadAlignment,
+                     const uint32_t userHeaderSize) noexcept;
+
+    /// @brief checks if the chunk can be copied into a slot, in addition to the parameters it must have no further
+    /// segments
+    static bool fits(const mepoo::ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief copies the ChunkHeader and the user-payload of a chunk into a free slot
+    /// @param[in] chunkHeader of the chunk, it must fit into a slot
+    /// @param[in] discardOldest if true, the oldest ready slot is overwritten when there is no free slot
+    /// @param[in] numberOfEnqueuedChunks the number of chunks which were pushed into the queue so far
+    /// @return false if the chunk could not be stored or the oldest ready slot was overwritten, otherwise true
+    bool push(const mepoo::ChunkHeader& chunkHeader,
+              const bool discardOldest,
+              const uint64_t numberOfEnqueuedChunks = 0U) noexcept;
+
+    /// @brief provides the number of chunks which were pushed into the queue before the oldest ready slot, the slot
+    /// is kept by the consumer until it is taken and cannot be overwritten by a producer anymore
+    /// @return the number which was passed to push for the oldest ready slot, a nullopt if no slot is ready
+    cxx::optional<uint64_t> numberOfEnqueuedChunksBeforeOldest() noexcept;
+
+    /// @brief takes the oldest ready slot, it is held by the consumer until it is released
+    /// @return the ChunkHeader in the slot, a nullptr if no slot is ready
+    const mepoo::ChunkHeader* tryTake() noexcept;
+
+    /// @brief releases a slot which was taken
+    /// @param[in] chunkHeader which was returned by tryTake
+    /// @return false if the ChunkHeader does not belong to a slot which is held by the consumer, otherwise true
+    bool release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief checks if the ChunkHeader belongs to a slot which is held by the consumer
+    /// @param[in] chunkHeader to check
+    /// @return true if the slot of the ChunkHeader was taken and not released yet, otherwise false
+    bool isHeld(const mepoo::ChunkHeader* const chunkHeader) const noexcept;
+
+    /// @brief releases all held and all ready slots, e.g. when the consumer is gone
+    void releaseAll() noexcept;
+
+    /// @brief checks if there is no ready slot
+    bool empty() const noexcept;
+
+    /// @brief converts the address of the slots into a representation which can be stored in an atomic in the shared
+    /// memory
+    static memory::RelativePointerData toRelativePointerData(InlineSlots* const slots) noexcept;
+
+    /// @brief converts the representation created by toRelativePointerData back into the address of the slots
+    /// @return the address of the slots or nullptr if the RelativePointerData is logically a nullptr
+    static InlineSlots* fromRelativePointerData(const memory::RelativePointerData data) noexcept;
+
+    /// @brief the runtime of the subscriber the slots are attached to
+    RuntimeName_t m_runtimeName;
+
+  private:
+    struct alignas(mepoo::ChunkHeader) Slot
+    {
+        uint8_t m_data[SLOT_SIZE];
+    };
+
+    cxx::optional<uint64_t> heldSlotIndex(const mepoo::ChunkHeader* const chunkHeader) const noexcept;
+    void releaseSlot(const uint64_t index) noexcept;
+
+    Slot m_slots[CAPACITY];
+    uint64_t m_numberOfEnqueuedChunks[CAPACITY]{};
+    /// @brief only accessed by the consumer
+    bool m_isHeld[CAPACITY]{};
+    /// @brief the oldest ready slot which the consumer already removed from m_readyIndices, only accessed by the
+    /// consumer
+    cxx::optional<uint64_t> m_oldestReadyIndex;
+    concurrent::IndexQueue<CAPACITY> m_freeIndices{concurrent::IndexQueue<CAPACITY>::ConstructFull};
+    concurrent::IndexQueue<CAPACITY> m_readyIndices{concurrent::IndexQueue<CAPACITY>::ConstructEmpty};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_INLINE_SLOTS_HPP
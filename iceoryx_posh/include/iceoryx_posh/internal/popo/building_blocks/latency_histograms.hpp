@@ -0,0 +1,91 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAMS_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAMS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Records the publish-to-take latency of the chunks a subscriber takes in a histogram per publisher. The
+/// histograms reside in the shared memory and are read by the port introspection.
+/// @note Bucket 0 counts the latencies below 1 us, bucket i the latencies in [2^(i-1), 2^i) us and the last bucket
+/// all larger latencies. A histogram is assigned to a publisher when the first chunk of it is recorded. When all
+/// histograms are assigned, the least recently recorded one is cleared and reassigned, so that a restarted publisher,
+/// which has a new unique id, is recorded again.
+/// @concurrent record must be called by a single thread only, the getters can be called concurrently from any thread;
+/// a reader which races with the reassignment of a histogram may see counts of the previous publisher
+class LatencyHistograms
+{
+  public:
+    static constexpr uint32_t CAPACITY{MAX_LATENCY_HISTOGRAMS_PER_SUBSCRIBER};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS};
+
+    LatencyHistograms() noexcept = default;
+    LatencyHistograms(const LatencyHistograms&) = delete;
+    LatencyHistograms(LatencyHistograms&&) = delete;
+    LatencyHistograms& operator=(const LatencyHistograms&) = delete;
+    LatencyHistograms& operator=(LatencyHistograms&&) = delete;
+    ~LatencyHistograms() noexcept = default;
+
+    /// @brief records the latency of a chunk in the histogram of the publisher it originates from
+    /// @param[in] originId the unique id of the publisher which sent the chunk
+    /// @param[in] latencyNs the time between the publish and the take of the chunk in nanoseconds
+    void record(const UniquePortId& originId, const uint64_t latencyNs) noexcept;
+
+    /// @brief returns the number of histograms which are assigned to a publisher
+    uint32_t size() const noexcept;
+
+    /// @brief returns the unique id of the publisher the histogram with the given index is assigned to, an invalid id
+    /// if the index is out of range
+    UniquePortId getOriginId(const uint32_t index) const noexcept;
+
+    /// @brief returns the count of a bucket of the histogram with the given index, 0 if an index is out of range
+    uint64_t getBucketCount(const uint32_t index, const uint32_t bucket) const noexcept;
+
+    /// @brief returns how often a histogram was cleared and reassigned to another publisher since all histograms were
+    /// assigned
+    uint64_t getNumberOfReassignments() const noexcept;
+
+    /// @brief returns the index of the bucket to which the latency belongs
+    static uint32_t bucketIndex(const uint64_t latencyNs) noexcept;
+
+  private:
+    struct Histogram
+    {
+        UniquePortId m_originId{InvalidPortId};
+        uint64_t m_lastRecord{0U};
+        std::atomic<uint64_t> m_bucketCounts[NUMBER_OF_BUCKETS]{};
+    };
+
+    uint32_t leastRecentlyRecordedIndex() const noexcept;
+
+    std::atomic<uint32_t> m_size{0U};
+    std::atomic<uint64_t> m_numberOfReassignments{0U};
+    uint64_t m_numberOfRecords{0U};
+    Histogram m_histograms[CAPACITY];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAMS_HPP
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/memory/relative_pointer_data.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueSlot holds the newest chunk of a publisher in the latest-value mode. Instead of pushing the
+/// chunk into the queue of every subscriber, the publisher replaces the chunk in the slot and the subscribers acquire
+/// it from there. The cost of a publish is therefore independent of the number of subscribers.
+/// The slot is a sequence lock. The sequence number is odd while the writer replaces the chunk and is incremented to
+/// the next even number afterwards. A reader acquires a reference to the chunk and checks that the sequence number did
+/// not change in the meantime. Readers never wait for the writer, if the writer is in progress or died while writing,
+/// the reader behaves as if there is no new chunk.
+/// @note the writers must be synchronized externally, e.g. by the lock of the ChunkDistributorData
+class LatestValueSlot
+{
+  public:
+    LatestValueSlot() noexcept = default;
+
+    LatestValueSlot(const LatestValueSlot&) = delete;
+    LatestValueSlot(LatestValueSlot&&) = delete;
+    LatestValueSlot& operator=(const LatestValueSlot&) = delete;
+    LatestValueSlot& operator=(LatestValueSlot&&) = delete;
+    ~LatestValueSlot() noexcept = default;
+
+    /// @brief replaces the chunk in the slot and releases the previous one
+    /// @param[in] chunk which becomes the newest chunk, the slot holds a reference to it until it is replaced
+    /// @concurrent not thread safe with respect to other writers
+    void store(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief releases the chunk in the slot
+    /// @concurrent not thread safe with respect to other writers
+    void clear() noexcept;
+
+    /// @brief acquires the chunk in the slot if it was stored after the chunk with the given sequence number
+    /// @param[in] sequenceNumber of the last chunk the reader acquired, 0 if the reader did not acquire a chunk so far;
+    /// is updated to the sequence number of the slot when the slot content was read consistently
+    /// @return the newest chunk if there is one which the reader has not acquired yet, otherwise nullopt
+    cxx::optional<mepoo::SharedChunk> tryAcquire(uint64_t& sequenceNumber) noexcept;
+
+    /// @brief checks if there is a chunk which was stored after the chunk with the given sequence number
+    /// @param[in] sequenceNumber of the last chunk the reader acquired
+    /// @return true if tryAcquire would most likely return a chunk, otherwise false
+    bool hasNewChunk(const uint64_t sequenceNumber) const noexcept;
+
+    /// @brief converts the address of a slot into a representation which can be stored in an atomic in the shared
+    /// memory
+    static memory::RelativePointerData toRelativePointerData(LatestValueSlot* const slot) noexcept;
+
+    /// @brief converts the representation created by toRelativePointerData back into the address of the slot
+    /// @return the address of the slot or nullptr if the RelativePointerData is logically a nullptr
+    static LatestValueSlot* fromRelativePointerData(const memory::RelativePointerData data) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_sequenceNumber{0U};
+    std::atomic<mepoo::ShmSafeUnmanagedChunk> m_chunk{mepoo::ShmSafeUnmanagedChunk()};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
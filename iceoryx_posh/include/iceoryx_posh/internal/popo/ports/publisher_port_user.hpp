@@ -62,6 +62,24 @@ class PublisherPortUser : public BasePort
                      const uint32_t userHeaderSize = 0U,
                      const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a further segment of a multi-chunk message, the segment is sent or released together with the
+    /// first segment of the message
+    /// @param[in] messageChunkHeader, pointer to the ChunkHeader of the allocated chunk of the message
+    /// @param[in] userPayloadSize, size of the user-payload of the segment
+    /// @param[in] userPayloadAlignment, alignment of the user-payload of the segment
+    /// @return on success pointer to the ChunkHeader of the segment, error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateSegment(const mepoo::ChunkHeader* const messageChunkHeader,
+                       const uint32_t userPayloadSize,
+                       const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Adopt a chunk which was received by a subscriber port to send it with this port, the chunk is only
+    /// copied if it has other owners or does not reside in the memory of this port
+    /// @param[in] chunk, the chunk to adopt; it is consumed in any case
+    /// @return on success pointer to the ChunkHeader of the adopted chunk which can be sent like an allocated chunk,
+    /// error if not
+    cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAdoptChunk(mepoo::SharedChunk&& chunk) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -74,6 +92,9 @@ class PublisherPortUser : public BasePort
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
+    /// @brief Deliver the last sent chunk once more to all connected subscriber ports if the port is offered
+    void resendPreviousChunk() noexcept;
+
     /// @brief offer this publiher port in the system
     void offer() noexcept;
 
@@ -63,6 +63,24 @@ class SubscriberPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief notifies the condition variable attached for missed deadlines when the subscriber missed its deadline,
+    /// called periodically by RouDi which limits the resolution of the notification to the discovery interval
+    /// @return true if the condition variable was notified, otherwise false
+    bool notifyOnMissedDeadline() noexcept;
+
+    /// @brief checks if InlineSlots are attached to the queue of the subscriber
+    /// @return true if InlineSlots are attached, otherwise false
+    bool hasInlineSlots() const noexcept;
+
+    /// @brief attaches the InlineSlots into which publishers with inline delivery copy their samples, required before
+    /// the subscriber is connected to such a publisher
+    /// @param[in] inlineSlots which are used by the subscriber until they are detached
+    void attachInlineSlots(cxx::not_null<InlineSlots* const> inlineSlots) noexcept;
+
+    /// @brief detaches the InlineSlots when the subscriber is destroyed
+    /// @return the detached slots or a nullptr if no slots were attached
+    InlineSlots* detachInlineSlots() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -71,6 +71,15 @@ class SubscriberPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release a chunk that was obtained with tryGetChunk and hand over its ownership, e.g. to forward it with
+    /// a publisher port without copying it
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @return the SharedChunk of the released chunk, ChunkReleaseResult::INVALID_CHUNK if the chunk was not obtained
+    /// with tryGetChunk or ChunkReleaseResult::CHUNK_DELIVERED_INLINE if the chunk was delivered inline, it is then
+    /// still held and must be released with releaseChunk
+    cxx::expected<mepoo::SharedChunk, ChunkReleaseResult>
+    releaseChunkToSharedChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     /// @brief Release all the chunks that are currently queued up.
     void releaseQueuedChunks() noexcept;
 
@@ -82,9 +91,21 @@ class SubscriberPortUser : public BasePort
     /// @return true if the underlying queue overflowed since last call of this method, otherwise false
     bool hasLostChunksSinceLastCall() noexcept;
 
+    /// @brief check if no chunk arrived within the deadline of the subscriber
+    /// @return true if a deadline is configured and it was missed, otherwise false
+    bool hasMissedDeadline() const noexcept;
+
+    /// @brief the number of chunks which were discarded since they exceeded the maximum sample age
+    /// @return the number of expired chunks since the creation of the subscriber
+    uint64_t numberOfExpiredChunks() const noexcept;
+
     /// @brief attach a condition variable (via its pointer) to subscriber
     void setConditionVariable(ConditionVariableData& conditionVariableData, const uint64_t notificationIndex) noexcept;
 
+    /// @brief attach a condition variable to the subscriber which RouDi notifies once per missed deadline
+    void setConditionVariableForMissedDeadline(ConditionVariableData& conditionVariableData,
+                                               const uint64_t notificationIndex) noexcept;
+
     /// @brief detach a condition variable from subscriber
     void unsetConditionVariable() noexcept;
 
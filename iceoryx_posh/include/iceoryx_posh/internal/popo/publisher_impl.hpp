@@ -20,8 +20,10 @@
 
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iceoryx_posh/popo/conflation_key_header.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 
 namespace iox
@@ -55,6 +57,21 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     cxx::expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    ///
+    /// @brief loanSegment Get a further segment for a loaned sample to send a message which is larger than the chunks
+    /// of a single mempool, e.g. the points of a point cloud whose description is the sample.
+    /// @param sample The loaned sample which is the first segment of the message.
+    /// @param userPayloadSize The size of the segment.
+    /// @param userPayloadAlignment The alignment of the segment.
+    /// @return A pointer to the memory of the segment or an error if unable to allocate memory to loan.
+    /// @details The segment is published or released together with the sample, the subscribers iterate over the
+    /// segments with mepoo::ChunkSegments.
+    ///
+    cxx::expected<void*, AllocationError>
+    loanSegment(const Sample<T, H>& sample,
+                const uint32_t userPayloadSize,
+                const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
@@ -76,6 +93,24 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename Callable, typename... ArgTypes>
     cxx::expected<AllocationError> publishResultOf(Callable c, ArgTypes... args) noexcept;
 
+    ///
+    /// @brief adopt Turns a sample which was taken from a subscriber into a sample of this publisher, e.g. to forward
+    /// it after an in-place modification. The chunk is reused without a copy if the subscriber holds the only
+    /// reference to it and it resides in the shared memory of this publisher, otherwise it is copied into a newly
+    /// loaned chunk.
+    /// @param subscriber The subscriber from which the sample was taken.
+    /// @param sample The sample to adopt, it is consumed unless it was delivered inline.
+    /// @return The adopted sample which can be modified and published or an error if unable to allocate memory for
+    /// the copy or AllocationError::CHUNK_DELIVERED_INLINE if the sample was delivered inline.
+    /// @note The chunk has further references as long as it is the last chunk or in the history of the publisher it
+    /// originates from or taken by other subscribers. In a pipeline the adopt is therefore only copy-free once the
+    /// upstream publisher has sent its next sample and the adopted one is no longer in its history. Samples which
+    /// were delivered inline are not backed by a chunk and cannot be adopted, they remain owned by the provided sample.
+    ///
+    template <typename SubscriberPortType>
+    cxx::expected<Sample<T, H>, AllocationError> adopt(BaseSubscriber<SubscriberPortType>& subscriber,
+                                                       Sample<const T, const H>&& sample) noexcept;
+
   protected:
     using BasePublisherType::port;
 
@@ -67,6 +67,34 @@ inline cxx::expected<AllocationError> PublisherImpl<T, H, BasePublisherType>::pu
     });
 }
 
+template <typename T, typename H, typename BasePublisherType>
+template <typename SubscriberPortType>
+inline cxx::expected<Sample<T, H>, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::adopt(BaseSubscriber<SubscriberPortType>& subscriber,
+                                              Sample<const T, const H>&& sample) noexcept
+{
+    auto chunk = subscriber.port().releaseChunkToSharedChunk(mepoo::ChunkHeader::fromUserPayload(sample.get()));
+    if (chunk.has_error())
+    {
+        // a sample which was delivered inline is still held by the subscriber and released with the sample
+        return cxx::error<AllocationError>((chunk.get_error() == ChunkReleaseResult::CHUNK_DELIVERED_INLINE)
+                                               ? AllocationError::CHUNK_DELIVERED_INLINE
+                                               : AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+    // the ownership of the chunk was handed over from the subscriber port
+    sample.release();
+
+    auto result = port().tryAdoptChunk(std::move(chunk.value()));
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return cxx::success<Sample<T, H>>(convertChunkHeaderToSample(result.value()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline cxx::expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::loanSample() noexcept
 {
@@ -79,10 +107,30 @@ inline cxx::expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePubl
     }
     else
     {
+        if (std::is_base_of<ConflationKeyHeader, H>::value)
+        {
+            result.value()->setUserHeaderId(ConflationKeyHeader::USER_HEADER_ID);
+        }
         return cxx::success<Sample<T, H>>(convertChunkHeaderToSample(result.value()));
     }
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline cxx::expected<void*, AllocationError> PublisherImpl<T, H, BasePublisherType>::loanSegment(
+    const Sample<T, H>& sample, const uint32_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    auto result = port().tryAllocateSegment(
+        mepoo::ChunkHeader::fromUserPayload(sample.get()), userPayloadSize, userPayloadAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return cxx::success<void*>(result.value()->userPayload());
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sample) noexcept
 {
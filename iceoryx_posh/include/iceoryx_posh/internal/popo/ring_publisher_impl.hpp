@@ -0,0 +1,81 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_PUBLISHER_IMPL_HPP
+#define IOX_POSH_POPO_RING_PUBLISHER_IMPL_HPP
+
+#include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/byte_ring.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The RingPublisherImpl class implements the ring publisher API
+/// @note Not intended for public usage! Use the `RingPublisher` instead!
+template <typename BasePublisherType = BasePublisher<>>
+class RingPublisherImpl : public BasePublisherType
+{
+  public:
+    ///
+    /// @brief Creates a publisher which writes variable-size records into a ByteRing in a single chunk.
+    /// @param service The service description of the topic.
+    /// @param ringCapacity The capacity of the ring in bytes, must be a power of two, see ByteRing::isValidCapacity.
+    /// @param publisherOptions The options of the publisher, the history capacity is at least 1 so that subscribers
+    ///        which connect later receive the ring, the subscriberTooSlowPolicy is always DISCARD_OLDEST_DATA and the
+    ///        latest-value mode and the inline delivery are not supported.
+    ///
+    RingPublisherImpl(const capro::ServiceDescription& service,
+                      const uint64_t ringCapacity,
+                      const PublisherOptions& publisherOptions = PublisherOptions());
+    RingPublisherImpl(const RingPublisherImpl& other) = delete;
+    RingPublisherImpl& operator=(const RingPublisherImpl&) = delete;
+    RingPublisherImpl(RingPublisherImpl&& rhs) = delete;
+    RingPublisherImpl& operator=(RingPublisherImpl&& rhs) = delete;
+    virtual ~RingPublisherImpl() = default;
+
+    ///
+    /// @brief Copies a record into the ring, the oldest records are overwritten if there is not enough space. The
+    ///        chunk for the ring is loaned and published with the first record.
+    /// @param record Pointer to the data of the record.
+    /// @param size The size of the record in bytes.
+    /// @return An error if the record is too large or the chunk for the ring could not be loaned.
+    /// @note The subscribers are not notified about the record, see notify.
+    ///
+    cxx::expected<ByteRingError> write(const void* const record, const ByteRing::RecordSize_t size) noexcept;
+
+    ///
+    /// @brief Notifies the subscribers about the records which were written since the last notification, e.g. to wake
+    ///        up a WaitSet or Listener. Every notification pushes the chunk of the ring into the queues of the
+    ///        subscribers, it should therefore be called once for a batch of records instead of for every record.
+    ///
+    void notify() noexcept;
+
+  protected:
+    using BasePublisherType::port;
+
+  private:
+    static PublisherOptions ringPublisherOptions(const PublisherOptions& publisherOptions) noexcept;
+
+    uint64_t m_ringCapacity{0U};
+    ByteRing* m_ring{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/ring_publisher_impl.inl"
+
+#endif // IOX_POSH_POPO_RING_PUBLISHER_IMPL_HPP
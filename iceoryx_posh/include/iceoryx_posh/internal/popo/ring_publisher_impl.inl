@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_PUBLISHER_IMPL_INL
+#define IOX_POSH_POPO_RING_PUBLISHER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/ring_publisher_impl.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace iox
+{
+namespace popo
+{
+template <typename BasePublisherType>
+inline RingPublisherImpl<BasePublisherType>::RingPublisherImpl(const capro::ServiceDescription& service,
+                                                               const uint64_t ringCapacity,
+                                                               const PublisherOptions& publisherOptions)
+    : BasePublisherType(service, ringPublisherOptions(publisherOptions))
+    , m_ringCapacity(ringCapacity)
+{
+    cxx::Expects(ByteRing::isValidCapacity(ringCapacity));
+}
+
+template <typename BasePublisherType>
+inline PublisherOptions
+RingPublisherImpl<BasePublisherType>::ringPublisherOptions(const PublisherOptions& publisherOptions) noexcept
+{
+    auto options = publisherOptions;
+    options.historyCapacity = std::max<uint64_t>(options.historyCapacity, 1U);
+    options.subscriberTooSlowPolicy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA;
+    options.latestValueOnly = false;
+    options.inlineDelivery = false;
+    return options;
+}
+
+template <typename BasePublisherType>
+inline cxx::expected<ByteRingError>
+RingPublisherImpl<BasePublisherType>::write(const void* const record, const ByteRing::RecordSize_t size) noexcept
+{
+    if (m_ring != nullptr)
+    {
+        return m_ring->write(record, size);
+    }
+
+    auto allocationResult = port().tryAllocateChunk(static_cast<uint32_t>(ByteRing::requiredMemorySize(m_ringCapacity)),
+                                                    alignof(ByteRing),
+                                                    CHUNK_NO_USER_HEADER_SIZE,
+                                                    CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (allocationResult.has_error())
+    {
+        return cxx::error<ByteRingError>(ByteRingError::RING_NOT_AVAILABLE);
+    }
+
+    // the ring is published with the first record, it stays in the history of the publisher and is delivered again by
+    // notify, therefore it is never released while the publisher exists
+    auto chunkHeader = allocationResult.value();
+    m_ring = new (chunkHeader->userPayload()) ByteRing(m_ringCapacity);
+    auto writeResult = m_ring->write(record, size);
+    port().sendChunk(chunkHeader);
+    return writeResult;
+}
+
+template <typename BasePublisherType>
+inline void RingPublisherImpl<BasePublisherType>::notify() noexcept
+{
+    if (m_ring != nullptr)
+    {
+        port().resendPreviousChunk();
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RING_PUBLISHER_IMPL_INL
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_HPP
+#define IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/byte_ring.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The RingSubscriberImpl class implements the ring subscriber API
+/// @note Not intended for public usage! Use the `RingSubscriber` instead!
+template <typename BaseSubscriberType = BaseSubscriber<>>
+class RingSubscriberImpl : public BaseSubscriberType
+{
+  public:
+    using BaseSubscriber = BaseSubscriberType;
+    using SelfType = RingSubscriberImpl<BaseSubscriberType>;
+
+    ///
+    /// @brief Creates a subscriber which reads the records a RingPublisher writes into its ring.
+    /// @param service The service description of the topic.
+    /// @param subscriberOptions The options of the subscriber, the history request is at least 1 to receive the ring
+    ///        of a publisher which was created earlier, the queue full policy is always DISCARD_OLDEST_DATA and the
+    ///        maximum sample age and the deadline are not supported since the ring is not published again when
+    ///        records are written.
+    ///
+    explicit RingSubscriberImpl(const capro::ServiceDescription& service,
+                                const SubscriberOptions& subscriberOptions = SubscriberOptions());
+    RingSubscriberImpl(const RingSubscriberImpl& other) = delete;
+    RingSubscriberImpl& operator=(const RingSubscriberImpl&) = delete;
+    RingSubscriberImpl(RingSubscriberImpl&& rhs) = delete;
+    RingSubscriberImpl& operator=(RingSubscriberImpl&& rhs) = delete;
+    virtual ~RingSubscriberImpl() noexcept;
+
+    ///
+    /// @brief Copies the next record of the ring into the buffer.
+    /// @param buffer The buffer to which the record is copied.
+    /// @param bufferSize The size of the buffer in bytes.
+    /// @return The size of the record or an error if there is no new record, no ring was received yet or the buffer
+    ///         is too small for the record.
+    /// @note The notifications of the publisher are consumed by every call. When the subscriber is attached to a
+    ///       WaitSet or Listener, records should be read until NO_RECORD_AVAILABLE is returned.
+    ///
+    cxx::expected<ByteRing::RecordSize_t, ByteRingError> read(void* const buffer,
+                                                              const ByteRing::RecordSize_t bufferSize) noexcept;
+
+    ///
+    /// @brief Checks if records were overwritten by the publisher before they were read, the state is reset by the
+    ///        call.
+    /// @return True if records were lost since the last call, otherwise false.
+    ///
+    bool hasLostRecords() noexcept;
+
+  protected:
+    using BaseSubscriber::port;
+
+  private:
+    static SubscriberOptions ringSubscriberOptions(const SubscriberOptions& subscriberOptions) noexcept;
+    void takeNotifications() noexcept;
+    void releaseRing() noexcept;
+
+    const mepoo::ChunkHeader* m_ringChunkHeader{nullptr};
+    cxx::optional<ByteRingReader> m_reader;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/ring_subscriber_impl.inl"
+
+#endif // IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_HPP
@@ -0,0 +1,115 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_INL
+#define IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/ring_subscriber_impl.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+template <typename BaseSubscriberType>
+inline RingSubscriberImpl<BaseSubscriberType>::RingSubscriberImpl(const capro::ServiceDescription& service,
+                                                                  const SubscriberOptions& subscriberOptions)
+    : BaseSubscriber(service, ringSubscriberOptions(subscriberOptions))
+{
+}
+
+template <typename BaseSubscriberType>
+inline RingSubscriberImpl<BaseSubscriberType>::~RingSubscriberImpl() noexcept
+{
+    releaseRing();
+    BaseSubscriberType::m_trigger.reset();
+}
+
+template <typename BaseSubscriberType>
+inline SubscriberOptions
+RingSubscriberImpl<BaseSubscriberType>::ringSubscriberOptions(const SubscriberOptions& subscriberOptions) noexcept
+{
+    auto options = subscriberOptions;
+    options.historyRequest = std::max<uint64_t>(options.historyRequest, 1U);
+    options.queueFullPolicy = QueueFullPolicy::DISCARD_OLDEST_DATA;
+    options.maximumSampleAge = units::Duration::zero();
+    options.deadline = units::Duration::zero();
+    return options;
+}
+
+template <typename BaseSubscriberType>
+inline cxx::expected<ByteRing::RecordSize_t, ByteRingError>
+RingSubscriberImpl<BaseSubscriberType>::read(void* const buffer, const ByteRing::RecordSize_t bufferSize) noexcept
+{
+    takeNotifications();
+    if (!m_reader.has_value())
+    {
+        return cxx::error<ByteRingError>(ByteRingError::RING_NOT_AVAILABLE);
+    }
+    return m_reader->read(buffer, bufferSize);
+}
+
+template <typename BaseSubscriberType>
+inline bool RingSubscriberImpl<BaseSubscriberType>::hasLostRecords() noexcept
+{
+    return m_reader.has_value() && m_reader->hasLostRecords();
+}
+
+template <typename BaseSubscriberType>
+inline void RingSubscriberImpl<BaseSubscriberType>::takeNotifications() noexcept
+{
+    // every chunk in the queue is either the ring which is already held and only notifies about new records or the
+    // ring of a publisher which replaced the previous one
+    for (auto result = BaseSubscriber::takeChunk(); !result.has_error(); result = BaseSubscriber::takeChunk())
+    {
+        const auto chunkHeader = result.value();
+        if (chunkHeader == m_ringChunkHeader)
+        {
+            port().releaseChunk(chunkHeader);
+            continue;
+        }
+
+        const auto ring = static_cast<const ByteRing*>(chunkHeader->userPayload());
+        const bool isRing = chunkHeader->userPayloadSize() >= sizeof(ByteRing)
+                            && ByteRing::isValidCapacity(ring->capacity())
+                            && ByteRing::requiredMemorySize(ring->capacity()) <= chunkHeader->userPayloadSize();
+        if (!isRing)
+        {
+            port().releaseChunk(chunkHeader);
+            continue;
+        }
+
+        releaseRing();
+        m_ringChunkHeader = chunkHeader;
+        m_reader.emplace(*ring);
+    }
+}
+
+template <typename BaseSubscriberType>
+inline void RingSubscriberImpl<BaseSubscriberType>::releaseRing() noexcept
+{
+    if (m_ringChunkHeader != nullptr)
+    {
+        m_reader.reset();
+        port().releaseChunk(m_ringChunkHeader);
+        m_ringChunkHeader = nullptr;
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RING_SUBSCRIBER_IMPL_INL
@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 
 namespace iox
@@ -53,6 +54,20 @@ class UntypedPublisherImpl : public BasePublisherType
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
          const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
 
+    ///
+    /// @brief Get a further segment for a loaned chunk to send a message which is larger than the chunks of a single
+    ///        mempool. The segment is published or released together with the loaned chunk.
+    /// @param userPayload Pointer to the user-payload of the loaned chunk which is the first segment of the message.
+    /// @param userPayloadSize The expected user-payload size of the segment.
+    /// @param userPayloadAlignment The expected user-payload alignment of the segment.
+    /// @return A pointer to the user-payload of the segment or an AllocationError if no chunk could be loaned.
+    /// @note The subscribers iterate over the segments with mepoo::ChunkSegments.
+    ///
+    cxx::expected<void*, AllocationError>
+    loanSegment(void* const userPayload,
+                const uint32_t userPayloadSize,
+                const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
     ///
     /// @brief Publish the provided memory chunk.
     /// @param userPayload Pointer to the user-payload of the allocated shared memory chunk.
@@ -69,6 +84,25 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void release(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Turns a chunk which was taken from a subscriber into a chunk of this publisher, e.g. to forward it after
+    ///        an in-place modification. The chunk is reused without a copy if the subscriber holds the only reference
+    ///        to it and it resides in the shared memory of this publisher, otherwise it is copied into a newly loaned
+    ///        chunk.
+    /// @param subscriber The subscriber from which the chunk was taken.
+    /// @param userPayload Pointer to the user-payload of the taken chunk, the chunk is released from the subscriber
+    ///        and must not be accessed afterwards unless it was delivered inline.
+    /// @return A pointer to the user-payload of the adopted chunk which can be modified and published or an
+    ///         AllocationError if no chunk could be loaned for the copy or AllocationError::CHUNK_DELIVERED_INLINE if
+    ///         the chunk was delivered inline. A chunk which was delivered inline is still held by the subscriber and
+    ///         must be released there.
+    /// @note The chunk is only adopted without a copy once the upstream publisher has sent its next chunk and the
+    ///       adopted one is no longer in its history, since the publisher keeps a reference to these chunks.
+    ///
+    template <typename SubscriberPortType>
+    cxx::expected<void*, AllocationError> adopt(BaseSubscriber<SubscriberPortType>& subscriber,
+                                                const void* const userPayload) noexcept;
+
   protected:
     using BasePublisherType::port;
 };
@@ -56,6 +56,49 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+template <typename SubscriberPortType>
+inline cxx::expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::adopt(BaseSubscriber<SubscriberPortType>& subscriber,
+                                               const void* const userPayload) noexcept
+{
+    auto chunk = subscriber.port().releaseChunkToSharedChunk(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    if (chunk.has_error())
+    {
+        return cxx::error<AllocationError>((chunk.get_error() == ChunkReleaseResult::CHUNK_DELIVERED_INLINE)
+                                               ? AllocationError::CHUNK_DELIVERED_INLINE
+                                               : AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    auto result = port().tryAdoptChunk(std::move(chunk.value()));
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return cxx::success<void*>(result.value()->userPayload());
+    }
+}
+
+template <typename BasePublisherType>
+inline cxx::expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanSegment(void* const userPayload,
+                                                     const uint32_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment) noexcept
+{
+    auto result = port().tryAllocateSegment(
+        mepoo::ChunkHeader::fromUserPayload(userPayload), userPayloadSize, userPayloadAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    else
+    {
+        return cxx::success<void*>(result.value()->userPayload());
+    }
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
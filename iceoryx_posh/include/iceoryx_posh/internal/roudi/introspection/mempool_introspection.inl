@@ -111,9 +111,11 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
 
-            // User shm segments
-            for (auto& segment : m_segmentManager->m_segmentContainer)
+            // User shm segments, the overflow segments are created concurrently and only the published ones are sent
+            const auto numberOfSegments = m_segmentManager->getNumberOfSegments();
+            for (uint64_t i = 0U; i < numberOfSegments; ++i)
             {
+                auto& segment = m_segmentManager->m_segmentContainer[i];
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
@@ -124,8 +126,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                 else
                 {
                     LogWarn() << "Mempool Introspection Container full, Mempool Introspection Data not fully updated! "
-                              << (id + 1U) << " of " << m_segmentManager->m_segmentContainer.size()
-                              << " memory segments sent.";
+                              << (id + 1U) << " of " << numberOfSegments << " memory segments sent.";
                     errorHandler(PoshError::MEPOO__INTROSPECTION_CONTAINER_FULL, ErrorLevel::MODERATE);
                     break;
                 }
@@ -135,7 +136,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
         else
         {
             LogWarn() << "Mempool Introspection Container full, Mempool Introspection Data not fully updated! "
-                      << (id + 1U) << " of " << m_segmentManager->m_segmentContainer.size() << " memory segments sent.";
+                      << (id + 1U) << " of " << m_segmentManager->getNumberOfSegments() << " memory segments sent.";
             errorHandler(PoshError::MEPOO__INTROSPECTION_CONTAINER_FULL, ErrorLevel::MODERATE);
         }
 
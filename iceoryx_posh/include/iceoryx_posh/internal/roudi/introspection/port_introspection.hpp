@@ -181,6 +181,8 @@ class PortIntrospection
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
+        void prepareTopic(SubscriberLatencyIntrospectionFieldTopic& topic) noexcept;
+
         /// @brief compute the next connection state based on the current connection state and a capro message type when
         /// the communication policy is OneToMany
         /// @param[in] currentState current connection state (e.g. CONNECTED)
@@ -284,6 +286,12 @@ class PortIntrospection
                                PublisherPort&& publisherPortThroughput,
                                PublisherPort&& publisherPortSubscriberPortsData) noexcept;
 
+    /// @brief register the publisher port used to send the opt-in latency introspection, without it the latency
+    /// histograms of the subscribers are not published
+    /// @param[in] publisherPortSubscriberLatencies publisher port to be registered
+    /// @return true if registration was successful, false otherwise
+    bool registerLatencyPublisherPort(PublisherPort&& publisherPortSubscriberLatencies) noexcept;
+
     /// @brief set the time interval used to send new introspection data
     /// @param[in] interval duration between two send invocations
     void setSendInterval(const units::Duration interval) noexcept;
@@ -305,13 +313,18 @@ class PortIntrospection
     /// @brief sends the subscriberport changing data, this is used from the unittests
     void sendSubscriberPortsData() noexcept;
 
-    /// @brief calls the three specific send functions from above, this is used from the periodic task
+    /// @brief sends the subscriber latency data if the latency publisher port is registered, this is used from the
+    /// unittests
+    void sendSubscriberLatencyData() noexcept;
+
+    /// @brief calls the specific send functions from above, this is used from the periodic task
     void send() noexcept;
 
   protected:
     cxx::optional<PublisherPort> m_publisherPort;
     cxx::optional<PublisherPort> m_publisherPortThroughput;
     cxx::optional<PublisherPort> m_publisherPortSubscriberPortsData;
+    cxx::optional<PublisherPort> m_publisherPortSubscriberLatencies;
 
   private:
     PortData m_portData;
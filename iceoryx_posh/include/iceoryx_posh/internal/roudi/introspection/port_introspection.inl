@@ -71,6 +71,20 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
     return true;
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerLatencyPublisherPort(
+    PublisherPort&& publisherPortSubscriberLatencies) noexcept
+{
+    if (m_publisherPortSubscriberLatencies)
+    {
+        return false;
+    }
+
+    m_publisherPortSubscriberLatencies.emplace(std::move(publisherPortSubscriberLatencies));
+
+    return true;
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
 {
@@ -82,9 +96,14 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     sendPortData();
     sendThroughputData();
     sendSubscriberPortsData();
+    sendSubscriberLatencyData();
     m_publisherPort->offer();
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
+    if (m_publisherPortSubscriberLatencies)
+    {
+        m_publisherPortSubscriberLatencies->offer();
+    }
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -98,6 +117,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
     }
     sendThroughputData();
     sendSubscriberPortsData();
+    sendSubscriberLatencyData();
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -157,6 +177,31 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberLatencyData() noexcept
+{
+    if (!m_publisherPortSubscriberLatencies)
+    {
+        return;
+    }
+
+    auto maybeChunkHeader =
+        m_publisherPortSubscriberLatencies->tryAllocateChunk(sizeof(SubscriberLatencyIntrospectionFieldTopic),
+                                                             alignof(SubscriberLatencyIntrospectionFieldTopic),
+                                                             CHUNK_NO_USER_HEADER_SIZE,
+                                                             CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (!maybeChunkHeader.has_error())
+    {
+        auto subscriberLatencySample =
+            static_cast<SubscriberLatencyIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
+        new (subscriberLatencySample) SubscriberLatencyIntrospectionFieldTopic();
+
+        m_portData.prepareTopic(*subscriberLatencySample); // requires internal mutex (blocks
+        // further introspection events)
+        m_publisherPortSubscriberLatencies->sendChunk(maybeChunkHeader.value());
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(const units::Duration interval) noexcept
 {
@@ -622,6 +667,41 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    SubscriberLatencyIntrospectionFieldTopic& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            auto connectionIndex = pair.second;
+            if (connectionIndex >= 0)
+            {
+                auto& subscriberInfo = m_connectionContainer[connectionIndex].subscriberInfo;
+                SubscriberLatencyData latencyData;
+                if (subscriberInfo.portData != nullptr)
+                {
+                    const auto& latencyHistograms = subscriberInfo.portData->m_chunkReceiverData.m_latencyHistograms;
+                    for (uint32_t index = 0U; index < latencyHistograms.size(); ++index)
+                    {
+                        LatencyHistogramData histogramData;
+                        histogramData.publisherPortID = static_cast<uint64_t>(latencyHistograms.getOriginId(index));
+                        for (uint32_t bucket = 0U; bucket < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS; ++bucket)
+                        {
+                            histogramData.bucketCounts[bucket] = latencyHistograms.getBucketCount(index, bucket);
+                        }
+                        latencyData.latencyHistograms.push_back(histogramData);
+                    }
+                    latencyData.numberOfHistogramReassignments = latencyHistograms.getNumberOfReassignments();
+                }
+                topic.subscriberLatencyList.push_back(latencyData);
+            }
+        }
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::isNew() const noexcept
 {
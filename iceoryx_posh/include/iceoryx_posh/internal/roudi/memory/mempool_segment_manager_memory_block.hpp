@@ -59,10 +59,12 @@ class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
     void onMemoryAvailable(cxx::not_null<void*> memory) noexcept override;
 
     /// @copydoc MemoryBlock::destroy
-    /// @note This will clean up the SegmentManager
+    /// @note This will clean up the SegmentManager after the chunk size recordings of the segments are written
     void destroy() noexcept override;
 
   private:
+    void writeChunkSizeRecordings() const noexcept;
+
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::SegmentConfig m_segmentConfig;
 };
@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_PORT_MANAGER_HPP
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/scope_guard.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -52,11 +53,16 @@ namespace roudi
 {
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept;
 
+/// @brief The PortManager creates the ports and runs the discovery. The ports can be acquired concurrently to the
+/// discovery, only the discovery and the changes of the service registry are serialized by a mutex.
 class PortManager
 {
   public:
     using PortConfigInfo = iox::runtime::PortConfigInfo;
-    PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept;
+    /// @param[in] roudiMemoryInterface provides the port pool and the introspection memory
+    /// @param[in] latencyIntrospection offers the SubscriberLatencies port introspection topic, the introspection
+    ///            memory must provide a mempool for it
+    PortManager(RouDiMemoryInterface* roudiMemoryInterface, const bool latencyIntrospection = false) noexcept;
 
     virtual ~PortManager() noexcept = default;
 
@@ -130,6 +136,13 @@ class PortManager
 
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Defers the publication of the service registry until the returned guard goes out of scope, then the
+    /// service registry is published once if it was changed in the meantime. This is used to acquire a batch of ports
+    /// without copying the whole service registry into a chunk for every single port. When the batches of several
+    /// runtimes are acquired concurrently, the last guard which goes out of scope publishes the changes of all of them.
+    /// @return the guard which publishes the deferred service registry changes on destruction
+    cxx::ScopeGuard deferServiceRegistryPublication() noexcept;
+
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
@@ -168,6 +181,10 @@ class PortManager
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
+    /// @brief attaches InlineSlots from the pool to the subscriber if the publisher delivers its samples inline and
+    /// the subscriber has no slots yet, without slots the subscriber receives the samples as chunks
+    void attachInlineSlotsIfRequired(const PublisherPortRouDiType& publisher, SubscriberPortType& subscriber) noexcept;
+
     bool sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                          SubscriberPortType& subscriberSource) noexcept;
 
@@ -200,6 +217,9 @@ class PortManager
 
     void publishServiceRegistry() const noexcept;
 
+    /// @brief publishes the service registry or only records the change while the publication is deferred
+    void serviceRegistryChanged() noexcept;
+
     const ServiceRegistry& serviceRegistry() const noexcept;
 
   private:
@@ -209,6 +229,11 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     cxx::vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     cxx::optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    uint64_t m_numberOfServiceRegistryPublicationDeferrals{0U};
+    bool m_hasDeferredServiceRegistryChanges{false};
+    /// @brief serializes the discovery, the service registry and the removal of ports; the protected and private
+    /// methods expect that it is locked by the calling public method
+    std::mutex m_discoveryMutex;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
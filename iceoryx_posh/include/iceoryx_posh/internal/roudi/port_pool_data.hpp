@@ -21,11 +21,13 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/inline_slots.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/roudi/resource_index.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
 namespace iox
@@ -48,8 +50,46 @@ class FixedPositionContainer
 
     cxx::vector<T*, Capacity> content() noexcept;
 
-  private:
+    /// @brief Provides all elements which belong to the runtime without looking at the elements of other runtimes
+    /// @param[in] runtimeName of the runtime the elements belong to
+    /// @return the elements whose m_runtimeName equals runtimeName
+    cxx::vector<T*, Capacity> contentOf(const RuntimeName_t& runtimeName) noexcept;
+
+  protected:
+    uint64_t positionOf(const T* const element) const noexcept;
+
+  protected:
+    static constexpr uint64_t INVALID_POSITION{Capacity};
+
     cxx::vector<cxx::optional<T>, Capacity> m_data;
+
+  private:
+    ResourceIndex<Capacity, MAX_PROCESS_NUMBER> m_runtimeIndex;
+    /// @brief all positions before it are occupied, the search for a free position starts here so that a batch of
+    /// insertions passes over the occupied positions only once
+    uint64_t m_firstFreePositionCandidate{0U};
+};
+
+/// @brief FixedPositionContainer for ports which additionally groups the ports by their service description. This
+///        allows the PortManager to find the matching ports for a CaPro message without looking at every port.
+template <typename T, uint64_t Capacity>
+class PortContainer : public FixedPositionContainer<T, Capacity>
+{
+  public:
+    template <typename... Targs>
+    T* insert(Targs&&... args) noexcept;
+
+    void erase(const T* const element) noexcept;
+
+    using FixedPositionContainer<T, Capacity>::contentOf;
+
+    /// @brief Provides all ports with the service description without looking at the ports of other services
+    /// @param[in] serviceDescription of the ports
+    /// @return the ports whose m_serviceDescription equals serviceDescription
+    cxx::vector<T*, Capacity> contentOf(const capro::ServiceDescription& serviceDescription) noexcept;
+
+  private:
+    ResourceIndex<Capacity, Capacity> m_serviceIndex;
 };
 
 struct PortPoolData
@@ -57,12 +97,13 @@ struct PortPoolData
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
     FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
+    FixedPositionContainer<popo::InlineSlots, MAX_SUBSCRIBERS_WITH_INLINE_SLOTS> m_inlineSlotsMembers;
 
-    FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
-    FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    PortContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
+    PortContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
 
-    FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
-    FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+    PortContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
+    PortContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
 };
 
 } // namespace roudi
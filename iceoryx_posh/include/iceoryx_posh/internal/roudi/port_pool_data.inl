@@ -22,6 +22,9 @@ namespace iox
 {
 namespace roudi
 {
+template <typename T, uint64_t Capacity>
+constexpr uint64_t FixedPositionContainer<T, Capacity>::INVALID_POSITION;
+
 template <typename T, uint64_t Capacity>
 bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
 {
@@ -30,9 +33,9 @@ bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
         return true;
     }
 
-    for (auto& e : m_data)
+    for (uint64_t position = m_firstFreePositionCandidate; position < m_data.size(); ++position)
     {
-        if (!e.has_value())
+        if (!m_data[position].has_value())
         {
             return true;
         }
@@ -45,30 +48,65 @@ template <typename T, uint64_t Capacity>
 template <typename... Targs>
 T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args) noexcept
 {
-    for (auto& e : m_data)
+    for (uint64_t position = m_firstFreePositionCandidate; position < m_data.size(); ++position)
     {
+        auto& e = m_data[position];
         if (!e.has_value())
         {
             e.emplace(std::forward<Targs>(args)...);
+            m_runtimeIndex.insert(hashOf(e.value().m_runtimeName), position);
+            m_firstFreePositionCandidate = position + 1U;
             return &e.value();
         }
     }
 
     m_data.emplace_back();
     m_data.back().emplace(std::forward<Targs>(args)...);
+    m_runtimeIndex.insert(hashOf(m_data.back().value().m_runtimeName), m_data.size() - 1U);
+    m_firstFreePositionCandidate = m_data.size();
     return &m_data.back().value();
 }
 
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::positionOf(const T* const element) const noexcept
+{
+    if (m_data.empty() || element == nullptr)
+    {
+        return INVALID_POSITION;
+    }
+
+    // the elements are stored in a contiguous array of optionals, therefore the position can be derived from the
+    // distance to the first optional; the check below rejects pointers which do not point to a stored element
+    const auto first = reinterpret_cast<uintptr_t>(&m_data[0]);
+    const auto address = reinterpret_cast<uintptr_t>(element);
+    if (address < first)
+    {
+        return INVALID_POSITION;
+    }
+
+    const uint64_t position = (address - first) / sizeof(cxx::optional<T>);
+    if (position >= m_data.size() || !m_data[position].has_value() || &m_data[position].value() != element)
+    {
+        return INVALID_POSITION;
+    }
+
+    return position;
+}
+
 template <typename T, uint64_t Capacity>
 void FixedPositionContainer<T, Capacity>::erase(const T* const element) noexcept
 {
-    for (auto& e : m_data)
+    const auto position = positionOf(element);
+    if (position == INVALID_POSITION)
     {
-        if (e.has_value() && &e.value() == element)
-        {
-            e.reset();
-            return;
-        }
+        return;
+    }
+
+    m_runtimeIndex.erase(position);
+    m_data[position].reset();
+    if (position < m_firstFreePositionCandidate)
+    {
+        m_firstFreePositionCandidate = position;
     }
 }
 
@@ -86,6 +124,57 @@ cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcep
     return returnValue;
 }
 
+template <typename T, uint64_t Capacity>
+cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::contentOf(const RuntimeName_t& runtimeName) noexcept
+{
+    cxx::vector<T*, Capacity> returnValue;
+    m_runtimeIndex.forEachCandidate(hashOf(runtimeName), [&](const uint64_t position) {
+        auto& e = m_data[position];
+        if (e.has_value() && e.value().m_runtimeName == runtimeName)
+        {
+            returnValue.emplace_back(&e.value());
+        }
+    });
+    return returnValue;
+}
+
+template <typename T, uint64_t Capacity>
+template <typename... Targs>
+T* PortContainer<T, Capacity>::insert(Targs&&... args) noexcept
+{
+    auto element = FixedPositionContainer<T, Capacity>::insert(std::forward<Targs>(args)...);
+    m_serviceIndex.insert(hashOf(element->m_serviceDescription), this->positionOf(element));
+    return element;
+}
+
+template <typename T, uint64_t Capacity>
+void PortContainer<T, Capacity>::erase(const T* const element) noexcept
+{
+    const auto position = this->positionOf(element);
+    if (position == FixedPositionContainer<T, Capacity>::INVALID_POSITION)
+    {
+        return;
+    }
+
+    m_serviceIndex.erase(position);
+    FixedPositionContainer<T, Capacity>::erase(element);
+}
+
+template <typename T, uint64_t Capacity>
+cxx::vector<T*, Capacity>
+PortContainer<T, Capacity>::contentOf(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    cxx::vector<T*, Capacity> returnValue;
+    m_serviceIndex.forEachCandidate(hashOf(serviceDescription), [&](const uint64_t position) {
+        auto& e = this->m_data[position];
+        if (e.has_value() && e.value().m_serviceDescription == serviceDescription)
+        {
+            returnValue.emplace_back(&e.value());
+        }
+    });
+    return returnValue;
+}
+
 } // namespace roudi
 } // namespace iox
 
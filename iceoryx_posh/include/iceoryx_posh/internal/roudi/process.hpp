@@ -60,6 +60,11 @@ class Process
 
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
+    /// @brief sends the message together with a file descriptor which is duplicated into the process
+    /// @param[in] data the message to send
+    /// @param[in] fileDescriptor to transfer, it stays open in RouDi
+    void sendViaIpcChannelWithFileDescriptor(const runtime::IpcMessage& data, const int32_t fileDescriptor) noexcept;
+
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
@@ -72,6 +77,15 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    /// @brief The process reports the number of segments it mapped, RouDi hands out the chunks of an overflow
+    /// segment only after all processes mapped it
+    /// @param[in] numberOfMappedSegments is the number of segments announced by RouDi which the process mapped
+    void setNumberOfMappedSegments(const uint64_t numberOfMappedSegments) noexcept;
+
+    /// @brief The number of segments announced by RouDi which the process mapped
+    /// @return the number of mapped segments
+    uint64_t getNumberOfMappedSegments() const noexcept;
+
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
@@ -79,6 +93,7 @@ class Process
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    uint64_t m_numberOfMappedSegments{0U};
 };
 
 } // namespace roudi
@@ -25,11 +25,13 @@
 #include "iceoryx_posh/internal/roudi/process.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
 #include <cstdint>
 #include <ctime>
+#include <shared_mutex>
 
 namespace iox
 {
@@ -43,6 +45,8 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief The ProcessManager handles the requests of the registered processes. The requests of different processes can
+/// be handled concurrently, only the registration and the removal of processes are exclusive.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -105,6 +109,15 @@ class ProcessManager : public ProcessManagerInterface
 
     void updateLivelinessOfProcess(const RuntimeName_t& name) noexcept;
 
+    /// @brief A process mapped the segments which were announced by the segment manager
+    /// @param [in] name of the process runtime which mapped the segments
+    /// @param [in] numberOfMappedSegments is the number of announced segments the process mapped
+    void updateMappedSegmentsOfProcess(const RuntimeName_t& name, const uint64_t numberOfMappedSegments) noexcept;
+
+    /// @brief Links the announced overflow segments which are mapped by all registered processes to the memory
+    /// managers, i.e. the publishers start to use them
+    void linkOverflowSegmentsMappedByAllProcesses() noexcept;
+
     void
     addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces interface, const NodeName_t& node) noexcept;
 
@@ -115,6 +128,12 @@ class ProcessManager : public ProcessManagerInterface
                                  const popo::SubscriberOptions& subscriberOptions,
                                  const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
+    /// @brief creates the publisher and subscriber ports of a batched port request and sends the outcome of all
+    /// requests with a single CREATE_PORTS_ACK to the process
+    /// @param[in] name of the process which requested the ports
+    /// @param[in] requests the publisher and subscriber ports to create
+    void addPortsForProcess(const RuntimeName_t& name, const runtime::PortRequestContainer& requests) noexcept;
+
     void addPublisherForProcess(const RuntimeName_t& name,
                                 const capro::ServiceDescription& service,
                                 const popo::PublisherOptions& publisherOptions,
@@ -157,6 +176,8 @@ class ProcessManager : public ProcessManagerInterface
 
 
   private:
+    static runtime::IpcMessageErrorType toPublisherIpcMessageErrorType(const PortPoolError error) noexcept;
+
     cxx::optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
     void monitorProcesses() noexcept;
@@ -227,6 +248,10 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     memory::segment_id_underlying_t m_mgmtSegmentId{memory::UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
+    /// @brief is locked exclusively when processes are added or removed and shared when the requests of a registered
+    /// process are handled; the requests of a single process are never handled concurrently, therefore the shared lock
+    /// suffices to change the state of this process
+    std::shared_timed_mutex m_processListMutex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
 };
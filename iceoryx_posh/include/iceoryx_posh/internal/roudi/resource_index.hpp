@@ -0,0 +1,86 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_RESOURCE_INDEX_HPP
+#define IOX_POSH_ROUDI_RESOURCE_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Calculates the hash which is used to group resources by the runtime they belong to
+/// @param[in] runtimeName of the runtime
+/// @return the hash of the runtime name
+uint64_t hashOf(const RuntimeName_t& runtimeName) noexcept;
+
+/// @brief Provides the hash which is used to group ports by their service description
+/// @param[in] serviceDescription of the port
+/// @return the precalculated hash of the service description, see capro::ServiceDescription::getHash
+uint64_t hashOf(const capro::ServiceDescription& serviceDescription) noexcept;
+
+/// @brief Groups the positions of the resources in a FixedPositionContainer by a key, e.g. the runtime or the service
+///        the resources belong to. Each position is linked into an intrusive list which is selected by the hash of the
+///        key. This allows to find the resources for a key without looking at every resource in the container. Since
+///        keys with the same hash share a list, the key of a returned resource must still be checked by the caller.
+/// @tparam Capacity is the capacity of the FixedPositionContainer
+/// @tparam NumberOfLists is the number of intrusive lists the positions are distributed to
+template <uint64_t Capacity, uint64_t NumberOfLists>
+class ResourceIndex
+{
+    static_assert(Capacity > 0, "ResourceIndex Capacity must be larger than 0!");
+    static_assert(NumberOfLists > 0, "ResourceIndex NumberOfLists must be larger than 0!");
+
+  public:
+    /// @brief Constructs an empty ResourceIndex
+    ResourceIndex() noexcept;
+
+    /// @brief Adds the resource at the given position to the list of the key, the list is kept in ascending order of
+    /// the positions
+    /// @param[in] keyHash the hash of the key the resource belongs to, see hashOf
+    /// @param[in] position of the resource in the FixedPositionContainer
+    /// @note the position must not be in the index already
+    void insert(const uint64_t keyHash, const uint64_t position) noexcept;
+
+    /// @brief Removes the resource at the given position from the index
+    /// @param[in] position of the resource in the FixedPositionContainer
+    void erase(const uint64_t position) noexcept;
+
+    /// @brief Calls the callable with the positions of all resources which might belong to the key
+    /// @param[in] keyHash the hash of the key to look for, see hashOf
+    /// @param[in] callable is called with the position of every resource in the list of the key in ascending order,
+    /// these are all resources of the key but might also be resources of other keys which share the list
+    template <typename Callable>
+    void forEachCandidate(const uint64_t keyHash, const Callable& callable) const noexcept;
+
+  private:
+    static constexpr uint64_t INVALID_POSITION{Capacity};
+
+    uint64_t m_listHeads[NumberOfLists];
+    uint64_t m_next[Capacity];
+    uint64_t m_previous[Capacity];
+    uint64_t m_listIndices[Capacity];
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/resource_index.inl"
+
+#endif // IOX_POSH_ROUDI_RESOURCE_INDEX_HPP
@@ -0,0 +1,125 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_RESOURCE_INDEX_INL
+#define IOX_POSH_ROUDI_RESOURCE_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/resource_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <uint64_t Capacity, uint64_t NumberOfLists>
+constexpr uint64_t ResourceIndex<Capacity, NumberOfLists>::INVALID_POSITION;
+
+template <uint64_t Capacity, uint64_t NumberOfLists>
+inline ResourceIndex<Capacity, NumberOfLists>::ResourceIndex() noexcept
+{
+    for (uint64_t i = 0U; i < NumberOfLists; ++i)
+    {
+        m_listHeads[i] = INVALID_POSITION;
+    }
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        m_next[i] = INVALID_POSITION;
+        m_previous[i] = INVALID_POSITION;
+        m_listIndices[i] = NumberOfLists;
+    }
+}
+
+template <uint64_t Capacity, uint64_t NumberOfLists>
+inline void ResourceIndex<Capacity, NumberOfLists>::insert(const uint64_t keyHash, const uint64_t position) noexcept
+{
+    if (position >= Capacity || m_listIndices[position] != NumberOfLists)
+    {
+        return;
+    }
+
+    const auto listIndex = keyHash % NumberOfLists;
+
+    // the list is kept in ascending order so that the lookups, which are more frequent than the insertions, provide
+    // the resources in the order of the container without sorting them
+    auto previous = INVALID_POSITION;
+    auto next = m_listHeads[listIndex];
+    while (next != INVALID_POSITION && next < position)
+    {
+        previous = next;
+        next = m_next[next];
+    }
+
+    m_listIndices[position] = listIndex;
+    m_previous[position] = previous;
+    m_next[position] = next;
+    if (next != INVALID_POSITION)
+    {
+        m_previous[next] = position;
+    }
+    if (previous != INVALID_POSITION)
+    {
+        m_next[previous] = position;
+    }
+    else
+    {
+        m_listHeads[listIndex] = position;
+    }
+}
+
+template <uint64_t Capacity, uint64_t NumberOfLists>
+inline void ResourceIndex<Capacity, NumberOfLists>::erase(const uint64_t position) noexcept
+{
+    if (position >= Capacity || m_listIndices[position] == NumberOfLists)
+    {
+        return;
+    }
+
+    const auto next = m_next[position];
+    const auto previous = m_previous[position];
+
+    if (previous != INVALID_POSITION)
+    {
+        m_next[previous] = next;
+    }
+    else
+    {
+        m_listHeads[m_listIndices[position]] = next;
+    }
+
+    if (next != INVALID_POSITION)
+    {
+        m_previous[next] = previous;
+    }
+
+    m_next[position] = INVALID_POSITION;
+    m_previous[position] = INVALID_POSITION;
+    m_listIndices[position] = NumberOfLists;
+}
+
+template <uint64_t Capacity, uint64_t NumberOfLists>
+template <typename Callable>
+inline void ResourceIndex<Capacity, NumberOfLists>::forEachCandidate(const uint64_t keyHash,
+                                                                     const Callable& callable) const noexcept
+{
+    for (auto position = m_listHeads[keyHash % NumberOfLists]; position != INVALID_POSITION;
+         position = m_next[position])
+    {
+        callable(position);
+    }
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RESOURCE_INDEX_INL
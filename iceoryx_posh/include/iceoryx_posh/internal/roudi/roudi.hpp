@@ -17,8 +17,9 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
+#include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/cxx/scope_guard.hpp"
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
@@ -30,7 +31,9 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -57,12 +60,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t runtimeMessageWorkers = roudi::DEFAULT_RUNTIME_MESSAGE_WORKERS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_runtimeMessageWorkers(runtimeMessageWorkers)
         {
         }
 
@@ -71,6 +76,9 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief number of threads processing the messages from the runtimes; the messages of a specific runtime
+        /// are always processed by the same thread to preserve their order
+        const uint32_t m_runtimeMessageWorkers;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -122,14 +130,32 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief The messages of the runtimes which are assigned to a worker thread
+    struct RuntimeMessageWorker
+    {
+        std::mutex m_mutex;
+        std::condition_variable m_messagesChanged;
+        cxx::list<runtime::IpcMessage, RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY> m_messages;
+        std::thread m_thread;
+    };
+
     void processRuntimeMessages() noexcept;
 
+    void handleRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
+    void dispatchRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
+    void processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept;
+
+    void stopRuntimeMessageWorkers() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     cxx::ScopeGuard m_unregisterRelativePtr{[] { memory::UntypedRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
+    std::atomic_bool m_runRuntimeMessageWorkers{true};
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
 
@@ -145,11 +171,13 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @brief locks internally, the requests of different runtimes are handled concurrently
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    cxx::vector<RuntimeMessageWorker, MAX_RUNTIME_MESSAGE_WORKERS> m_runtimeMessageWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -19,6 +19,7 @@
 #define IOX_POSH_RUNTIME_IPC_INTERFACE_BASE_HPP
 
 #include "iceoryx_hoofs/cxx/deadline_timer.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_platform/errno.hpp"
@@ -85,6 +86,9 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    SEGMENTS_MAPPED,
+    CREATE_PORTS,
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -185,6 +189,27 @@ class IpcInterface
     ///             otherwise if the message was invalid it will return false.
     bool timedSend(const IpcMessage& msg, const units::Duration timeout) const noexcept;
 
+    /// @brief Tries to send the message specified in msg together with a file descriptor which is duplicated into
+    ///         the receiving process.
+    /// @param[in] msg Must be a valid message, if its an invalid message
+    ///                 send will return false
+    /// @param[in] fileDescriptor to transfer, it stays open in the sending process
+    /// @return If a valid message was send it returns true, otherwise false. Only unix domain sockets can transfer
+    ///             file descriptors, the other IPC channels always return false.
+    bool sendWithFileDescriptor(const IpcMessage& msg, const int32_t fileDescriptor) const noexcept;
+
+    /// @brief Tries to receive a message and a file descriptor which was sent with it within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[in] answer The answer of the IPC channel. If the receive
+    ///         failed the content of answer is undefined.
+    /// @param[out] fileDescriptor the received file descriptor, cxx::nullopt if the message carries none; the
+    ///         caller owns it and has to close it. The IPC channels besides unix domain sockets never carry one.
+    /// @return If a valid message was received before the timeout occures
+    ///             it returns true, otherwise false.
+    bool timedReceiveWithFileDescriptor(const units::Duration timeout,
+                                        IpcMessage& answer,
+                                        cxx::optional<int32_t>& fileDescriptor) const noexcept;
+
     /// @brief Returns the interface name, the unique char string which
     ///         explicitly identifies the IPC channel.
     /// @return name of the IPC channel
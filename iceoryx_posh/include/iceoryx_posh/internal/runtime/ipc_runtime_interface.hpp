@@ -36,7 +36,8 @@ class IpcRuntimeInterface
     IpcRuntimeInterface(const RuntimeName_t& roudiName,
                         const RuntimeName_t& runtimeName,
                         const units::Duration roudiWaitingTimeout) noexcept;
-    ~IpcRuntimeInterface() noexcept = default;
+    /// @brief closes the file descriptor of the management memory which RouDi passed with the REG_ACK
+    ~IpcRuntimeInterface() noexcept;
 
     /// @brief Not needed therefore deleted
     IpcRuntimeInterface(const IpcRuntimeInterface&) = delete;
@@ -48,6 +49,11 @@ class IpcRuntimeInterface
     /// @return true if sending was successful, false if not
     bool sendKeepalive() noexcept;
 
+    /// @brief informs the RouDi daemon about the number of announced segments the application has mapped
+    /// @param[in] numberOfMappedSegments is the number of announced segments which are mapped
+    /// @return true if sending was successful, false if not
+    bool sendMappedSegments(const uint64_t numberOfMappedSegments) noexcept;
+
     /// @brief send a request to the RouDi daemon
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
@@ -66,6 +72,11 @@ class IpcRuntimeInterface
     /// @return segment id
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief get the file descriptor of the management memory which RouDi passed with the REG_ACK
+    /// @return the file descriptor which stays owned by the IpcRuntimeInterface or cxx::nullopt if the management
+    /// memory has to be opened by its name
+    cxx::optional<int32_t> getMgmtMemoryFileDescriptor() const noexcept;
+
   private:
     enum class RegAckResult
     {
@@ -76,6 +87,7 @@ class IpcRuntimeInterface
     void waitForRoudi(cxx::DeadlineTimer& timer) noexcept;
 
     RegAckResult waitForRegAck(const int64_t transmissionTimestamp) noexcept;
+    static void closeFileDescriptor(const cxx::optional<int32_t>& fileDescriptor) noexcept;
 
   private:
     RuntimeName_t m_runtimeName;
@@ -84,6 +96,7 @@ class IpcRuntimeInterface
     IpcInterfaceUser m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
+    cxx::optional<int32_t> m_mgmtMemoryFileDescriptor;
     bool m_sendKeepalive = true;
 };
 
@@ -55,6 +55,9 @@ class PoshRuntimeImpl : public PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    PortRequestResultContainer createPorts(const PortRequestContainer& requests) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareClient
     popo::ClientPortUser::MemberType_t*
     getMiddlewareClient(const capro::ServiceDescription& service,
@@ -95,6 +98,22 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
     requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    void requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                               const PortRequest* const requests,
+                               const uint64_t numberOfRequests,
+                               PortRequestResultContainer& results) noexcept;
+
+    popo::PublisherOptions limitPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+
+    popo::SubscriberOptions limitSubscriberOptions(const capro::ServiceDescription& service,
+                                                   const popo::SubscriberOptions& subscriberOptions) const noexcept;
+
+    void handlePublisherRequestError(const capro::ServiceDescription& service,
+                                     const IpcMessageErrorType error) const noexcept;
+
+    void handleSubscriberRequestError(const capro::ServiceDescription& service,
+                                      const IpcMessageErrorType error) const noexcept;
+
     cxx::expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
     requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
@@ -109,6 +128,9 @@ class PoshRuntimeImpl : public PoshRuntime
     IpcRuntimeInterface m_ipcChannelInterface;
     cxx::optional<SharedMemoryUser> m_ShmInterface;
 
+    /// @brief only accessed by the keep alive task
+    uint64_t m_numberOfReportedSegments{0U};
+
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
 
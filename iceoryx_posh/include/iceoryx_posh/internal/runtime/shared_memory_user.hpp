@@ -22,32 +22,60 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
-
+#include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
 namespace iox
 {
 namespace runtime
 {
-/// @brief shared memory setup for the management segment user side
+/// @brief shared memory setup for the management segment user side; the payload segments which RouDi creates after
+/// the registration, i.e. the overflow segments, are mapped with mapAnnouncedSegments
 class SharedMemoryUser
 {
   public:
+    /// @brief when this environment variable is set to "on" the application prefaults all payload segments when it
+    /// maps them, independent of the prefault option of the segment in the RouDi config
+    static constexpr const char PREFAULT_SEGMENTS_ENV_VARIABLE[] = "IOX_PREFAULT_SEGMENTS";
+    /// @brief when this environment variable is set to "on" the application locks all payload segments into RAM when
+    /// it maps them, independent of the lock-memory option of the segment in the RouDi config
+    static constexpr const char LOCK_SEGMENTS_ENV_VARIABLE[] = "IOX_LOCK_SEGMENTS";
+
     /// @brief Constructor
     /// @param[in] topicSize size of the shared memory management segment
     /// @param[in] segmentManagerAddr adress of the segment manager that does the final mapping of memory in the process
     /// @param[in] segmentId of the relocatable shared memory segment
     /// address space
+    /// @param[in] mgmtMemoryFileDescriptor the file descriptor of the management segment which RouDi passed with the
+    /// registration acknowledgement, the management segment is opened by its name when it is cxx::nullopt
     SharedMemoryUser(const size_t topicSize,
                      const uint64_t segmentId,
-                     const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+                     const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                     const cxx::optional<int32_t>& mgmtMemoryFileDescriptor = cxx::nullopt) noexcept;
+
+    /// @brief Maps the segments which RouDi announced since the last call, i.e. the overflow segments. RouDi hands
+    /// out the chunks of an announced segment only after all applications reported that they mapped it.
+    /// @note this must not be called concurrently, the runtime calls it from its keep alive thread
+    /// @return the number of segments which RouDi announced so far and which are therefore mapped
+    uint64_t mapAnnouncedSegments() noexcept;
 
   private:
+    void registerMgmtSegment(void* const baseAddress,
+                             const uint64_t size,
+                             const uint64_t segmentId,
+                             const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
     void openDataSegments(const uint64_t segmentId,
                           const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+    void openDataSegment(const mepoo::SegmentManager<>::SegmentMapping& segment) noexcept;
 
   private:
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
+    cxx::optional<posix::MemoryMap> m_mgmtMemoryMap;
     cxx::vector<posix::SharedMemoryObject, MAX_SHM_SEGMENTS> m_dataShmObjects;
+    cxx::vector<uint64_t, MAX_SHM_SEGMENTS> m_dataSegmentIds;
+    mepoo::SegmentManager<>* m_segmentManager{nullptr};
+    uint64_t m_numberOfAnnouncedSegments{0U};
+    bool m_prefaultSegments{false};
+    bool m_lockSegments{false};
     static constexpr cxx::perms SHM_SEGMENT_PERMISSIONS =
         cxx::perms::owner_read | cxx::perms::owner_write | cxx::perms::group_read | cxx::perms::group_write;
 };
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_MEPOO_CHUNK_HEADER_HPP
 #define IOX_POSH_MEPOO_CHUNK_HEADER_HPP
 
+#include "iceoryx_hoofs/internal/memory/relative_pointer_data.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
@@ -33,6 +34,8 @@ class ChunkSender;
 
 namespace mepoo
 {
+class SharedChunk;
+
 /// @brief Helper struct to use as default template parameter when no user-header is used
 struct NoUserHeader
 {
@@ -59,7 +62,7 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{2U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -74,6 +77,12 @@ struct ChunkHeader
     /// @return the user-header id of the chunk
     uint16_t userHeaderId() const noexcept;
 
+    /// @brief Identifies the user-header of the chunk as one with a well known layout, e.g. the ConflationKeyHeader, so
+    /// that it can be interpreted by the receivers
+    /// @param[in] userHeaderId the id of the user-header, it is ignored when the chunk has no user-header or when it
+    /// is NO_USER_HEADER
+    void setUserHeaderId(const uint16_t userHeaderId) noexcept;
+
     /// @brief Get the pointer to the user-header
     /// @return the pointer to the user-header
     void* userHeader() noexcept;
@@ -138,14 +147,32 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time the chunk was sent in nanoseconds of the monotonic mepoo::BaseClock_t, which is comparable
+    /// between the processes of a system
+    /// @return the publish timestamp of the chunk or 0 if the chunk was not sent yet
+    uint64_t publishTimestamp() const noexcept;
+
+    /// @brief Get a pointer to the `ChunkHeader` of the next segment of a multi-chunk message
+    /// @return the pointer to the `ChunkHeader` of the next segment or a `nullptr` if this is the last segment
+    ChunkHeader* nextSegment() noexcept;
+
+    /// @brief Get a const pointer to the `ChunkHeader` of the next segment of a multi-chunk message
+    /// @return the const pointer to the `ChunkHeader` of the next segment or a `nullptr` if this is the last segment
+    const ChunkHeader* nextSegment() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
+    friend class SharedChunk;
 
     void setOriginId(const popo::UniquePortId originId) noexcept;
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setPublishTimestamp(const uint64_t publishTimestamp) noexcept;
+
+    void setNextSegment(ChunkHeader* const nextSegment) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -163,6 +190,10 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
     uint64_t m_sequenceNumber{0U};
+    uint64_t m_publishTimestamp{0U};
+    // the segments of a multi-chunk message are chained by a relative pointer which is stored as RelativePointerData
+    // to occupy only 8 bytes; the ownership of the segments is tracked by their ChunkManagement
+    memory::RelativePointerData m_nextSegment;
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
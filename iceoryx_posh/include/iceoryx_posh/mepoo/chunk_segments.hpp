@@ -0,0 +1,82 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_SEGMENTS_HPP
+#define IOX_POSH_MEPOO_CHUNK_SEGMENTS_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Range over the segments of a multi-chunk message which can be used in a range-based for loop. The first
+/// segment is the chunk which was published, the further segments were added with loanSegment of the publisher.
+/// @code
+/// subscriber.take().and_then([](const void* userPayload) {
+///     for (const auto& segment : iox::mepoo::ChunkSegments::fromUserPayload(userPayload))
+///     {
+///         process(segment.userPayload(), segment.userPayloadSize());
+///     }
+/// });
+/// @endcode
+class ChunkSegments
+{
+  public:
+    class Iterator
+    {
+      public:
+        explicit Iterator(const ChunkHeader* const chunkHeader) noexcept;
+
+        const ChunkHeader& operator*() const noexcept;
+        const ChunkHeader* operator->() const noexcept;
+
+        Iterator& operator++() noexcept;
+
+        bool operator==(const Iterator& rhs) const noexcept;
+        bool operator!=(const Iterator& rhs) const noexcept;
+
+      private:
+        const ChunkHeader* m_chunkHeader{nullptr};
+    };
+
+    /// @brief creates the range over the segments of a message
+    /// @param[in] chunkHeader of the first segment of the message, a nullptr results in an empty range
+    explicit ChunkSegments(const ChunkHeader* const chunkHeader) noexcept;
+
+    /// @brief creates the range over the segments of a message
+    /// @param[in] userPayload of the first segment of the message, a nullptr results in an empty range
+    static ChunkSegments fromUserPayload(const void* const userPayload) noexcept;
+
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept;
+
+    /// @brief returns the number of segments of the message
+    uint64_t size() const noexcept;
+
+    /// @brief returns the sum of the user-payload sizes of all segments of the message
+    uint64_t userPayloadSize() const noexcept;
+
+  private:
+    const ChunkHeader* m_chunkHeader{nullptr};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_SEGMENTS_HPP
@@ -16,6 +16,7 @@
 #ifndef IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 #define IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
@@ -35,17 +36,42 @@ struct MePooConfig
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint32_t f_size, uint32_t f_chunkCount) noexcept
+        Entry(uint32_t f_size,
+              uint32_t f_chunkCount,
+              MemPoolReservation_t f_reservation = NO_MEMPOOL_RESERVATION) noexcept
             : m_size(f_size)
             , m_chunkCount(f_chunkCount)
+            , m_reservation(f_reservation)
         {
         }
         uint32_t m_size{0};
         uint32_t m_chunkCount{0};
+        /// @brief the mempool is used exclusively by the ports which request this reservation
+        MemPoolReservation_t m_reservation{NO_MEMPOOL_RESERVATION};
+    };
+
+    /// @brief Configuration of a BuddyMemPool which provides variable-size chunks from a single arena
+    struct BuddyMemPoolEntry
+    {
+        static constexpr uint32_t DEFAULT_MIN_CHUNK_SIZE{256U};
+
+        BuddyMemPoolEntry(uint64_t f_size, uint32_t f_minChunkSize = DEFAULT_MIN_CHUNK_SIZE) noexcept
+            : m_size(f_size)
+            , m_minChunkSize(f_minChunkSize)
+        {
+        }
+        uint64_t m_size{0};
+        /// @brief the size of the smallest chunk, must be a power of two
+        uint32_t m_minChunkSize{0};
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    /// @brief the buddy mempool serves all chunks without mempool reservation which do not fit into a mempool
+    cxx::optional<BuddyMemPoolEntry> m_buddyMemPoolConfig;
+    /// @brief records the requested chunk sizes as input for the mempool sizing advisor, this costs a few atomic
+    /// operations per chunk and is therefore disabled by default
+    bool m_recordChunkSizes{false};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -58,6 +84,11 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry f_entry) noexcept;
 
+    /// @brief Adds a buddy mempool with variable-size chunks, a segment without mempools provides then only
+    /// variable-size chunks
+    /// @param[in] entry the configuration of the buddy mempool
+    void setBuddyMemPool(const BuddyMemPoolEntry& entry) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
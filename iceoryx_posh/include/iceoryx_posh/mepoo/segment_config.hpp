@@ -19,6 +19,8 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/cxx/string.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -27,6 +29,36 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief Places a segment in a file instead of a POSIX shared memory object, e.g. on a tmpfs, hugetlbfs or
+/// DAX-capable filesystem. The file is not removed when RouDi shuts down, therefore the content of the segment is
+/// available for a post-mortem analysis and RouDi reuses it without zeroing it on the next start.
+struct SegmentFile
+{
+    using Path_t = cxx::string<platform::IOX_MAX_PATH_LENGTH>;
+
+    Path_t m_path;
+    /// @brief size of the file, 0 means that the size required by the mempools is used. A larger size is required
+    /// when the filesystem only supports multiples of a specific size, e.g. the huge page size on hugetlbfs
+    uint64_t m_size{0U};
+    /// @brief map the file with MAP_SYNC so that the changes on a DAX-capable filesystem are durable without an
+    /// explicit msync
+    bool m_synchronousMapping{false};
+};
+
+/// @brief Lets RouDi add overflow segments at runtime when the chunks of a segment run out. An overflow segment has
+/// the same mempools as the segment it extends and is used by the publishers when the mempools of the segments
+/// before it are out of chunks. The applications map an overflow segment when they access its first chunk.
+struct SegmentOverflow
+{
+    static constexpr uint32_t DEFAULT_THRESHOLD_PERCENT{80U};
+
+    /// @brief maximum number of overflow segments, 0 disables the overflow
+    uint32_t m_maxSegments{0U};
+    /// @brief usage of the most used mempool of the last segment in percent at which the next overflow segment is
+    /// created
+    uint32_t m_thresholdPercent{DEFAULT_THRESHOLD_PERCENT};
+};
+
 struct SegmentConfig
 {
     struct SegmentEntry
@@ -34,12 +66,23 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const bool useHugePages = false,
+                     const bool prefault = false,
+                     const bool lockMemory = false,
+                     const cxx::optional<SegmentFile>& file = cxx::nullopt,
+                     const SegmentOverflow& overflow = SegmentOverflow(),
+                     const cxx::optional<SegmentFile::Path_t>& chunkSizeRecordingFile = cxx::nullopt) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
-
+            , m_useHugePages(useHugePages)
+            , m_prefault(prefault)
+            , m_lockMemory(lockMemory)
+            , m_file(file)
+            , m_overflow(overflow)
+            , m_chunkSizeRecordingFile(chunkSizeRecordingFile)
         {
         }
 
@@ -47,6 +90,20 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief back the segment with huge pages if they are available, otherwise regular pages are used
+        bool m_useHugePages{false};
+        /// @brief touch every page of the segment in RouDi and in the applications when it is mapped so that the
+        /// first access to a chunk does not cause a page fault
+        bool m_prefault{false};
+        /// @brief lock the segment into RAM in RouDi and in the applications so that it is never paged out
+        bool m_lockMemory{false};
+        /// @brief place the segment in a file instead of a POSIX shared memory object
+        cxx::optional<SegmentFile> m_file;
+        /// @brief the overflow segments which RouDi adds at runtime, they are never placed in a file
+        SegmentOverflow m_overflow;
+        /// @brief RouDi writes the chunk size recording of the segment and its overflow segments to this file when
+        /// it shuts down, the recording must be enabled in the MePooConfig
+        cxx::optional<SegmentFile::Path_t> m_chunkSizeRecordingFile;
     };
 
     cxx::vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
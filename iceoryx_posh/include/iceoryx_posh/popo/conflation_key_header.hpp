@@ -0,0 +1,58 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_CONFLATION_KEY_HEADER_HPP
+#define IOX_POSH_POPO_CONFLATION_KEY_HEADER_HPP
+
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief User-header which tags a sample with a conflation key, e.g. the id of the entity the sample is an update
+/// for. A subscriber with the QueueConflationPolicy::KEEP_LATEST_PER_KEY keeps only the newest pending sample per key
+/// in its queue.
+/// @note Only chunks whose user-header id is USER_HEADER_ID are conflated. The typed publisher sets it for the
+/// ConflationKeyHeader and for custom user-headers which are derived from it, the users of the untyped publisher set
+/// it with mepoo::ChunkHeader::setUserHeaderId. Chunks with any other user-header are never conflated.
+/// @code
+/// iox::popo::Publisher<ObjectTrack, iox::popo::ConflationKeyHeader> publisher({"Tracker", "Objects", "Tracks"});
+/// publisher.loan().and_then([&](auto& sample) {
+///     sample.getUserHeader().key = track.id;
+///     *sample = track;
+///     sample.publish();
+/// });
+/// @endcode
+struct ConflationKeyHeader
+{
+    /// @brief the user-header id which identifies the ConflationKeyHeader
+    static constexpr uint16_t USER_HEADER_ID{0x0001};
+
+    uint64_t key{0U};
+
+    /// @brief reads the conflation key from the user-header of a chunk
+    /// @param[in] chunkHeader of the chunk
+    /// @return the key or nullopt if the user-header of the chunk is not identified as ConflationKeyHeader
+    static cxx::optional<uint64_t> fromChunkHeader(const mepoo::ChunkHeader& chunkHeader) noexcept;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CONFLATION_KEY_HEADER_HPP
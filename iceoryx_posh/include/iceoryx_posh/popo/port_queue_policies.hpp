@@ -1,4 +1,4 @@
-// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+// Copyright (c) 2021 - 2022 by Apex.AI Inc. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -41,6 +41,16 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by consumers to request how the chunks are stored in the queue
+enum class QueueConflationPolicy : uint8_t
+{
+    /// Every chunk is pushed into the queue
+    NONE,
+    /// A chunk replaces the pending chunk with the same conflation key in the queue, chunks without a key are pushed
+    /// into the queue; the key is read from the user-header, see ConflationKeyHeader
+    KEEP_LATEST_PER_KEY
+};
+
 } // namespace popo
 } // namespace iox
 #endif // IOX_POSH_POPO_PORT_QUEUE_POLICIES_HPP
@@ -43,6 +43,23 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The reservation of the mempools the publisher allocates its chunks from. A publisher with a reservation
+    /// exclusively uses the mempools which are reserved for it in the RouDi config and never the shared mempools.
+    mepoo::MemPoolReservation_t mempoolReservation{mepoo::NO_MEMPOOL_RESERVATION};
+
+    /// @brief The option whether the publisher only provides its latest value. Instead of pushing every sample into
+    /// the queues of the subscribers, the publisher replaces the newest sample in a single slot from which the
+    /// subscribers take it. Subscribers receive at most one sample per publish and samples they missed are skipped.
+    /// Attached WaitSets and Listeners are notified about every publish. This is intended for state-like data.
+    bool latestValueOnly{false};
+
+    /// @brief The option whether the samples are copied into slots of the subscriber queues instead of sharing the
+    /// chunk with the subscribers. This avoids the reference counting and the release of the chunk per subscriber for
+    /// tiny samples, e.g. control messages. Only samples without a user-header and with a user-payload of up to
+    /// MAX_INLINE_USER_PAYLOAD_SIZE bytes can be delivered inline, loaning larger samples fails. The option is ignored
+    /// in the latest-value mode.
+    bool inlineDelivery{false};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -0,0 +1,37 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_PUBLISHER_HPP
+#define IOX_POSH_POPO_RING_PUBLISHER_HPP
+
+#include "iceoryx_posh/internal/popo/ring_publisher_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The RingPublisher class writes variable-size records into a byte ring in the shared memory which is read by
+/// RingSubscribers. Unlike the UntypedPublisher it does not need a chunk per record which makes it suitable for a
+/// high rate of small records like log messages or traces.
+class RingPublisher : public RingPublisherImpl<>
+{
+  public:
+    using RingPublisherImpl<>::RingPublisherImpl;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RING_PUBLISHER_HPP
@@ -0,0 +1,44 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_RING_SUBSCRIBER_HPP
+#define IOX_POSH_POPO_RING_SUBSCRIBER_HPP
+
+#include "iceoryx_posh/internal/popo/ring_subscriber_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The RingSubscriber class reads the records which a RingPublisher writes into its byte ring. Every subscriber
+/// reads with its own cursor and is informed with hasLostRecords when the publisher overwrote records before they
+/// were read.
+class RingSubscriber : public RingSubscriberImpl<>
+{
+    using Impl = RingSubscriberImpl<>;
+
+  public:
+    using RingSubscriberImpl<>::RingSubscriberImpl;
+
+    virtual ~RingSubscriber() noexcept
+    {
+        Impl::m_trigger.reset();
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RING_SUBSCRIBER_HPP
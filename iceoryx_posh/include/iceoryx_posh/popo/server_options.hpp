@@ -49,6 +49,10 @@ struct ServerOptions
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     ConsumerTooSlowPolicy clientTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The reservation of the mempools the server allocates its responses from. A server with a reservation
+    /// exclusively uses the mempools which are reserved for it in the RouDi config and never the shared mempools.
+    mepoo::MemPoolReservation_t mempoolReservation{mepoo::NO_MEMPOOL_RESERVATION};
+
     /// @brief serialization of the ServerOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the ServerOptions
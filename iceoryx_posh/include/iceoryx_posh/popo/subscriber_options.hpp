@@ -18,9 +18,11 @@
 #define IOX_POSH_POPO_SUBSCRIBER_OPTIONS_HPP
 
 #include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
+#include "iceoryx_posh/popo/user_header_filter.hpp"
 #include "port_queue_policies.hpp"
 
 #include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 
 #include <cstdint>
 
@@ -51,6 +53,37 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the queue keeps only the newest pending sample per conflation key, the key is read
+    /// from the user-header of the samples, see ConflationKeyHeader
+    QueueConflationPolicy queueConflationPolicy{QueueConflationPolicy::NONE};
+
+    /// @brief The filter on a user-header field which is evaluated by the publishers, samples which are not accepted
+    /// are not delivered to the subscriber
+    UserHeaderFilter userHeaderFilter{};
+
+    /// @brief Only every Nth sample which passed the userHeaderFilter is delivered to the subscriber, 0 and 1 deliver
+    /// every sample
+    uint64_t deliveryDecimation{1U};
+
+    /// @brief The minimum interval between two samples delivered to the subscriber, samples published in between are
+    /// skipped by the publishers; zero delivers every sample
+    units::Duration minimumDeliveryInterval{units::Duration::zero()};
+
+    /// @brief Samples which were published longer ago than the maximum sample age are discarded when they are taken
+    /// instead of being passed to the user; zero disables the check
+    units::Duration maximumSampleAge{units::Duration::zero()};
+
+    /// @brief The period in which the subscriber expects a new sample, if no sample arrives within the period the
+    /// deadline is missed; zero disables the deadline monitoring
+    /// @note RouDi checks the deadlines in its discovery loop, a missed deadline is therefore notified with a delay of
+    ///       up to roudi::DISCOVERY_INTERVAL (100 ms), e.g. a 10 ms deadline is reported after up to 110 ms.
+    ///       hasMissedDeadline() has no such delay.
+    /// @note A subscriber has a single trigger. While it is attached to a WaitSet or Listener with
+    ///       SubscriberState::DEADLINE_MISSED or SubscriberEvent::DEADLINE_MISSED no notification about new data is
+    ///       sent. To wait for data and detect missed deadlines at the same time, attach HAS_DATA or DATA_RECEIVED
+    ///       and wait with a timeout of the deadline, then check hasMissedDeadline().
+    units::Duration deadline{units::Duration::zero()};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
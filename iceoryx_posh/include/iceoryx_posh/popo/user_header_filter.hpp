@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+#define IOX_POSH_POPO_USER_HEADER_FILTER_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Declarative filter on an unsigned integer field of the user-header. The filter of a subscriber is evaluated
+/// by the publisher before a sample is pushed into the subscriber queue, samples which are not accepted are neither
+/// pushed nor do they wake up the subscriber.
+/// The field is described by its offset and size in the user-header and read in the native byte order. Samples without
+/// a user-header or with a user-header which does not contain the field are not accepted.
+/// @note the filter is stored in the shared memory and must therefore stay trivially copyable
+/// @code
+/// struct TrackHeader
+/// {
+///     uint32_t sensorId;
+///     uint16_t classification;
+/// };
+/// iox::popo::SubscriberOptions options;
+/// options.userHeaderFilter = iox::popo::UserHeaderFilter::inRange(
+///     offsetof(TrackHeader, sensorId), sizeof(TrackHeader::sensorId), 10U, 19U);
+/// @endcode
+struct UserHeaderFilter
+{
+    enum class Operation : uint8_t
+    {
+        /// every sample is accepted
+        ACCEPT_ALL,
+        /// the field must be equal to the first operand
+        EQUAL_TO,
+        /// the field must be in the closed interval [first operand, second operand]
+        IN_RANGE,
+        /// at least one bit of the mask in the first operand must be set in the field
+        ANY_BIT_SET
+    };
+
+    /// @brief creates a filter which accepts samples whose field is equal to the value
+    /// @param[in] fieldOffset offset of the field in the user-header, e.g. determined with offsetof
+    /// @param[in] fieldSize size of the field, must be 1, 2, 4 or 8
+    /// @param[in] value the field must be equal to
+    static UserHeaderFilter equalTo(const uint32_t fieldOffset, const uint32_t fieldSize, const uint64_t value) noexcept;
+
+    /// @brief creates a filter which accepts samples whose field is in the closed interval [min, max]
+    /// @param[in] fieldOffset offset of the field in the user-header, e.g. determined with offsetof
+    /// @param[in] fieldSize size of the field, must be 1, 2, 4 or 8
+    /// @param[in] min is the lower bound of the field
+    /// @param[in] max is the upper bound of the field
+    static UserHeaderFilter
+    inRange(const uint32_t fieldOffset, const uint32_t fieldSize, const uint64_t min, const uint64_t max) noexcept;
+
+    /// @brief creates a filter which accepts samples whose field has at least one bit of the mask set
+    /// @param[in] fieldOffset offset of the field in the user-header, e.g. determined with offsetof
+    /// @param[in] fieldSize size of the field, must be 1, 2, 4 or 8
+    /// @param[in] mask of the bits of interest
+    static UserHeaderFilter anyBitSet(const uint32_t fieldOffset, const uint32_t fieldSize, const uint64_t mask) noexcept;
+
+    /// @brief checks if the filter is a valid combination of operation and field size, this is used to validate
+    /// deserialized filters
+    /// @return true if the filter is valid, otherwise false
+    bool isValid() const noexcept;
+
+    /// @brief evaluates the filter on the user-header of a chunk
+    /// @param[in] chunkHeader of the chunk to evaluate
+    /// @return true if the chunk shall be delivered, otherwise false
+    bool accepts(const mepoo::ChunkHeader& chunkHeader) const noexcept;
+
+    Operation operation{Operation::ACCEPT_ALL};
+    uint32_t fieldOffset{0U};
+    uint32_t fieldSize{0U};
+    uint64_t firstOperand{0U};
+    uint64_t secondOperand{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_USER_HEADER_FILTER_HPP
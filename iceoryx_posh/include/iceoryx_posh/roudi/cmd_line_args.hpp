@@ -32,6 +32,7 @@ struct CmdLineArgs_t
     iox::log::LogLevel logLevel{iox::log::LogLevel::WARN};
     version::CompatibilityCheckLevel compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t runtimeMessageWorkers{roudi::DEFAULT_RUNTIME_MESSAGE_WORKERS};
     cxx::optional<uint16_t> uniqueRouDiId{cxx::nullopt};
     bool run{true};
     roudi::ConfigFilePathString_t configFilePath;
@@ -45,6 +46,7 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
     cmdLineArgs.uniqueRouDiId.and_then([&logstream](auto& id) { logstream << "Unique RouDi ID: " << id << "\n"; })
         .or_else([&logstream] { logstream << "Unique RouDi ID: < unset >\n"; });
     logstream << "Process kill delay: " << cmdLineArgs.processKillDelay.toSeconds() << " s\n";
+    logstream << "Runtime message workers: " << cmdLineArgs.runtimeMessageWorkers << "\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
@@ -124,6 +124,33 @@ struct SubscriberPortChangingIntrospectionFieldTopic
     cxx::vector<SubscriberPortChangingData, MAX_SUBSCRIBERS> subscriberPortChangingDataList;
 };
 
+/// @brief the latency introspection is only offered when it is enabled in the RouDi config
+const capro::ServiceDescription
+    IntrospectionSubscriberLatencyService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "SubscriberLatencies");
+
+/// @brief the publish-to-take latency histogram of the chunks a subscriber took from one publisher. Bucket 0 counts
+/// the latencies below 1 us, bucket i the latencies in [2^(i-1), 2^i) us and the last bucket all larger latencies.
+struct LatencyHistogramData
+{
+    uint64_t publisherPortID{0};
+    uint64_t bucketCounts[NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS]{};
+};
+
+struct SubscriberLatencyData
+{
+    // index used to identify subscriber is same as in PortIntrospectionFieldTopic->subscriberList
+    cxx::vector<LatencyHistogramData, MAX_LATENCY_HISTOGRAMS_PER_SUBSCRIBER> latencyHistograms;
+    /// @brief how often the least recently recorded histogram was cleared and reassigned to another publisher since
+    /// all histograms were assigned
+    uint64_t numberOfHistogramReassignments{0};
+};
+
+/// @brief the topic for the latency introspection that a user can subscribe to
+struct SubscriberLatencyIntrospectionFieldTopic
+{
+    cxx::vector<SubscriberLatencyData, MAX_SUBSCRIBERS> subscriberLatencyList;
+};
+
 const capro::ServiceDescription IntrospectionProcessService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Process");
 
 struct ProcessIntrospectionData
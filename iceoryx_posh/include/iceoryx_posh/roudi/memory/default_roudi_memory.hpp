@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/internal/roudi/memory/mempool_collection_memory_block.hpp"
 #include "iceoryx_posh/internal/roudi/memory/mempool_segment_manager_memory_block.hpp"
+#include "iceoryx_posh/roudi/memory/memfd_memory_provider.hpp"
 #include "iceoryx_posh/roudi/memory/posix_shm_memory_provider.hpp"
 
 namespace iox
@@ -36,11 +37,26 @@ struct DefaultRouDiMemory
     DefaultRouDiMemory(const DefaultRouDiMemory&) = delete;
     DefaultRouDiMemory& operator=(const DefaultRouDiMemory&) = delete;
 
-    mepoo::MePooConfig introspectionMemPoolConfig() const noexcept;
+    mepoo::MePooConfig introspectionMemPoolConfig(const bool latencyIntrospection) const noexcept;
+
+    /// @brief the provider of the management memory, m_managementMemfd when memfd-management-memory is set in the
+    /// RouDi config and supported by the platform, m_managementShm otherwise
+    MemoryProvider& managementMemoryProvider() noexcept;
+    const MemoryProvider& managementMemoryProvider() const noexcept;
+
+    /// @brief the file descriptor of the management memory which has to be passed to the applications
+    /// @return the file descriptor or cxx::nullopt if the management memory is a named shared memory
+    cxx::optional<int32_t> managementMemoryFileDescriptor() const noexcept;
 
     MemPoolCollectionMemoryBlock m_introspectionMemPoolBlock;
     MemPoolSegmentManagerMemoryBlock m_segmentManagerBlock;
     PosixShmMemoryProvider m_managementShm;
+    MemfdMemoryProvider m_managementMemfd;
+
+  private:
+    static bool useMemfdManagementMemory(const RouDiConfig_t& roudiConfig) noexcept;
+
+    bool m_useMemfdManagementMemory{false};
 };
 } // namespace roudi
 } // namespace iox
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 by agent. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_MEMORY_MEMFD_MEMORY_PROVIDER_HPP
+#define IOX_POSH_ROUDI_MEMORY_MEMFD_MEMORY_PROVIDER_HPP
+
+#include "iceoryx_posh/roudi/memory/memory_provider.hpp"
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Creates the memory as anonymous memory file (memfd) which is sealed against resizing. The memory has no
+/// entry in the file system and is released with the last file descriptor and mapping which refers to it, i.e. nothing
+/// is left behind when the processes terminate. Other processes get access to the memory by receiving the file
+/// descriptor, e.g. with posix::UnixDomainSocket::sendWithFileDescriptor, and mapping it.
+/// @note only supported on Linux, on other platforms the memory creation fails
+class MemfdMemoryProvider : public MemoryProvider
+{
+  public:
+    /// @brief Constructs a MemfdMemoryProvider which can be used to request memory via MemoryBlocks
+    /// @param [in] name of the memory file, it has no meaning besides debugging, e.g. it is shown in /proc/<pid>/fd
+    explicit MemfdMemoryProvider(const ShmName_t& name) noexcept;
+    ~MemfdMemoryProvider() noexcept;
+
+    MemfdMemoryProvider(MemfdMemoryProvider&&) = delete;
+    MemfdMemoryProvider& operator=(MemfdMemoryProvider&&) = delete;
+
+    MemfdMemoryProvider(const MemfdMemoryProvider&) = delete;
+    MemfdMemoryProvider& operator=(const MemfdMemoryProvider&) = delete;
+
+    /// @brief The file descriptor of the memory file which can be passed to other processes to map the memory
+    /// @return the file descriptor or cxx::nullopt if the memory is not available
+    cxx::optional<int32_t> getFileDescriptor() const noexcept;
+
+  protected:
+    /// @copydoc MemoryProvider::createMemory
+    /// @note This creates a sealed memory file and maps it to the address space of the application
+    cxx::expected<void*, MemoryProviderError> createMemory(const uint64_t size, const uint64_t alignment) noexcept;
+
+    /// @copydoc MemoryProvider::destroyMemory
+    /// @note This unmaps the memory and closes the memory file
+    cxx::expected<MemoryProviderError> destroyMemory() noexcept;
+
+  private:
+    bool closeFileDescriptor() noexcept;
+
+    static constexpr int32_t INVALID_FD{-1};
+
+    ShmName_t m_name;
+    int32_t m_fileDescriptor{INVALID_FD};
+    cxx::optional<posix::MemoryMap> m_memoryMap;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMORY_MEMFD_MEMORY_PROVIDER_HPP
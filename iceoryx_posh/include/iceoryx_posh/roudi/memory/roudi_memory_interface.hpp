@@ -54,7 +54,10 @@ class RouDiMemoryInterface
     /// MemoryBlocks to destroy their data
     virtual cxx::expected<RouDiMemoryManagerError> destroyMemory() noexcept = 0;
 
-    virtual const PosixShmMemoryProvider* mgmtMemoryProvider() const noexcept = 0;
+    virtual const MemoryProvider* mgmtMemoryProvider() const noexcept = 0;
+    /// @brief The file descriptor of the management memory which RouDi passes to the applications when they register
+    /// @return the file descriptor or cxx::nullopt if the applications open the management memory by its name
+    virtual cxx::optional<int32_t> mgmtMemoryFileDescriptor() const noexcept = 0;
     virtual cxx::optional<PortPool*> portPool() noexcept = 0;
     virtual cxx::optional<mepoo::MemoryManager*> introspectionMemoryManager() const noexcept = 0;
     virtual cxx::optional<mepoo::SegmentManager<>*> segmentManager() const noexcept = 0;
@@ -0,0 +1,122 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_MEMPOOL_SIZING_ADVISOR_HPP
+#define IOX_POSH_ROUDI_MEMPOOL_SIZING_ADVISOR_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_recording.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <cstdint>
+#include <iostream>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemoryManager;
+}
+namespace roudi
+{
+/// @brief A process-local snapshot of the ChunkSizeRecording of a segment and its overflow segments together with the
+/// usage watermarks of the mempools without reservation. RouDi writes it in a versioned text format which is read by
+/// the iox-mempool-advisor.
+struct ChunkSizeStatistics
+{
+    static constexpr uint32_t FORMAT_VERSION{1U};
+
+    enum class Error
+    {
+        INVALID_FORMAT,
+        UNSUPPORTED_VERSION,
+    };
+
+    struct Bucket
+    {
+        uint32_t m_maxChunkSize{0U};
+        uint64_t m_count{0U};
+    };
+
+    struct MemPool
+    {
+        uint32_t m_chunkSize{0U};
+        uint32_t m_chunkCount{0U};
+        /// @brief the maximum number of chunks which were used at the same time
+        uint32_t m_peakUsedChunks{0U};
+        uint64_t m_requests{0U};
+        uint64_t m_wastedBytes{0U};
+        uint64_t m_failedRequests{0U};
+    };
+
+    /// @brief the non-empty buckets ordered by increasing chunk size
+    cxx::vector<Bucket, mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS> m_buckets;
+    /// @brief the mempools without reservation ordered by increasing chunk size
+    cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPools;
+    uint64_t m_requestsWithoutMemPool{0U};
+
+    /// @brief creates the snapshot of a memory manager, the recordings and mempools of its overflow memory managers
+    /// are merged into it
+    /// @param[in] memoryManager with an enabled chunk size recording
+    /// @return the snapshot, it is empty when the recording is not enabled
+    static ChunkSizeStatistics fromMemoryManager(const mepoo::MemoryManager& memoryManager) noexcept;
+
+    /// @brief reads a snapshot which was written with writeTo
+    static cxx::expected<ChunkSizeStatistics, Error> readFrom(std::istream& stream) noexcept;
+
+    void writeTo(std::ostream& stream) const noexcept;
+
+    /// @brief returns the number of recorded requests
+    uint64_t getNumberOfRequests() const noexcept;
+};
+
+/// @brief Derives a mempool configuration from the ChunkSizeStatistics of a segment. The recorded chunk sizes are
+/// grouped into at most the given number of mempools so that the memory of the chunks which are required at the same
+/// time is minimal. The number of chunks a bucket requires is estimated from the usage watermark of the mempool which
+/// served it, in proportion to the requests of the bucket.
+class MemPoolSizingAdvisor
+{
+  public:
+    struct Options
+    {
+        /// @brief the maximum memory of the segment including the management memory, 0 means unlimited
+        uint64_t m_memoryBudget{0U};
+        uint32_t m_maxNumberOfMemPools{MAX_NUMBER_OF_MEMPOOLS};
+        /// @brief the additional chunks on top of the recorded peak usage in percent
+        uint32_t m_headroomPercent{25U};
+    };
+
+    struct Advice
+    {
+        mepoo::MePooConfig m_mePooConfig;
+        /// @brief the memory the segment requires with this mempool configuration
+        uint64_t m_requiredMemorySize{0U};
+        /// @brief false if the budget is exceeded even with a single chunk per mempool
+        bool m_fitsIntoBudget{true};
+    };
+
+    /// @brief derives the mempool configuration, the chunk counts are scaled down when they exceed the budget
+    static Advice advise(const ChunkSizeStatistics& statistics, const Options& options) noexcept;
+
+    /// @brief writes the mempool configuration as RouDi TOML config with a single segment
+    static void writeToml(const Advice& advice, std::ostream& stream) noexcept;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMPOOL_SIZING_ADVISOR_HPP
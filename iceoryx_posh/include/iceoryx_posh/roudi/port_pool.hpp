@@ -35,6 +35,8 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace roudi
@@ -54,8 +56,11 @@ enum class PortPoolError : uint8_t
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    INLINE_SLOTS_LIST_FULL,
 };
 
+/// @brief The PortPool adds, removes and lists the resources in the PortPoolData. All methods are thread-safe, the
+/// returned lists are snapshots. The PortManager ensures that a resource is only removed while no other thread uses it.
 class PortPool
 {
   public:
@@ -72,6 +77,35 @@ class PortPool
     cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
     getConditionVariableDataList() noexcept;
 
+    /// @brief The following getters provide only the resources of the given runtime. They look only at the resources
+    /// which are registered for this runtime in the PortPoolData and not at the resources of the other runtimes.
+    /// @param[in] runtimeName of the runtime the resources belong to
+    /// @return the resources of the runtime
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+    getInterfacePortDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList(const RuntimeName_t& runtimeName) noexcept;
+    cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+    getConditionVariableDataList(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief The following getters provide only the ports with the given service description. They look only at
+    /// the ports which are registered for this service description in the PortPoolData and not at the other ports.
+    /// @param[in] serviceDescription of the ports
+    /// @return the ports with the service description
+    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS>
+    getClientPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS>
+    getServerPortDataList(const capro::ServiceDescription& serviceDescription) noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -135,6 +169,11 @@ class PortPool
     cxx::expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds InlineSlots to the internal pool and returns a pointer for further usage
+    /// @param[in] runtimeName of the runtime of the subscriber the slots are attached to
+    /// @return on success a pointer to the InlineSlots; on error a PortPoolError
+    cxx::expected<popo::InlineSlots*, PortPoolError> addInlineSlots(const RuntimeName_t& runtimeName) noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -170,8 +209,14 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes InlineSlots from the internal pool
+    /// @param[in] inlineSlots is a pointer to the InlineSlots to be removed
+    /// @note after this call the provided InlineSlots are no longer available for usage
+    void removeInlineSlots(const popo::InlineSlots* const inlineSlots) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
+    std::mutex m_mutex;
 };
 
 } // namespace roudi
@@ -28,6 +28,15 @@ struct RouDiConfig
 {
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
+
+    /// @brief publish the latency histograms of the subscribers with the SubscriberLatencies port introspection topic,
+    /// its mempool in the introspection memory is only created when enabled
+    bool m_latencyIntrospection{false};
+
+    /// @brief back the management memory with a sealed memfd instead of a named shared memory; RouDi passes the file
+    /// descriptor to the applications with the registration acknowledgement, therefore this requires unix domain
+    /// sockets as IPC channel
+    bool m_memfdManagementMemory{false};
 };
 } // namespace config
 } // namespace iox
@@ -31,7 +31,7 @@ namespace roudi
 /// INVALID_CONFIG_FILE_VERSION - an invalid config file version was detected
 /// NO_SEGMENTS - at least one segment needs to be defined
 /// MAX_NUMBER_OF_SEGMENTS_EXCEEDED - max number of segments exceeded
-/// SEGMENT_WITHOUT_MEMPOOL - a segment must have at least one mempool
+/// SEGMENT_WITHOUT_MEMPOOL - a segment must have at least one mempool or a buddy pool
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief The kind of port which is requested by a PortRequest
+enum class PortRequestType : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER
+};
+
+/// @brief Describes a single port of a batched port creation, see PoshRuntime::createPorts
+struct PortRequest
+{
+    /// @brief creates a request for a publisher port
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the PortRequest for the publisher port
+    static PortRequest publisher(const capro::ServiceDescription& service,
+                                 const popo::PublisherOptions& publisherOptions = {},
+                                 const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief creates a request for a subscriber port
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the PortRequest for the subscriber port
+    static PortRequest subscriber(const capro::ServiceDescription& service,
+                                  const popo::SubscriberOptions& subscriberOptions = {},
+                                  const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    PortRequestType type{PortRequestType::PUBLISHER};
+    capro::ServiceDescription service;
+    /// @note only used when type is PortRequestType::PUBLISHER
+    popo::PublisherOptions publisherOptions;
+    /// @note only used when type is PortRequestType::SUBSCRIBER
+    popo::SubscriberOptions subscriberOptions;
+    PortConfigInfo portConfigInfo;
+
+    /// @brief serialization of the PortRequest
+    cxx::Serialization serialize() const noexcept;
+    /// @brief deserialization of the PortRequest
+    static cxx::expected<PortRequest, cxx::Serialization::Error>
+    deserialize(const cxx::Serialization& serialized) noexcept;
+};
+
+/// @brief The outcome of a single PortRequest. Only the port data pointer which matches the type of the request is
+/// set and it is a nullptr if RouDi could not create the port.
+struct PortRequestResult
+{
+    PortRequestType type{PortRequestType::PUBLISHER};
+    PublisherPortUserType::MemberType_t* publisherPortData{nullptr};
+    SubscriberPortUserType::MemberType_t* subscriberPortData{nullptr};
+};
+
+using PortRequestContainer = cxx::vector<PortRequest, MAX_PORT_REQUESTS_PER_BATCH>;
+using PortRequestResultContainer = cxx::vector<PortRequestResult, MAX_PORT_REQUESTS_PER_BATCH>;
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUEST_HPP
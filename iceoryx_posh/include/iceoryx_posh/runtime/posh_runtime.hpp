@@ -33,6 +33,7 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 
 #include <atomic>
 
@@ -113,6 +114,13 @@ class PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = {},
                             const PortConfigInfo& portConfigInfo = {}) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create multiple publisher and subscriber ports at once; the requests are
+    /// packed into as few IPC messages as possible to reduce the round trips to RouDi when many ports are created
+    /// @param[in] requests the publisher and subscriber ports to create
+    /// @return the created port data in the same order as the requests; if a port could not be created, the error
+    /// handler is called like for getMiddlewarePublisher and getMiddlewareSubscriber and the port data is a nullptr
+    virtual PortRequestResultContainer createPorts(const PortRequestContainer& requests) noexcept = 0;
+
     /// @brief request the RouDi daemon to create a client port
     /// @param[in] serviceDescription service description for the new client port
     /// @param[in] clientOptions like the queue capacity and queue full policy by a client
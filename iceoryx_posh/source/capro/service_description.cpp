@@ -22,6 +22,26 @@ namespace iox
 {
 namespace capro
 {
+namespace
+{
+// FNV-1a, fast for the short id strings and good enough to distinguish ServiceDescriptions before comparing the strings
+constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+uint64_t appendToHash(uint64_t hash, const IdString_t& value) noexcept
+{
+    const auto* const data = value.c_str();
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<uint8_t>(data[i]));
+        hash *= FNV_PRIME;
+    }
+    // separate the strings so that e.g. "ab" + "c" and "a" + "bc" result in different hashes
+    hash *= FNV_PRIME;
+    return hash;
+}
+} // namespace
+
 ServiceDescription::ClassHash::ClassHash() noexcept
     : ClassHash{0U, 0U, 0U, 0U}
 {
@@ -82,13 +102,27 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
     : m_serviceString{service}
     , m_instanceString{instance}
     , m_eventString{event}
+    , m_hash{calculateHash(service, instance, event)}
     , m_classHash(classHash)
     , m_interfaceSource(interfaceSource)
 {
 }
 
+uint64_t ServiceDescription::calculateHash(const IdString_t& service,
+                                           const IdString_t& instance,
+                                           const IdString_t& event) noexcept
+{
+    return appendToHash(appendToHash(appendToHash(FNV_OFFSET_BASIS, service), instance), event);
+}
+
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const noexcept
 {
+    // different hashes imply different strings, equal hashes still require the comparison of the strings
+    if (m_hash != rhs.m_hash)
+    {
+        return false;
+    }
+
     if (m_serviceString != rhs.m_serviceString)
     {
         return false;
@@ -176,6 +210,8 @@ ServiceDescription::deserialize(const cxx::Serialization& serialized) noexcept
         return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
     }
 
+    deserializedObject.m_hash = calculateHash(
+        deserializedObject.m_serviceString, deserializedObject.m_instanceString, deserializedObject.m_eventString);
     deserializedObject.m_scope = static_cast<Scope>(scope);
     deserializedObject.m_interfaceSource = static_cast<Interfaces>(interfaceSource);
 
@@ -217,6 +253,11 @@ ServiceDescription::ClassHash ServiceDescription::getClassHash() const noexcept
     return m_classHash;
 }
 
+uint64_t ServiceDescription::getHash() const noexcept
+{
+    return m_hash;
+}
+
 Interfaces ServiceDescription::getSourceInterface() const noexcept
 {
     return m_interfaceSource;
@@ -0,0 +1,357 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/buddy_mem_pool.hpp"
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/scope_guard.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint64_t BuddyMemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint64_t BuddyMemPool::MAX_CHUNK_SIZE;
+constexpr uint32_t BuddyMemPool::MAX_NUMBER_OF_ORDERS;
+constexpr BuddyMemPool::BlockState_t BuddyMemPool::FREE_FLAG;
+constexpr BuddyMemPool::BlockState_t BuddyMemPool::NO_BLOCK_HEAD;
+constexpr uint32_t BuddyMemPool::INVALID_BLOCK;
+
+BuddyMemPool::BuddyMemPool(const uint64_t size,
+                           const uint32_t minChunkSize,
+                           posix::Allocator& managementAllocator,
+                           posix::Allocator& chunkMemoryAllocator) noexcept
+    : m_minChunkSize(minChunkSize)
+    , m_numberOfBlocks(numberOfBlocks(size, minChunkSize))
+{
+    std::fill(std::begin(m_freeListHeads), std::end(m_freeListHeads), INVALID_BLOCK);
+
+    if (!cxx::isPowerOfTwo(minChunkSize) || minChunkSize < CHUNK_MEMORY_ALIGNMENT || m_numberOfBlocks == 0U)
+    {
+        LogFatal() << "The buddy mempool requires a min chunk size which is a power of two and at least "
+                   << CHUNK_MEMORY_ALIGNMENT << " and a size of at least the min chunk size but has a size of " << size
+                   << " and a min chunk size of " << minChunkSize;
+        m_numberOfBlocks = 0U;
+        errorHandler(PoshError::MEPOO__BUDDY_MEMPOOL_INVALID_CONFIGURATION);
+        return;
+    }
+
+    // the mutex is shared by all processes which release chunks, a process which dies while holding it must not block
+    // the others
+    if (posix::MutexBuilder()
+            .isInterProcessCapable(true)
+            .mutexType(posix::MutexType::NORMAL)
+            .threadTerminationBehavior(posix::MutexThreadTerminationBehavior::RELEASE_WHEN_LOCKED)
+            .create(m_mutex)
+            .has_error())
+    {
+        LogFatal() << "Unable to create the inter-process mutex of the buddy mempool";
+        m_numberOfBlocks = 0U;
+        errorHandler(PoshError::MEPOO__BUDDY_MEMPOOL_MUTEX_CREATION_FAILED);
+        return;
+    }
+
+    while ((m_maxOrder + 1U < MAX_NUMBER_OF_ORDERS) && ((1ULL << (m_maxOrder + 1U)) <= m_numberOfBlocks)
+           && ((static_cast<uint64_t>(m_minChunkSize) << (m_maxOrder + 1U)) <= MAX_CHUNK_SIZE))
+    {
+        ++m_maxOrder;
+    }
+
+    m_rawMemory = static_cast<uint8_t*>(chunkMemoryAllocator.allocate(
+        static_cast<uint64_t>(m_numberOfBlocks) * m_minChunkSize, CHUNK_MEMORY_ALIGNMENT));
+    m_blockStates =
+        static_cast<BlockState_t*>(managementAllocator.allocate(m_numberOfBlocks, CHUNK_MEMORY_ALIGNMENT));
+    std::fill(m_blockStates.get(), m_blockStates.get() + m_numberOfBlocks, NO_BLOCK_HEAD);
+    m_freeBlockLinks = static_cast<FreeBlockLinks*>(managementAllocator.allocate(
+        static_cast<uint64_t>(m_numberOfBlocks) * sizeof(FreeBlockLinks), CHUNK_MEMORY_ALIGNMENT));
+    for (uint32_t i = 0U; i < m_numberOfBlocks; ++i)
+    {
+        new (&m_freeBlockLinks.get()[i]) FreeBlockLinks();
+    }
+
+    // the arena is carved into blocks of decreasing size, this keeps every block aligned to its own size which is
+    // the precondition to find the buddy of a block by its index
+    uint32_t block{0U};
+    while (block < m_numberOfBlocks)
+    {
+        uint32_t order{m_maxOrder};
+        while ((1ULL << order) > static_cast<uint64_t>(m_numberOfBlocks - block))
+        {
+            --order;
+        }
+        pushFreeBlock(block, order);
+        block += 1U << order;
+    }
+}
+
+uint32_t BuddyMemPool::numberOfBlocks(const uint64_t size, const uint32_t minChunkSize) noexcept
+{
+    if (minChunkSize == 0U)
+    {
+        return 0U;
+    }
+    return static_cast<uint32_t>(
+        std::min(size / minChunkSize, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max() - 1U)));
+}
+
+uint64_t BuddyMemPool::requiredChunkMemorySize(const uint64_t size, const uint32_t minChunkSize) noexcept
+{
+    return cxx::align(static_cast<uint64_t>(numberOfBlocks(size, minChunkSize)) * minChunkSize,
+                      CHUNK_MEMORY_ALIGNMENT);
+}
+
+uint64_t BuddyMemPool::requiredManagementMemorySize(const uint64_t size, const uint32_t minChunkSize) noexcept
+{
+    const auto blocks = static_cast<uint64_t>(numberOfBlocks(size, minChunkSize));
+    return cxx::align(blocks * sizeof(BlockState_t), CHUNK_MEMORY_ALIGNMENT)
+           + cxx::align(blocks * sizeof(FreeBlockLinks), CHUNK_MEMORY_ALIGNMENT);
+}
+
+uint32_t BuddyMemPool::orderOf(const uint32_t requiredChunkSize) const noexcept
+{
+    const uint64_t requiredBlocks = std::max<uint64_t>(
+        1U, (static_cast<uint64_t>(requiredChunkSize) + m_minChunkSize - 1U) / m_minChunkSize);
+    uint32_t order{0U};
+    while ((1ULL << order) < requiredBlocks)
+    {
+        ++order;
+    }
+    return order;
+}
+
+uint32_t BuddyMemPool::getChunkSize(const uint32_t requiredChunkSize) const noexcept
+{
+    if (m_numberOfBlocks == 0U || requiredChunkSize > getMaxChunkSize())
+    {
+        return 0U;
+    }
+    return m_minChunkSize << orderOf(requiredChunkSize);
+}
+
+void BuddyMemPool::pushFreeBlock(const uint32_t block, const uint32_t order) noexcept
+{
+    auto* const links = m_freeBlockLinks.get();
+    const auto head = m_freeListHeads[order];
+    links[block] = FreeBlockLinks{head, INVALID_BLOCK};
+    if (head != INVALID_BLOCK)
+    {
+        links[head].m_previous = block;
+    }
+    m_freeListHeads[order] = block;
+    m_blockStates.get()[block] = static_cast<BlockState_t>(FREE_FLAG | order);
+}
+
+void BuddyMemPool::removeFreeBlock(const uint32_t block, const uint32_t order) noexcept
+{
+    auto* const links = m_freeBlockLinks.get();
+    const auto blockLinks = links[block];
+    if (blockLinks.m_previous != INVALID_BLOCK)
+    {
+        links[blockLinks.m_previous].m_next = blockLinks.m_next;
+    }
+    else
+    {
+        m_freeListHeads[order] = blockLinks.m_next;
+    }
+    if (blockLinks.m_next != INVALID_BLOCK)
+    {
+        links[blockLinks.m_next].m_previous = blockLinks.m_previous;
+    }
+    m_blockStates.get()[block] = NO_BLOCK_HEAD;
+}
+
+void BuddyMemPool::rebuildFreeLists() noexcept
+{
+    std::fill(std::begin(m_freeListHeads), std::end(m_freeListHeads), INVALID_BLOCK);
+
+    uint32_t block{0U};
+    while (block < m_numberOfBlocks)
+    {
+        const auto state = m_blockStates.get()[block];
+        const uint32_t order = state & static_cast<BlockState_t>(~FREE_FLAG);
+        if (state == NO_BLOCK_HEAD || order > m_maxOrder)
+        {
+            // the block was taken from a free list but not yet assigned when the owner of the mutex died, it is lost
+            ++block;
+            continue;
+        }
+        if ((state & FREE_FLAG) != 0U)
+        {
+            pushFreeBlock(block, order);
+        }
+        block += 1U << order;
+    }
+}
+
+bool BuddyMemPool::lock() noexcept
+{
+    auto lockResult = m_mutex->lock();
+    if (!lockResult.has_error())
+    {
+        return true;
+    }
+
+    if (lockResult.get_error() == posix::MutexLockError::LOCK_ACQUIRED_BUT_HAS_INCONSISTENT_STATE_SINCE_OWNER_DIED)
+    {
+        // the free lists might have been modified only partially, the block states are the reference to rebuild them
+        LogWarn() << "A process died while it acquired or released a chunk of the buddy mempool, the free lists are "
+                     "rebuilt and blocks which were in transition are lost";
+        m_mutex->make_consistent();
+        rebuildFreeLists();
+        return true;
+    }
+
+    LogFatal() << "Locking of the inter-process mutex of the buddy mempool failed!";
+    errorHandler(PoshError::MEPOO__BUDDY_MEMPOOL_LOCKING_ERROR, ErrorLevel::FATAL);
+    return false;
+}
+
+void BuddyMemPool::unlock() noexcept
+{
+    if (m_mutex->unlock().has_error())
+    {
+        LogFatal() << "Unlocking of the inter-process mutex of the buddy mempool failed!";
+        errorHandler(PoshError::MEPOO__BUDDY_MEMPOOL_UNLOCKING_ERROR, ErrorLevel::FATAL);
+    }
+}
+
+void* BuddyMemPool::getChunk(const uint32_t requiredChunkSize) noexcept
+{
+    const auto chunkSize = getChunkSize(requiredChunkSize);
+    if (chunkSize == 0U)
+    {
+        return nullptr;
+    }
+    const auto order = orderOf(requiredChunkSize);
+
+    if (!lock())
+    {
+        return nullptr;
+    }
+    cxx::ScopeGuard unlockGuard{[this] { unlock(); }};
+
+    auto freeOrder = order;
+    while (freeOrder <= m_maxOrder && m_freeListHeads[freeOrder] == INVALID_BLOCK)
+    {
+        ++freeOrder;
+    }
+    if (freeOrder > m_maxOrder)
+    {
+        return nullptr;
+    }
+
+    const auto block = m_freeListHeads[freeOrder];
+    removeFreeBlock(block, freeOrder);
+
+    // the upper halves of the split block are the buddies of the acquired block and go back to the free lists
+    while (freeOrder > order)
+    {
+        --freeOrder;
+        pushFreeBlock(block + (1U << freeOrder), freeOrder);
+    }
+    m_blockStates.get()[block] = static_cast<BlockState_t>(order);
+
+    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
+    m_usedSize.fetch_add(chunkSize, std::memory_order_relaxed);
+
+    return m_rawMemory.get() + static_cast<uint64_t>(block) * m_minChunkSize;
+}
+
+uint32_t BuddyMemPool::getBlockIndex(const void* chunk) const noexcept
+{
+    cxx::Expects(m_rawMemory.get() <= chunk
+                 && chunk < m_rawMemory.get() + static_cast<uint64_t>(m_numberOfBlocks) * m_minChunkSize);
+
+    const auto offset = static_cast<uint64_t>(static_cast<const uint8_t*>(chunk) - m_rawMemory.get());
+    cxx::Expects(offset % m_minChunkSize == 0U);
+
+    return static_cast<uint32_t>(offset / m_minChunkSize);
+}
+
+bool BuddyMemPool::containsChunk(const void* chunk) const noexcept
+{
+    const auto* begin = m_rawMemory.get();
+    return begin <= chunk && chunk < begin + static_cast<uint64_t>(m_numberOfBlocks) * m_minChunkSize;
+}
+
+void BuddyMemPool::freeChunk(const void* chunk) noexcept
+{
+    auto block = getBlockIndex(chunk);
+
+    if (!lock())
+    {
+        return;
+    }
+    cxx::ScopeGuard unlockGuard{[this] { unlock(); }};
+
+    uint32_t order = m_blockStates.get()[block];
+    if ((order & FREE_FLAG) != 0U || order == NO_BLOCK_HEAD)
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        return;
+    }
+
+    m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
+    m_usedSize.fetch_sub(static_cast<uint64_t>(m_minChunkSize) << order, std::memory_order_relaxed);
+
+    while (order < m_maxOrder)
+    {
+        const uint32_t buddy = block ^ (1U << order);
+        if ((static_cast<uint64_t>(buddy) + (1ULL << order) > m_numberOfBlocks)
+            || (m_blockStates.get()[buddy] != static_cast<BlockState_t>(FREE_FLAG | order)))
+        {
+            break;
+        }
+        removeFreeBlock(buddy, order);
+        m_blockStates.get()[std::max(block, buddy)] = NO_BLOCK_HEAD;
+        block = std::min(block, buddy);
+        ++order;
+    }
+
+    pushFreeBlock(block, order);
+}
+
+uint64_t BuddyMemPool::getSize() const noexcept
+{
+    return static_cast<uint64_t>(m_numberOfBlocks) * m_minChunkSize;
+}
+
+uint32_t BuddyMemPool::getMinChunkSize() const noexcept
+{
+    return m_minChunkSize;
+}
+
+uint32_t BuddyMemPool::getMaxChunkSize() const noexcept
+{
+    return (m_numberOfBlocks == 0U) ? 0U : m_minChunkSize << m_maxOrder;
+}
+
+uint32_t BuddyMemPool::getUsedChunks() const noexcept
+{
+    return m_usedChunks.load(std::memory_order_relaxed);
+}
+
+uint64_t BuddyMemPool::getUsedSize() const noexcept
+{
+    return m_usedSize.load(std::memory_order_relaxed);
+}
+
+} // namespace mepoo
+} // namespace iox
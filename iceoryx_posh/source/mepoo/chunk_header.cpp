@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
 namespace iox
@@ -77,7 +78,7 @@ ChunkHeader::ChunkHeader(const uint32_t chunkSize, const ChunkSettings& chunkSet
     }
     else
     {
-        // currently there is no way to set the user-header id; this is just a preparation for future functionality
+        // a user-header with a well known layout is identified afterwards with setUserHeaderId
         m_userHeaderId = UNKNOWN_USER_HEADER;
 
         // the most complex case with a user-header
@@ -118,6 +119,14 @@ uint16_t ChunkHeader::userHeaderId() const noexcept
     return m_userHeaderId;
 }
 
+void ChunkHeader::setUserHeaderId(const uint16_t userHeaderId) noexcept
+{
+    if (m_userHeaderId != NO_USER_HEADER && userHeaderId != NO_USER_HEADER)
+    {
+        m_userHeaderId = userHeaderId;
+    }
+}
+
 void* ChunkHeader::userHeader() noexcept
 {
     if (m_userHeaderId == NO_USER_HEADER)
@@ -222,6 +231,46 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::publishTimestamp() const noexcept
+{
+    return m_publishTimestamp;
+}
+
+void ChunkHeader::setPublishTimestamp(const uint64_t publishTimestamp) noexcept
+{
+    m_publishTimestamp = publishTimestamp;
+}
+
+ChunkHeader* ChunkHeader::nextSegment() noexcept
+{
+    if (m_nextSegment.isLogicalNullptr())
+    {
+        return nullptr;
+    }
+    return memory::RelativePointer<ChunkHeader>(m_nextSegment.offset(), memory::segment_id_t{m_nextSegment.id()})
+        .get();
+}
+
+const ChunkHeader* ChunkHeader::nextSegment() const noexcept
+{
+    return const_cast<ChunkHeader*>(this)->nextSegment();
+}
+
+void ChunkHeader::setNextSegment(ChunkHeader* const nextSegment) noexcept
+{
+    if (nextSegment == nullptr)
+    {
+        m_nextSegment.reset();
+        return;
+    }
+    memory::RelativePointer<ChunkHeader> ptr{nextSegment};
+    cxx::Ensures(ptr.getId() <= memory::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(ptr.getOffset() <= memory::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+    m_nextSegment = memory::RelativePointerData(static_cast<memory::RelativePointerData::identifier_t>(ptr.getId()),
+                                                ptr.getOffset());
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
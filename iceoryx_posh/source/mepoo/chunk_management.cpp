@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/buddy_mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
 namespace iox
@@ -34,6 +35,41 @@ ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const cxx::not_null<base_t*> chunkHeader,
+                                 const cxx::not_null<BuddyMemPool*> buddyMemPool,
+                                 const cxx::not_null<MemPool*> chunkManagementPool) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_buddyMemPool(buddyMemPool)
+    , m_chunkManagementPool(chunkManagementPool)
+{
+}
+
+ChunkManagement::ChunkManagement() noexcept
+    : m_referenceCounter(0U)
+{
+}
+
+void ChunkManagement::reinitialize(const cxx::not_null<base_t*> chunkHeader,
+                                   const cxx::not_null<MemPool*> mempool) noexcept
+{
+    m_chunkHeader = chunkHeader;
+    m_mempool = mempool;
+    m_buddyMemPool = nullptr;
+    m_chunkManagementPool = nullptr;
+    m_nextSegment = nullptr;
+    m_referenceCounter.store(1U, std::memory_order_release);
+}
+
+void ChunkManagement::reinitialize(const cxx::not_null<base_t*> chunkHeader,
+                                   const cxx::not_null<BuddyMemPool*> buddyMemPool) noexcept
+{
+    m_chunkHeader = chunkHeader;
+    m_mempool = nullptr;
+    m_buddyMemPool = buddyMemPool;
+    m_chunkManagementPool = nullptr;
+    m_nextSegment = nullptr;
+    m_referenceCounter.store(1U, std::memory_order_release);
+}
 
 } // namespace mepoo
 } // namespace iox
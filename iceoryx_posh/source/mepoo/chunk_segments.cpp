@@ -0,0 +1,95 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chunk_segments.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+ChunkSegments::Iterator::Iterator(const ChunkHeader* const chunkHeader) noexcept
+    : m_chunkHeader(chunkHeader)
+{
+}
+
+const ChunkHeader& ChunkSegments::Iterator::operator*() const noexcept
+{
+    return *m_chunkHeader;
+}
+
+const ChunkHeader* ChunkSegments::Iterator::operator->() const noexcept
+{
+    return m_chunkHeader;
+}
+
+ChunkSegments::Iterator& ChunkSegments::Iterator::operator++() noexcept
+{
+    m_chunkHeader = m_chunkHeader->nextSegment();
+    return *this;
+}
+
+bool ChunkSegments::Iterator::operator==(const Iterator& rhs) const noexcept
+{
+    return m_chunkHeader == rhs.m_chunkHeader;
+}
+
+bool ChunkSegments::Iterator::operator!=(const Iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+ChunkSegments::ChunkSegments(const ChunkHeader* const chunkHeader) noexcept
+    : m_chunkHeader(chunkHeader)
+{
+}
+
+ChunkSegments ChunkSegments::fromUserPayload(const void* const userPayload) noexcept
+{
+    return ChunkSegments(ChunkHeader::fromUserPayload(userPayload));
+}
+
+ChunkSegments::Iterator ChunkSegments::begin() const noexcept
+{
+    return Iterator(m_chunkHeader);
+}
+
+ChunkSegments::Iterator ChunkSegments::end() const noexcept
+{
+    return Iterator(nullptr);
+}
+
+uint64_t ChunkSegments::size() const noexcept
+{
+    uint64_t numberOfSegments{0U};
+    for (auto it = begin(); it != end(); ++it)
+    {
+        ++numberOfSegments;
+    }
+    return numberOfSegments;
+}
+
+uint64_t ChunkSegments::userPayloadSize() const noexcept
+{
+    uint64_t userPayloadSize{0U};
+    for (const auto& segment : *this)
+    {
+        userPayloadSize += segment.userPayloadSize();
+    }
+    return userPayloadSize;
+}
+
+} // namespace mepoo
+} // namespace iox
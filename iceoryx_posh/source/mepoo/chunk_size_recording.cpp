@@ -0,0 +1,102 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_recording.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t ChunkSizeRecording::SUB_BUCKET_BITS;
+constexpr uint32_t ChunkSizeRecording::SUB_BUCKETS_PER_OCTAVE;
+constexpr uint32_t ChunkSizeRecording::NUMBER_OF_BUCKETS;
+constexpr uint32_t ChunkSizeRecording::NO_MEMPOOL;
+
+uint32_t ChunkSizeRecording::bucketIndex(const uint32_t chunkSize) noexcept
+{
+    if (chunkSize < SUB_BUCKETS_PER_OCTAVE)
+    {
+        return chunkSize;
+    }
+
+    uint32_t octave{SUB_BUCKET_BITS};
+    while (octave < 31U && (chunkSize >> (octave + 1U)) != 0U)
+    {
+        ++octave;
+    }
+    // the leading bit of the chunk size selects the octave and the next SUB_BUCKET_BITS bits the bucket within it
+    const uint32_t subBucket = (chunkSize >> (octave - SUB_BUCKET_BITS)) - SUB_BUCKETS_PER_OCTAVE;
+    return (octave - SUB_BUCKET_BITS + 1U) * SUB_BUCKETS_PER_OCTAVE + subBucket;
+}
+
+void ChunkSizeRecording::record(const uint32_t requiredChunkSize,
+                                const uint32_t memPoolIndex,
+                                const uint32_t acquiredChunkSize) noexcept
+{
+    const auto index = bucketIndex(requiredChunkSize);
+    m_bucketCounts[index].fetch_add(1U, std::memory_order_relaxed);
+    auto maxChunkSize = m_bucketMaxChunkSizes[index].load(std::memory_order_relaxed);
+    while (maxChunkSize < requiredChunkSize
+           && !m_bucketMaxChunkSizes[index].compare_exchange_weak(
+               maxChunkSize, requiredChunkSize, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+
+    if (memPoolIndex >= MAX_NUMBER_OF_MEMPOOLS)
+    {
+        m_requestsWithoutMemPool.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    m_memPoolRequests[memPoolIndex].fetch_add(1U, std::memory_order_relaxed);
+    if (acquiredChunkSize == 0U)
+    {
+        m_memPoolFailedRequests[memPoolIndex].fetch_add(1U, std::memory_order_relaxed);
+    }
+    else if (acquiredChunkSize > requiredChunkSize)
+    {
+        m_memPoolWastedBytes[memPoolIndex].fetch_add(acquiredChunkSize - requiredChunkSize, std::memory_order_relaxed);
+    }
+}
+
+ChunkSizeRecording::Bucket ChunkSizeRecording::getBucket(const uint32_t index) const noexcept
+{
+    if (index >= NUMBER_OF_BUCKETS)
+    {
+        return Bucket();
+    }
+    return Bucket{m_bucketMaxChunkSizes[index].load(std::memory_order_relaxed),
+                  m_bucketCounts[index].load(std::memory_order_relaxed)};
+}
+
+ChunkSizeRecording::MemPoolCounters ChunkSizeRecording::getMemPoolCounters(const uint32_t memPoolIndex) const noexcept
+{
+    if (memPoolIndex >= MAX_NUMBER_OF_MEMPOOLS)
+    {
+        return MemPoolCounters();
+    }
+    return MemPoolCounters{m_memPoolRequests[memPoolIndex].load(std::memory_order_relaxed),
+                           m_memPoolWastedBytes[memPoolIndex].load(std::memory_order_relaxed),
+                           m_memPoolFailedRequests[memPoolIndex].load(std::memory_order_relaxed)};
+}
+
+uint64_t ChunkSizeRecording::getRequestsWithoutMemPool() const noexcept
+{
+    return m_requestsWithoutMemPool.load(std::memory_order_relaxed);
+}
+
+} // namespace mepoo
+} // namespace iox
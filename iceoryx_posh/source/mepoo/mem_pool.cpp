@@ -21,6 +21,7 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 
 #include <algorithm>
+#include <cstddef>
 
 namespace iox
 {
@@ -47,6 +48,14 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> c
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
 {
+    static_assert(offsetof(MemPool, m_usedChunks)
+                      >= offsetof(MemPool, m_numberOfChunks) + sizeof(m_numberOfChunks)
+                             + concurrent::CACHE_LINE_PADDING_SIZE,
+                  "The usage counters must not share a cache line with the members which are read-only");
+    static_assert(offsetof(MemPool, m_freeIndices)
+                      >= offsetof(MemPool, m_minFree) + sizeof(m_minFree) + concurrent::CACHE_LINE_PADDING_SIZE,
+                  "The usage counters must not share a cache line with the free-list");
+
     if (isMultipleOfAlignment(chunkSize))
     {
         m_rawMemory = static_cast<uint8_t*>(chunkMemoryAllocator.allocate(
@@ -92,7 +101,7 @@ void* MemPool::getChunk() noexcept
     return m_rawMemory.get() + l_index * m_chunkSize;
 }
 
-void MemPool::freeChunk(const void* chunk) noexcept
+uint32_t MemPool::getChunkIndex(const void* chunk) const noexcept
 {
     cxx::Expects(m_rawMemory.get() <= chunk
                  && chunk <= m_rawMemory.get() + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
@@ -100,7 +109,18 @@ void MemPool::freeChunk(const void* chunk) noexcept
     auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory.get();
     cxx::Expects(offset % m_chunkSize == 0);
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
+
+bool MemPool::containsChunk(const void* chunk) const noexcept
+{
+    const auto* begin = m_rawMemory.get();
+    return begin <= chunk && chunk < begin + (static_cast<uint64_t>(m_chunkSize) * m_numberOfChunks);
+}
+
+void MemPool::freeChunk(const void* chunk) noexcept
+{
+    uint32_t index = getChunkIndex(chunk);
 
     if (!m_freeIndices.push(index))
     {
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
@@ -31,26 +32,47 @@ namespace mepoo
 {
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
-    for (auto& l_mempool : m_memPoolVector)
+    for (uint64_t i = 0U; i < m_memPoolVector.size(); ++i)
     {
+        const auto& l_mempool = m_memPoolVector[i];
         log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
             << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-            << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
+            << ", ChunkCount = " << l_mempool.getChunkCount() << ", Reservation = " << m_memPoolReservations[i]
+            << " ]";
+    }
+    for (const auto& buddyMemPool : m_buddyMemPool)
+    {
+        log << "  BuddyMemPool [ Size = " << buddyMemPool.getSize()
+            << ", MinChunkSize = " << buddyMemPool.getMinChunkSize()
+            << ", MaxChunkSize = " << buddyMemPool.getMaxChunkSize() << ", UsedSize = " << buddyMemPool.getUsedSize()
+            << " ]";
     }
 }
 
 void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
                                posix::Allocator& chunkMemoryAllocator,
                                const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const cxx::greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const MemPoolReservation_t reservation) noexcept
 {
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(chunkPayloadSize));
+
+    // the ordering is only required within the mempools of a reservation since getChunk never mixes them
+    uint32_t largestChunkSizeOfReservation{0U};
+    for (uint64_t i = 0U; i < m_memPoolVector.size(); ++i)
+    {
+        if (m_memPoolReservations[i] == reservation)
+        {
+            largestChunkSizeOfReservation = m_memPoolVector[i].getChunkSize();
+        }
+    }
+
     if (m_denyAddMemPool)
     {
         LogFatal() << "After the generation of the chunk management pool you are not allowed to create new mempools.";
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
-    else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
+    else if (adjustedChunkSize <= largestChunkSizeOfReservation)
     {
         LogFatal() << "The following mempools were already added to the mempool handler:"
                    << [this](auto& log) -> iox::log::LogStream& {
@@ -59,19 +81,28 @@ void MemoryManager::addMemPool(posix::Allocator& managementAllocator,
         } << "These mempools must be added in an increasing chunk size ordering. The newly added  MemPool [ "
              "ChunkSize = "
           << adjustedChunkSize << ", ChunkPayloadSize = " << static_cast<uint32_t>(chunkPayloadSize)
-          << ", ChunkCount = " << static_cast<uint32_t>(numberOfChunks) << "] breaks that requirement!";
+          << ", ChunkCount = " << static_cast<uint32_t>(numberOfChunks) << ", Reservation = " << reservation
+          << "] breaks that requirement!";
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
-    m_totalNumberOfChunks += numberOfChunks;
+    m_memPoolReservations.emplace_back(reservation);
+    m_chunkManagements.emplace_back(allocateChunkManagements(managementAllocator, numberOfChunks));
 }
 
-void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept
+ChunkManagement* MemoryManager::allocateChunkManagements(posix::Allocator& managementAllocator,
+                                                         const uint32_t numberOfChunks) noexcept
 {
-    m_denyAddMemPool = true;
-    uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    auto chunkManagements = static_cast<ChunkManagement*>(managementAllocator.allocate(
+        static_cast<uint64_t>(numberOfChunks) * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT));
+    // the entries are constructed once and only reinitialized when their chunk is acquired, see
+    // ChunkManagement::reinitialize
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        new (chunkManagements + i) ChunkManagement();
+    }
+    return chunkManagements;
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -88,6 +119,100 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     return m_memPoolVector[index].getInfo();
 }
 
+const BuddyMemPool* MemoryManager::getBuddyMemPool() const noexcept
+{
+    return m_buddyMemPool.empty() ? nullptr : &m_buddyMemPool.front();
+}
+
+void MemoryManager::setOverflowMemoryManager(MemoryManager& overflowMemoryManager) noexcept
+{
+    cxx::Expects(&overflowMemoryManager != this && getOverflowMemoryManager() == nullptr);
+    // NOLINTJUSTIFICATION the link is an offset between two objects in the same shared memory
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto overflowAddress = reinterpret_cast<uintptr_t>(&overflowMemoryManager);
+    const auto thisAddress = reinterpret_cast<uintptr_t>(this);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    m_overflowMemoryManagerOffset.store(static_cast<int64_t>(overflowAddress - thisAddress), std::memory_order_release);
+}
+
+MemoryManager* MemoryManager::getOverflowMemoryManager() const noexcept
+{
+    const auto offset = m_overflowMemoryManagerOffset.load(std::memory_order_acquire);
+    if (offset == 0)
+    {
+        return nullptr;
+    }
+    // NOLINTJUSTIFICATION the link is an offset between two objects in the same shared memory
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    return reinterpret_cast<MemoryManager*>(reinterpret_cast<uintptr_t>(this) + static_cast<uintptr_t>(offset));
+}
+
+bool MemoryManager::containsChunk(const void* chunk) const noexcept
+{
+    for (const auto& memPool : m_memPoolVector)
+    {
+        if (memPool.containsChunk(chunk))
+        {
+            return true;
+        }
+    }
+    if (!m_buddyMemPool.empty() && m_buddyMemPool.front().containsChunk(chunk))
+    {
+        return true;
+    }
+    const auto* overflowMemoryManager = getOverflowMemoryManager();
+    return overflowMemoryManager != nullptr && overflowMemoryManager->containsChunk(chunk);
+}
+
+uint32_t MemoryManager::getMaxUsagePercent() const noexcept
+{
+    uint64_t maxUsagePercent{0U};
+    for (const auto& memPool : m_memPoolVector)
+    {
+        const auto info = memPool.getInfo();
+        if (info.m_numChunks != 0U)
+        {
+            maxUsagePercent =
+                algorithm::maxVal(maxUsagePercent, static_cast<uint64_t>(info.m_usedChunks) * 100U / info.m_numChunks);
+        }
+    }
+    for (const auto& buddyMemPool : m_buddyMemPool)
+    {
+        if (buddyMemPool.getSize() != 0U)
+        {
+            maxUsagePercent =
+                algorithm::maxVal(maxUsagePercent, buddyMemPool.getUsedSize() * 100U / buddyMemPool.getSize());
+        }
+    }
+    return static_cast<uint32_t>(maxUsagePercent);
+}
+
+const ChunkSizeRecording* MemoryManager::getChunkSizeRecording() const noexcept
+{
+    return m_chunkSizeRecording.get();
+}
+
+void MemoryManager::recordChunkSize(const uint32_t requiredChunkSize,
+                                    const MemPoolReservation_t reservation,
+                                    const uint32_t memPoolIndex,
+                                    const uint32_t acquiredChunkSize) noexcept
+{
+    // the reserved mempools are dedicated to specific ports and not subject to the mempool sizing
+    if (m_chunkSizeRecording && reservation == NO_MEMPOOL_RESERVATION)
+    {
+        m_chunkSizeRecording->record(requiredChunkSize, memPoolIndex, acquiredChunkSize);
+    }
+}
+
+MemPoolReservation_t MemoryManager::getMemPoolReservation(const uint32_t index) const noexcept
+{
+    if (index >= m_memPoolReservations.size())
+    {
+        return NO_MEMPOOL_RESERVATION;
+    }
+    return m_memPoolReservations[index];
+}
+
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
@@ -106,23 +231,34 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
                                      * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
                                  MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
+    mePooConfig.m_buddyMemPoolConfig.and_then([&](const auto& buddyConfig) {
+        memorySize += BuddyMemPool::requiredChunkMemorySize(buddyConfig.m_size, buddyConfig.m_minChunkSize);
+    });
     return memorySize;
 }
 
 uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0U};
-    uint64_t sumOfAllChunks{0U};
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
-        sumOfAllChunks += mempool.m_chunkCount;
         memorySize += cxx::align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount),
                                  MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += cxx::align(static_cast<uint64_t>(mempool.m_chunkCount) * sizeof(ChunkManagement),
+                                 MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
+    mePooConfig.m_buddyMemPoolConfig.and_then([&](const auto& buddyConfig) {
+        // every block of the arena can become a chunk and requires a ChunkManagement
+        const auto numberOfBlocks = BuddyMemPool::numberOfBlocks(buddyConfig.m_size, buddyConfig.m_minChunkSize);
+        memorySize += BuddyMemPool::requiredManagementMemorySize(buddyConfig.m_size, buddyConfig.m_minChunkSize);
+        memorySize += cxx::align(static_cast<uint64_t>(numberOfBlocks) * sizeof(ChunkManagement),
+                                 MemPool::CHUNK_MEMORY_ALIGNMENT);
+    });
 
-    memorySize += cxx::align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize +=
-        cxx::align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    if (mePooConfig.m_recordChunkSizes)
+    {
+        memorySize += cxx::align(sizeof(ChunkSizeRecording), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    }
 
     return memorySize;
 }
@@ -138,52 +274,96 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
 {
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount, entry.m_reservation);
     }
 
-    generateChunkManagementPool(managementAllocator);
+    mePooConfig.m_buddyMemPoolConfig.and_then([&](const auto& buddyConfig) {
+        m_buddyMemPool.emplace_back(
+            buddyConfig.m_size, buddyConfig.m_minChunkSize, managementAllocator, chunkMemoryAllocator);
+        m_buddyChunkManagements = allocateChunkManagements(
+            managementAllocator, BuddyMemPool::numberOfBlocks(buddyConfig.m_size, buddyConfig.m_minChunkSize));
+    });
+
+    m_denyAddMemPool = true;
+
+    if (mePooConfig.m_recordChunkSizes)
+    {
+        m_chunkSizeRecording = new (managementAllocator.allocate(sizeof(ChunkSizeRecording),
+                                                                 MemPool::CHUNK_MEMORY_ALIGNMENT)) ChunkSizeRecording();
+    }
 }
 
-cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+cxx::expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunk(const ChunkSettings& chunkSettings, const MemPoolReservation_t reservation) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
+    ChunkManagement* chunkManagements{nullptr};
+    BuddyMemPool* buddyMemPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
+    uint32_t memPoolIndex{ChunkSizeRecording::NO_MEMPOOL};
 
-    for (auto& memPool : m_memPoolVector)
+    for (uint64_t i = 0U; i < m_memPoolVector.size(); ++i)
     {
+        auto& memPool = m_memPoolVector[i];
         uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        if (m_memPoolReservations[i] == reservation && chunkSizeOfMemPool >= requiredChunkSize)
         {
-            chunk = memPool.getChunk();
+            // an exhausted mempool is expected when there is an overflow memory manager, skip the mempool to avoid
+            // its out of chunks report
+            if (memPool.getUsedChunks() < memPool.getChunkCount() || getOverflowMemoryManager() == nullptr)
+            {
+                chunk = memPool.getChunk();
+            }
             memPoolPointer = &memPool;
+            chunkManagements = m_chunkManagements[i].get();
+            memPoolIndex = static_cast<uint32_t>(i);
             aquiredChunkSize = chunkSizeOfMemPool;
             break;
         }
     }
 
-    if (m_memPoolVector.size() == 0)
+    if (memPoolPointer == nullptr && reservation == NO_MEMPOOL_RESERVATION && !m_buddyMemPool.empty())
+    {
+        auto& buddyMemPool = m_buddyMemPool.front();
+        aquiredChunkSize = buddyMemPool.getChunkSize(requiredChunkSize);
+        if (aquiredChunkSize != 0U)
+        {
+            chunk = buddyMemPool.getChunk(requiredChunkSize);
+            buddyMemPoolPointer = &buddyMemPool;
+        }
+    }
+
+    if (m_memPoolVector.empty() && m_buddyMemPool.empty())
     {
         LogFatal() << "There are no mempools available!";
 
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOLS_AVAILABLE);
     }
-    else if (memPoolPointer == nullptr)
+    else if (memPoolPointer == nullptr && buddyMemPoolPointer == nullptr)
     {
+        recordChunkSize(requiredChunkSize, reservation, memPoolIndex, 0U);
         LogFatal() << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
             this->printMemPoolVector(log);
             return log;
-        } << "Could not find a fitting mempool for a chunk of size "
-          << requiredChunkSize;
+        } << "Could not find a fitting mempool with the reservation "
+          << reservation << " for a chunk of size " << requiredChunkSize;
 
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, ErrorLevel::SEVERE);
         return cxx::error<Error>(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
     }
     else if (chunk == nullptr)
     {
+        auto overflowMemoryManager = getOverflowMemoryManager();
+        if (overflowMemoryManager != nullptr)
+        {
+            return overflowMemoryManager->getChunk(chunkSettings, reservation);
+        }
+        recordChunkSize(requiredChunkSize, reservation, memPoolIndex, 0U);
+
         LogError() << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
                    << chunkSettings.userPayloadSize()
                    << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
@@ -194,11 +374,20 @@ cxx::expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const C
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
         return cxx::error<Error>(Error::MEMPOOL_OUT_OF_CHUNKS);
     }
+    else if (buddyMemPoolPointer != nullptr)
+    {
+        recordChunkSize(requiredChunkSize, reservation, memPoolIndex, aquiredChunkSize);
+        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
+        auto chunkManagement = m_buddyChunkManagements.get() + buddyMemPoolPointer->getBlockIndex(chunk);
+        chunkManagement->reinitialize(chunkHeader, buddyMemPoolPointer);
+        return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
+    }
     else
     {
+        recordChunkSize(requiredChunkSize, reservation, memPoolIndex, aquiredChunkSize);
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        auto chunkManagement = chunkManagements + memPoolPointer->getChunkIndex(chunk);
+        chunkManagement->reinitialize(chunkHeader, memPoolPointer);
         return cxx::success<SharedChunk>(SharedChunk(chunkManagement));
     }
 }
@@ -23,6 +23,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MePooConfig::BuddyMemPoolEntry::DEFAULT_MIN_CHUNK_SIZE;
+
 const MePooConfig::MePooConfigContainerType* MePooConfig::getMemPoolConfig() const noexcept
 {
     return &m_mempoolConfig;
@@ -41,6 +43,11 @@ void MePooConfig::addMemPool(MePooConfig::Entry f_entry) noexcept
     }
 }
 
+void MePooConfig::setBuddyMemPool(const BuddyMemPoolEntry& entry) noexcept
+{
+    m_buddyMemPoolConfig.emplace(entry);
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
@@ -60,13 +67,17 @@ MePooConfig& MePooConfig::optimize() noexcept
     auto config = m_mempoolConfig;
     m_mempoolConfig.clear();
 
-    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.m_size < rhs.m_size; });
+    // reserved mempools are never merged with the shared ones or with mempools of another reservation
+    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) {
+        return (lhs.m_reservation < rhs.m_reservation)
+               || (lhs.m_reservation == rhs.m_reservation && lhs.m_size < rhs.m_size);
+    });
 
     MePooConfig::Entry newEntry{0u, 0u};
 
     for (const auto& entry : config)
     {
-        if (entry.m_size != newEntry.m_size)
+        if (entry.m_size != newEntry.m_size || entry.m_reservation != newEntry.m_reservation)
         {
             if (newEntry.m_size != 0u)
             {
@@ -74,6 +85,7 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_reservation = entry.m_reservation;
         }
         else
         {
@@ -21,6 +21,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t SegmentOverflow::DEFAULT_THRESHOLD_PERCENT;
+
 SegmentConfig& SegmentConfig::setDefaults() noexcept
 {
     auto groupName = posix::PosixGroup::getGroupOfCurrentProcess().getName();
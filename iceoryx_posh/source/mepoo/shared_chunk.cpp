@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
+#include "iceoryx_posh/internal/mepoo/buddy_mem_pool.hpp"
 
 namespace iox
 {
@@ -52,8 +53,9 @@ void SharedChunk::incrementReferenceCounter() noexcept
 
 void SharedChunk::decrementReferenceCounter() noexcept
 {
+    // release publishes the accesses of this owner to hasNoOtherOwners of the remaining one
     if ((m_chunkManagement != nullptr)
-        && (m_chunkManagement->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) == 1U))
+        && (m_chunkManagement->m_referenceCounter.fetch_sub(1U, std::memory_order_acq_rel) == 1U))
     {
         freeChunk();
     }
@@ -61,9 +63,34 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
-    m_chunkManagement = nullptr;
+    // the segments of a multi-chunk message are owned by their predecessor, they are released in a loop instead of
+    // recursively to not exhaust the stack with long messages
+    while (m_chunkManagement != nullptr)
+    {
+        // a ChunkManagement in the parallel array of a mempool is reused as soon as its chunk is released, therefore
+        // it must not be accessed afterwards
+        auto chunkManagementPool = m_chunkManagement->m_chunkManagementPool.get();
+        auto nextSegment = m_chunkManagement->m_nextSegment.get();
+        if (m_chunkManagement->m_buddyMemPool)
+        {
+            m_chunkManagement->m_buddyMemPool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
+        }
+        else
+        {
+            m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
+        }
+        if (chunkManagementPool != nullptr)
+        {
+            chunkManagementPool->freeChunk(m_chunkManagement);
+        }
+        m_chunkManagement = nullptr;
+
+        if ((nextSegment != nullptr)
+            && (nextSegment->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) == 1U))
+        {
+            m_chunkManagement = nextSegment;
+        }
+    }
 }
 
 SharedChunk& SharedChunk::operator=(const SharedChunk& rhs) noexcept
@@ -144,5 +171,27 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+bool SharedChunk::hasNoOtherOwners() const noexcept
+{
+    // acquire pairs with the decrement of the other owners, their accesses to the chunk happen before the caller
+    // writes to the chunk it owns exclusively
+    return (m_chunkManagement != nullptr)
+           && (m_chunkManagement->m_referenceCounter.load(std::memory_order_acquire) == 1U);
+}
+
+void SharedChunk::appendSegment(SharedChunk&& segment) noexcept
+{
+    cxx::Expects(m_chunkManagement != nullptr && segment.m_chunkManagement != nullptr
+                 && !segment.m_chunkManagement->m_nextSegment);
+
+    auto lastSegment = m_chunkManagement;
+    while (lastSegment->m_nextSegment)
+    {
+        lastSegment = lastSegment->m_nextSegment.get();
+    }
+    lastSegment->m_chunkHeader->setNextSegment(segment.getChunkHeader());
+    lastSegment->m_nextSegment = segment.release();
+}
+
 } // namespace mepoo
 } // namespace iox
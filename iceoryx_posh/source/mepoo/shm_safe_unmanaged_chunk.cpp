@@ -77,6 +77,26 @@ SharedChunk ShmSafeUnmanagedChunk::cloneToSharedChunk() noexcept
     return SharedChunk(chunkMgmt.get());
 }
 
+SharedChunk ShmSafeUnmanagedChunk::cloneToSharedChunkIfReferenced() noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr())
+    {
+        return SharedChunk();
+    }
+    auto chunkMgmt = memory::RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(),
+                                                                     memory::segment_id_t{m_chunkManagement.id()});
+    auto referenceCounter = chunkMgmt->m_referenceCounter.load(std::memory_order_relaxed);
+    do
+    {
+        if (referenceCounter == 0U)
+        {
+            return SharedChunk();
+        }
+    } while (!chunkMgmt->m_referenceCounter.compare_exchange_weak(
+        referenceCounter, referenceCounter + 1U, std::memory_order_acquire, std::memory_order_relaxed));
+    return SharedChunk(chunkMgmt.get());
+}
+
 bool ShmSafeUnmanagedChunk::isLogicalNullptr() const noexcept
 {
     return m_chunkManagement.isLogicalNullptr();
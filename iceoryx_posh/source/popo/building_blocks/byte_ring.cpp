@@ -0,0 +1,198 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/byte_ring.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t ByteRing::RECORD_ALIGNMENT;
+constexpr uint64_t ByteRing::FRAME_HEADER_SIZE;
+
+ByteRing::ByteRing(const uint64_t capacity) noexcept
+    : m_capacity(capacity)
+{
+    cxx::Expects(isValidCapacity(capacity));
+}
+
+bool ByteRing::isValidCapacity(const uint64_t capacity) noexcept
+{
+    const bool isPowerOfTwo = (capacity & (capacity - 1U)) == 0U;
+    return isPowerOfTwo && capacity >= 2U * FRAME_HEADER_SIZE
+           && requiredMemorySize(capacity) <= std::numeric_limits<uint32_t>::max();
+}
+
+uint64_t ByteRing::requiredMemorySize(const uint64_t capacity) noexcept
+{
+    return sizeof(ByteRing) + capacity;
+}
+
+uint64_t ByteRing::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+ByteRing::RecordSize_t ByteRing::maxRecordSize() const noexcept
+{
+    return static_cast<RecordSize_t>(m_capacity - FRAME_HEADER_SIZE);
+}
+
+cxx::expected<ByteRingError> ByteRing::write(const void* const record, const RecordSize_t size) noexcept
+{
+    if (size > maxRecordSize())
+    {
+        return cxx::error<ByteRingError>(ByteRingError::RECORD_TOO_LARGE);
+    }
+
+    const auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    const auto nextWritePosition = writePosition + framedSize(size);
+
+    auto tailPosition = m_tailPosition.load(std::memory_order_relaxed);
+    if (nextWritePosition - tailPosition > m_capacity)
+    {
+        // only the writer modifies the records, therefore the sizes of the records which are dropped can be read
+        // without synchronization
+        while (nextWritePosition - tailPosition > m_capacity)
+        {
+            tailPosition += framedSize(recordSizeAt(tailPosition));
+        }
+        // the readers must observe the new tail position before the records are overwritten
+        m_tailPosition.store(tailPosition, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    copyToRing(writePosition, &size, sizeof(size));
+    copyToRing(writePosition + FRAME_HEADER_SIZE, record, size);
+
+    m_writePosition.store(nextWritePosition, std::memory_order_release);
+    return cxx::success<>();
+}
+
+uint8_t* ByteRing::records() noexcept
+{
+    return reinterpret_cast<uint8_t*>(this + 1);
+}
+
+const uint8_t* ByteRing::records() const noexcept
+{
+    return reinterpret_cast<const uint8_t*>(this + 1);
+}
+
+uint64_t ByteRing::offset(const uint64_t position) const noexcept
+{
+    return position & (m_capacity - 1U);
+}
+
+ByteRing::RecordSize_t ByteRing::recordSizeAt(const uint64_t position) const noexcept
+{
+    RecordSize_t size{0U};
+    copyFromRing(position, &size, sizeof(size));
+    return size;
+}
+
+void ByteRing::copyToRing(const uint64_t position, const void* const source, const uint64_t size) noexcept
+{
+    const auto offsetOfPosition = offset(position);
+    const auto sizeUntilEnd = std::min(size, m_capacity - offsetOfPosition);
+    std::memcpy(records() + offsetOfPosition, source, sizeUntilEnd);
+    std::memcpy(records(), static_cast<const uint8_t*>(source) + sizeUntilEnd, size - sizeUntilEnd);
+}
+
+void ByteRing::copyFromRing(const uint64_t position, void* const destination, const uint64_t size) const noexcept
+{
+    const auto offsetOfPosition = offset(position);
+    const auto sizeUntilEnd = std::min(size, m_capacity - offsetOfPosition);
+    std::memcpy(destination, records() + offsetOfPosition, sizeUntilEnd);
+    std::memcpy(static_cast<uint8_t*>(destination) + sizeUntilEnd, records(), size - sizeUntilEnd);
+}
+
+uint64_t ByteRing::framedSize(const RecordSize_t size) noexcept
+{
+    return (FRAME_HEADER_SIZE + size + RECORD_ALIGNMENT - 1U) & ~(RECORD_ALIGNMENT - 1U);
+}
+
+ByteRingReader::ByteRingReader(const ByteRing& ring) noexcept
+    : m_ring(&ring)
+    , m_cursor(ring.m_tailPosition.load(std::memory_order_acquire))
+{
+}
+
+cxx::expected<ByteRing::RecordSize_t, ByteRingError>
+ByteRingReader::read(void* const buffer, const ByteRing::RecordSize_t bufferSize) noexcept
+{
+    while (true)
+    {
+        const auto writePosition = m_ring->m_writePosition.load(std::memory_order_acquire);
+        const auto tailPosition = m_ring->m_tailPosition.load(std::memory_order_acquire);
+        if (m_cursor < tailPosition)
+        {
+            m_cursor = tailPosition;
+            m_hasLostRecords = true;
+        }
+        if (m_cursor >= writePosition)
+        {
+            return cxx::error<ByteRingError>(ByteRingError::NO_RECORD_AVAILABLE);
+        }
+
+        // the size and the record are only valid if the writer did not overwrite them while they were copied, this
+        // is checked afterwards and the read is retried with the oldest record which is available
+        const auto size = m_ring->recordSizeAt(m_cursor);
+        const bool isSizeValid = size <= m_ring->maxRecordSize();
+        const bool fitsIntoBuffer = isSizeValid && size <= bufferSize;
+        if (fitsIntoBuffer)
+        {
+            m_ring->copyFromRing(m_cursor + ByteRing::FRAME_HEADER_SIZE, buffer, size);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_cursor < m_ring->m_tailPosition.load(std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        if (!isSizeValid)
+        {
+            // the ring is corrupted, e.g. by a writer which terminated abnormally; the reader continues with the
+            // records which are written afterwards
+            m_cursor = writePosition;
+            m_hasLostRecords = true;
+            return cxx::error<ByteRingError>(ByteRingError::NO_RECORD_AVAILABLE);
+        }
+        if (!fitsIntoBuffer)
+        {
+            return cxx::error<ByteRingError>(ByteRingError::BUFFER_TOO_SMALL);
+        }
+
+        m_cursor += ByteRing::framedSize(size);
+        return cxx::success<ByteRing::RecordSize_t>(size);
+    }
+}
+
+bool ByteRingReader::hasLostRecords() noexcept
+{
+    const bool hasLostRecords = m_hasLostRecords;
+    m_hasLostRecords = false;
+    return hasLostRecords;
+}
+
+} // namespace popo
+} // namespace iox
@@ -17,6 +17,8 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 
+#include <cstddef>
+
 namespace iox
 {
 namespace popo
@@ -29,6 +31,15 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
+    static_assert(offsetof(ConditionVariableData, m_semaphore)
+                      >= offsetof(ConditionVariableData, m_runtimeName) + sizeof(m_runtimeName)
+                             + concurrent::CACHE_LINE_PADDING_SIZE,
+                  "The semaphore must not share a cache line with the runtime name");
+    static_assert(sizeof(ConditionVariableData)
+                      >= offsetof(ConditionVariableData, m_wasNotified) + sizeof(m_wasNotified)
+                             + concurrent::CACHE_LINE_PADDING_SIZE,
+                  "The notification flags must not share a cache line with a neighbouring object");
+
     posix::UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(true).create(m_semaphore).or_else([](auto) {
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
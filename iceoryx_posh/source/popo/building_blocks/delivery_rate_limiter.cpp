@@ -0,0 +1,78 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DeliveryRateLimiter::NO_DELIVERY_YET;
+
+void DeliveryRateLimiter::configure(const uint64_t decimation, const units::Duration minimumInterval) noexcept
+{
+    m_decimation = (decimation == 0U) ? 1U : decimation;
+    m_minimumIntervalNs = minimumInterval.toNanoseconds();
+    m_numberOfSamples.store(0U, std::memory_order_relaxed);
+    m_lastDeliveryTimestampNs.store(NO_DELIVERY_YET, std::memory_order_relaxed);
+}
+
+bool DeliveryRateLimiter::isActive() const noexcept
+{
+    return m_decimation > 1U || m_minimumIntervalNs > 0U;
+}
+
+bool DeliveryRateLimiter::admitSample() noexcept
+{
+    if (!isActive())
+    {
+        return true;
+    }
+
+    return admitSample((m_minimumIntervalNs > 0U) ? mepoo::monotonicTimestamp() : 0U);
+}
+
+bool DeliveryRateLimiter::admitSample(const uint64_t timestampNs) noexcept
+{
+    if (m_decimation > 1U)
+    {
+        // the first sample is delivered, afterwards every Nth one
+        const auto sampleIndex = m_numberOfSamples.fetch_add(1U, std::memory_order_relaxed);
+        if (sampleIndex % m_decimation != 0U)
+        {
+            return false;
+        }
+    }
+
+    if (m_minimumIntervalNs > 0U)
+    {
+        auto lastDeliveryTimestampNs = m_lastDeliveryTimestampNs.load(std::memory_order_relaxed);
+        if (lastDeliveryTimestampNs != NO_DELIVERY_YET
+            && (timestampNs < lastDeliveryTimestampNs || timestampNs - lastDeliveryTimestampNs < m_minimumIntervalNs))
+        {
+            return false;
+        }
+        // multiple publishers can deliver to the same queue, only one of them is admitted per interval
+        return m_lastDeliveryTimestampNs.compare_exchange_strong(
+            lastDeliveryTimestampNs, timestampNs, std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,204 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/inline_slots.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t InlineSlots::CAPACITY;
+constexpr uint32_t InlineSlots::MAX_USER_PAYLOAD_SIZE;
+constexpr uint64_t InlineSlots::SLOT_SIZE;
+
+InlineSlots::InlineSlots(const RuntimeName_t& runtimeName) noexcept
+    : m_runtimeName(runtimeName)
+{
+}
+
+bool InlineSlots::fits(const uint32_t userPayloadSize,
+                       const uint32_t userPayloadAlignment,
+                       const uint32_t userHeaderSize) noexcept
+{
+    // without a user-header and with an alignment which does not exceed the one of the ChunkHeader, the user-payload
+    // is placed directly after the ChunkHeader
+    return userHeaderSize == 0U && userPayloadAlignment <= alignof(mepoo::ChunkHeader)
+           && userPayloadSize <= MAX_USER_PAYLOAD_SIZE;
+}
+
+bool InlineSlots::fits(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    return fits(chunkHeader.userPayloadSize(), chunkHeader.userPayloadAlignment(), chunkHeader.userHeaderSize())
+           && chunkHeader.nextSegment() == nullptr && chunkHeader.usedSizeOfChunk() <= SLOT_SIZE;
+}
+
+bool InlineSlots::push(const mepoo::ChunkHeader& chunkHeader,
+                       const bool discardOldest,
+                       const uint64_t numberOfEnqueuedChunks) noexcept
+{
+    bool hasOverflow{false};
+    auto index = m_freeIndices.pop();
+    if (!index.has_value() && discardOldest)
+    {
+        index = m_readyIndices.pop();
+        hasOverflow = index.has_value();
+    }
+    if (!index.has_value())
+    {
+        return false;
+    }
+
+    // the index queues do not synchronize the slots, the fences order the copy after the release of the slot by the
+    // consumer and before the take of the slot by the consumer
+    std::atomic_thread_fence(std::memory_order_acquire);
+    std::memcpy(m_slots[index.value()].m_data, &chunkHeader, chunkHeader.usedSizeOfChunk());
+    m_numberOfEnqueuedChunks[index.value()] = numberOfEnqueuedChunks;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_readyIndices.push(index.value());
+
+    return !hasOverflow;
+}
+
+cxx::optional<uint64_t> InlineSlots::numberOfEnqueuedChunksBeforeOldest() noexcept
+{
+    if (!m_oldestReadyIndex.has_value())
+    {
+        m_oldestReadyIndex = m_readyIndices.pop();
+        if (!m_oldestReadyIndex.has_value())
+        {
+            return cxx::nullopt;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return m_numberOfEnqueuedChunks[m_oldestReadyIndex.value()];
+}
+
+const mepoo::ChunkHeader* InlineSlots::tryTake() noexcept
+{
+    auto index = m_oldestReadyIndex;
+    m_oldestReadyIndex.reset();
+    if (!index.has_value())
+    {
+        index = m_readyIndices.pop();
+        if (!index.has_value())
+        {
+            return nullptr;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    m_isHeld[index.value()] = true;
+    return reinterpret_cast<const mepoo::ChunkHeader*>(m_slots[index.value()].m_data);
+}
+
+bool InlineSlots::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    auto index = heldSlotIndex(chunkHeader);
+    if (!index.has_value())
+    {
+        return false;
+    }
+
+    releaseSlot(index.value());
+    return true;
+}
+
+bool InlineSlots::isHeld(const mepoo::ChunkHeader* const chunkHeader) const noexcept
+{
+    return heldSlotIndex(chunkHeader).has_value();
+}
+
+void InlineSlots::releaseAll() noexcept
+{
+    for (uint64_t index = 0U; index < CAPACITY; ++index)
+    {
+        if (m_isHeld[index])
+        {
+            releaseSlot(index);
+        }
+    }
+    if (m_oldestReadyIndex.has_value())
+    {
+        releaseSlot(m_oldestReadyIndex.value());
+        m_oldestReadyIndex.reset();
+    }
+    while (auto index = m_readyIndices.pop())
+    {
+        releaseSlot(index.value());
+    }
+}
+
+bool InlineSlots::empty() const noexcept
+{
+    return !m_oldestReadyIndex.has_value() && m_readyIndices.empty();
+}
+
+memory::RelativePointerData InlineSlots::toRelativePointerData(InlineSlots* const slots) noexcept
+{
+    if (slots == nullptr)
+    {
+        return memory::RelativePointerData();
+    }
+    memory::RelativePointer<InlineSlots> ptr{slots};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    cxx::Ensures(id <= memory::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(offset <= memory::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+    return memory::RelativePointerData(static_cast<memory::RelativePointerData::identifier_t>(id), offset);
+}
+
+InlineSlots* InlineSlots::fromRelativePointerData(const memory::RelativePointerData data) noexcept
+{
+    if (data.isLogicalNullptr())
+    {
+        return nullptr;
+    }
+    return memory::RelativePointer<InlineSlots>(data.offset(), memory::segment_id_t{data.id()}).get();
+}
+
+cxx::optional<uint64_t> InlineSlots::heldSlotIndex(const mepoo::ChunkHeader* const chunkHeader) const noexcept
+{
+    const auto address = reinterpret_cast<uintptr_t>(chunkHeader);
+    const auto firstSlotAddress = reinterpret_cast<uintptr_t>(&m_slots[0]);
+    if (address < firstSlotAddress || address >= firstSlotAddress + sizeof(m_slots)
+        || (address - firstSlotAddress) % sizeof(Slot) != 0U)
+    {
+        return cxx::nullopt;
+    }
+
+    const uint64_t index = (address - firstSlotAddress) / sizeof(Slot);
+    if (!m_isHeld[index])
+    {
+        return cxx::nullopt;
+    }
+    return index;
+}
+
+void InlineSlots::releaseSlot(const uint64_t index) noexcept
+{
+    m_isHeld[index] = false;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_freeIndices.push(index);
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,118 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histograms.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t LatencyHistograms::CAPACITY;
+constexpr uint32_t LatencyHistograms::NUMBER_OF_BUCKETS;
+
+uint32_t LatencyHistograms::bucketIndex(const uint64_t latencyNs) noexcept
+{
+    constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+    uint64_t latencyUs = latencyNs / NANOSECONDS_PER_MICROSECOND;
+    uint32_t index{0U};
+    while (latencyUs != 0U && index < NUMBER_OF_BUCKETS - 1U)
+    {
+        latencyUs >>= 1U;
+        ++index;
+    }
+    return index;
+}
+
+void LatencyHistograms::record(const UniquePortId& originId, const uint64_t latencyNs) noexcept
+{
+    // there is only one writer, therefore the size and the counters do not need to be modified atomically
+    const auto size = m_size.load(std::memory_order_relaxed);
+    uint32_t index{0U};
+    while (index < size && m_histograms[index].m_originId != originId)
+    {
+        ++index;
+    }
+
+    if (index == size && size < CAPACITY)
+    {
+        // the origin id is published to the readers with the release of the new size
+        m_histograms[index].m_originId = originId;
+        m_size.store(size + 1U, std::memory_order_release);
+    }
+    else if (index == size)
+    {
+        // the publisher of the least recently recorded histogram is most likely gone, e.g. it was restarted with a
+        // new unique id, therefore its histogram is reused
+        index = leastRecentlyRecordedIndex();
+        auto& histogram = m_histograms[index];
+        histogram.m_originId = originId;
+        for (auto& count : histogram.m_bucketCounts)
+        {
+            count.store(0U, std::memory_order_relaxed);
+        }
+        m_numberOfReassignments.store(m_numberOfReassignments.load(std::memory_order_relaxed) + 1U,
+                                      std::memory_order_relaxed);
+    }
+
+    ++m_numberOfRecords;
+    m_histograms[index].m_lastRecord = m_numberOfRecords;
+    auto& bucketCount = m_histograms[index].m_bucketCounts[bucketIndex(latencyNs)];
+    bucketCount.store(bucketCount.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistograms::leastRecentlyRecordedIndex() const noexcept
+{
+    uint32_t leastRecentIndex{0U};
+    for (uint32_t index = 1U; index < CAPACITY; ++index)
+    {
+        if (m_histograms[index].m_lastRecord < m_histograms[leastRecentIndex].m_lastRecord)
+        {
+            leastRecentIndex = index;
+        }
+    }
+    return leastRecentIndex;
+}
+
+uint32_t LatencyHistograms::size() const noexcept
+{
+    return m_size.load(std::memory_order_acquire);
+}
+
+UniquePortId LatencyHistograms::getOriginId(const uint32_t index) const noexcept
+{
+    if (index >= size())
+    {
+        return UniquePortId(InvalidPortId);
+    }
+    return m_histograms[index].m_originId;
+}
+
+uint64_t LatencyHistograms::getBucketCount(const uint32_t index, const uint32_t bucket) const noexcept
+{
+    if (index >= CAPACITY || bucket >= NUMBER_OF_BUCKETS)
+    {
+        return 0U;
+    }
+    return m_histograms[index].m_bucketCounts[bucket].load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistograms::getNumberOfReassignments() const noexcept
+{
+    return m_numberOfReassignments.load(std::memory_order_relaxed);
+}
+
+} // namespace popo
+} // namespace iox
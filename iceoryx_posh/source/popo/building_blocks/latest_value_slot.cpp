@@ -0,0 +1,124 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// @brief the sequence number which marks a write in progress, if a writer died while writing the sequence number is
+/// already odd and the next write continues with the next odd number
+constexpr uint64_t writeInProgress(const uint64_t sequenceNumber) noexcept
+{
+    return (sequenceNumber + 1U) | 1U;
+}
+
+constexpr bool isWriteInProgress(const uint64_t sequenceNumber) noexcept
+{
+    return (sequenceNumber & 1U) == 1U;
+}
+} // namespace
+
+void LatestValueSlot::store(mepoo::SharedChunk chunk) noexcept
+{
+    const auto sequenceNumber = writeInProgress(m_sequenceNumber.load(std::memory_order_relaxed));
+    m_sequenceNumber.store(sequenceNumber, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto previousChunk = m_chunk.exchange(mepoo::ShmSafeUnmanagedChunk(chunk), std::memory_order_relaxed);
+
+    m_sequenceNumber.store(sequenceNumber + 1U, std::memory_order_release);
+
+    // the previous chunk is released after the write is completed, readers which acquired it in the meantime hold
+    // their own reference
+    previousChunk.releaseToSharedChunk();
+}
+
+void LatestValueSlot::clear() noexcept
+{
+    if (!m_chunk.load(std::memory_order_relaxed).isLogicalNullptr()
+        || isWriteInProgress(m_sequenceNumber.load(std::memory_order_relaxed)))
+    {
+        store(mepoo::SharedChunk());
+    }
+}
+
+cxx::optional<mepoo::SharedChunk> LatestValueSlot::tryAcquire(uint64_t& sequenceNumber) noexcept
+{
+    while (true)
+    {
+        const auto sequenceNumberBeforeRead = m_sequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumberBeforeRead == sequenceNumber || isWriteInProgress(sequenceNumberBeforeRead))
+        {
+            return cxx::nullopt;
+        }
+
+        // the chunk can be replaced and released by the writer at any time, therefore the reference counter is only
+        // incremented if the chunk is still alive
+        auto chunk = m_chunk.load(std::memory_order_relaxed).cloneToSharedChunkIfReferenced();
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequenceNumber.load(std::memory_order_relaxed) == sequenceNumberBeforeRead)
+        {
+            sequenceNumber = sequenceNumberBeforeRead;
+            if (!chunk)
+            {
+                return cxx::nullopt;
+            }
+            return cxx::make_optional<mepoo::SharedChunk>(chunk);
+        }
+        // the writer replaced the chunk in the meantime, the acquired chunk is released and the read is retried
+    }
+}
+
+bool LatestValueSlot::hasNewChunk(const uint64_t sequenceNumber) const noexcept
+{
+    const auto currentSequenceNumber = m_sequenceNumber.load(std::memory_order_acquire);
+    return currentSequenceNumber != sequenceNumber && !isWriteInProgress(currentSequenceNumber)
+           && !m_chunk.load(std::memory_order_relaxed).isLogicalNullptr();
+}
+
+memory::RelativePointerData LatestValueSlot::toRelativePointerData(LatestValueSlot* const slot) noexcept
+{
+    if (slot == nullptr)
+    {
+        return memory::RelativePointerData();
+    }
+    memory::RelativePointer<LatestValueSlot> ptr{slot};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    cxx::Ensures(id <= memory::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(offset <= memory::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+    return memory::RelativePointerData(static_cast<memory::RelativePointerData::identifier_t>(id), offset);
+}
+
+LatestValueSlot* LatestValueSlot::fromRelativePointerData(const memory::RelativePointerData data) noexcept
+{
+    if (data.isLogicalNullptr())
+    {
+        return nullptr;
+    }
+    return memory::RelativePointer<LatestValueSlot>(data.offset(), memory::segment_id_t{data.id()}).get();
+}
+
+} // namespace popo
+} // namespace iox
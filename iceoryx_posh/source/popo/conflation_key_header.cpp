@@ -0,0 +1,40 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/conflation_key_header.hpp"
+
+namespace iox
+{
+namespace popo
+{
+// the user-header is placed directly after the ChunkHeader and its alignment must not exceed the one of the
+// ChunkHeader, therefore the key is sufficiently aligned
+static_assert(alignof(ConflationKeyHeader) <= alignof(mepoo::ChunkHeader),
+              "The ConflationKeyHeader must be usable as user-header");
+
+constexpr uint16_t ConflationKeyHeader::USER_HEADER_ID;
+
+cxx::optional<uint64_t> ConflationKeyHeader::fromChunkHeader(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    if (chunkHeader.userHeaderId() != USER_HEADER_ID || chunkHeader.userHeaderSize() < sizeof(ConflationKeyHeader))
+    {
+        return cxx::nullopt;
+    }
+    return static_cast<const ConflationKeyHeader*>(chunkHeader.userHeader())->key;
+}
+
+} // namespace popo
+} // namespace iox
@@ -48,6 +48,20 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+cxx::expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateSegment(const mepoo::ChunkHeader* const messageChunkHeader,
+                                      const uint32_t userPayloadSize,
+                                      const uint32_t userPayloadAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateSegment(messageChunkHeader, userPayloadSize, userPayloadAlignment);
+}
+
+cxx::expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAdoptChunk(mepoo::SharedChunk&& chunk) noexcept
+{
+    return m_chunkSender.tryAdopt(getUniqueID(), std::move(chunk));
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -76,6 +90,14 @@ cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk(
     return m_chunkSender.tryGetPreviousChunk();
 }
 
+void PublisherPortUser::resendPreviousChunk() noexcept
+{
+    if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
+    {
+        m_chunkSender.resendPreviousChunk();
+    }
+}
+
 void PublisherPortUser::offer() noexcept
 {
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
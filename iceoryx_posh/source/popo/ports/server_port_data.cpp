@@ -35,7 +35,11 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
                                mepoo::MemoryManager* const memoryManager,
                                const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, serverOptions.nodeName)
-    , m_chunkSenderData(memoryManager, serverOptions.clientTooSlowPolicy, HISTORY_REQUEST_OF_ZERO, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        serverOptions.clientTooSlowPolicy,
+                        HISTORY_REQUEST_OF_ZERO,
+                        memoryInfo,
+                        serverOptions.mempoolReservation)
     , m_chunkReceiverData(
           getRequestQueueType(serverOptions.requestQueueFullPolicy), serverOptions.requestQueueFullPolicy, memoryInfo)
     , m_offeringRequested(serverOptions.offerOnCreate)
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
 namespace iox
@@ -28,11 +29,19 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
                                        const SubscriberOptions& subscriberOptions,
                                        const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, subscriberOptions.nodeName)
-    , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo)
+    , m_chunkReceiverData(
+          queueType, subscriberOptions.queueFullPolicy, memoryInfo, subscriberOptions.queueConflationPolicy)
     , m_options{subscriberOptions}
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(subscriberOptions.queueCapacity);
+    m_chunkReceiverData.m_userHeaderFilter = subscriberOptions.userHeaderFilter;
+    m_chunkReceiverData.m_deliveryRateLimiter.configure(subscriberOptions.deliveryDecimation,
+                                                        subscriberOptions.minimumDeliveryInterval);
+    m_chunkReceiverData.m_maximumSampleAgeNs = subscriberOptions.maximumSampleAge.toNanoseconds();
+    // the deadline starts with the creation of the subscriber
+    m_chunkReceiverData.m_deadlineNs = subscriberOptions.deadline.toNanoseconds();
+    m_chunkReceiverData.m_lastArrivalTimestampNs.store(mepoo::monotonicTimestamp(), std::memory_order_relaxed);
 }
 
 } // namespace popo
@@ -47,5 +47,25 @@ void SubscriberPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool SubscriberPortRouDi::notifyOnMissedDeadline() noexcept
+{
+    return m_chunkReceiver.notifyOnMissedDeadline();
+}
+
+bool SubscriberPortRouDi::hasInlineSlots() const noexcept
+{
+    return m_chunkReceiver.hasInlineSlots();
+}
+
+void SubscriberPortRouDi::attachInlineSlots(cxx::not_null<InlineSlots* const> inlineSlots) noexcept
+{
+    m_chunkReceiver.attachInlineSlots(inlineSlots);
+}
+
+InlineSlots* SubscriberPortRouDi::detachInlineSlots() noexcept
+{
+    return m_chunkReceiver.detachInlineSlots();
+}
+
 } // namespace popo
 } // namespace iox
@@ -73,6 +73,12 @@ void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeade
     m_chunkReceiver.release(chunkHeader);
 }
 
+cxx::expected<mepoo::SharedChunk, ChunkReleaseResult>
+SubscriberPortUser::releaseChunkToSharedChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    return m_chunkReceiver.releaseToSharedChunk(chunkHeader);
+}
+
 void SubscriberPortUser::releaseQueuedChunks() noexcept
 {
     m_chunkReceiver.clear();
@@ -88,12 +94,28 @@ bool SubscriberPortUser::hasLostChunksSinceLastCall() noexcept
     return m_chunkReceiver.hasLostChunks();
 }
 
+bool SubscriberPortUser::hasMissedDeadline() const noexcept
+{
+    return m_chunkReceiver.hasMissedDeadline();
+}
+
+uint64_t SubscriberPortUser::numberOfExpiredChunks() const noexcept
+{
+    return m_chunkReceiver.numberOfExpiredChunks();
+}
+
 void SubscriberPortUser::setConditionVariable(ConditionVariableData& conditionVariableData,
                                               const uint64_t notificationIndex) noexcept
 {
     m_chunkReceiver.setConditionVariable(conditionVariableData, notificationIndex);
 }
 
+void SubscriberPortUser::setConditionVariableForMissedDeadline(ConditionVariableData& conditionVariableData,
+                                                               const uint64_t notificationIndex) noexcept
+{
+    m_chunkReceiver.setConditionVariableForMissedDeadline(conditionVariableData, notificationIndex);
+}
+
 void SubscriberPortUser::unsetConditionVariable() noexcept
 {
     m_chunkReceiver.unsetConditionVariable();
@@ -27,7 +27,8 @@ cxx::Serialization ServerOptions::serialize() const noexcept
                                       nodeName,
                                       offerOnCreate,
                                       static_cast<std::underlying_type_t<QueueFullPolicy>>(requestQueueFullPolicy),
-                                      static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy));
+                                      static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy),
+                                      mempoolReservation);
 }
 
 cxx::expected<ServerOptions, cxx::Serialization::Error>
@@ -44,7 +45,8 @@ ServerOptions::deserialize(const cxx::Serialization& serialized) noexcept
                                                         serverOptions.nodeName,
                                                         serverOptions.offerOnCreate,
                                                         requestQueueFullPolicy,
-                                                        clientTooSlowPolicy);
+                                                        clientTooSlowPolicy,
+                                                        serverOptions.mempoolReservation);
 
     if (!deserializationSuccessful
         || requestQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -63,7 +65,7 @@ bool ServerOptions::operator==(const ServerOptions& rhs) const noexcept
 {
     return requestQueueCapacity == rhs.requestQueueCapacity && nodeName == rhs.nodeName
            && offerOnCreate == rhs.offerOnCreate && requestQueueFullPolicy == rhs.requestQueueFullPolicy
-           && clientTooSlowPolicy == rhs.clientTooSlowPolicy;
+           && clientTooSlowPolicy == rhs.clientTooSlowPolicy && mempoolReservation == rhs.mempoolReservation;
 }
 } // namespace popo
 } // namespace iox
@@ -23,36 +23,76 @@ namespace popo
 {
 cxx::Serialization SubscriberOptions::serialize() const noexcept
 {
-    return cxx::Serialization::create(queueCapacity,
-                                      historyRequest,
-                                      nodeName,
-                                      subscribeOnCreate,
-                                      static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                      requiresPublisherHistorySupport);
+    return cxx::Serialization::create(
+        queueCapacity,
+        historyRequest,
+        nodeName,
+        subscribeOnCreate,
+        static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
+        requiresPublisherHistorySupport,
+        static_cast<std::underlying_type_t<QueueConflationPolicy>>(queueConflationPolicy),
+        static_cast<std::underlying_type_t<UserHeaderFilter::Operation>>(userHeaderFilter.operation),
+        userHeaderFilter.fieldOffset,
+        userHeaderFilter.fieldSize,
+        userHeaderFilter.firstOperand,
+        userHeaderFilter.secondOperand,
+        deliveryDecimation,
+        minimumDeliveryInterval.toNanoseconds(),
+        maximumSampleAge.toNanoseconds(),
+        deadline.toNanoseconds());
 }
 
 cxx::expected<SubscriberOptions, cxx::Serialization::Error>
 SubscriberOptions::deserialize(const cxx::Serialization& serialized) noexcept
 {
     using QueueFullPolicyUT = std::underlying_type_t<QueueFullPolicy>;
+    using QueueConflationPolicyUT = std::underlying_type_t<QueueConflationPolicy>;
+    using FilterOperationUT = std::underlying_type_t<UserHeaderFilter::Operation>;
 
     SubscriberOptions subscriberOptions;
     QueueFullPolicyUT queueFullPolicy;
+    QueueConflationPolicyUT queueConflationPolicy;
+    FilterOperationUT filterOperation;
+    uint64_t minimumDeliveryIntervalNs;
+    uint64_t maximumSampleAgeNs;
+    uint64_t deadlineNs;
 
     auto deserializationSuccessful = serialized.extract(subscriberOptions.queueCapacity,
                                                         subscriberOptions.historyRequest,
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        queueConflationPolicy,
+                                                        filterOperation,
+                                                        subscriberOptions.userHeaderFilter.fieldOffset,
+                                                        subscriberOptions.userHeaderFilter.fieldSize,
+                                                        subscriberOptions.userHeaderFilter.firstOperand,
+                                                        subscriberOptions.userHeaderFilter.secondOperand,
+                                                        subscriberOptions.deliveryDecimation,
+                                                        minimumDeliveryIntervalNs,
+                                                        maximumSampleAgeNs,
+                                                        deadlineNs);
 
     if (!deserializationSuccessful
-        || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
+        || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
+        || queueConflationPolicy > static_cast<QueueConflationPolicyUT>(QueueConflationPolicy::KEEP_LATEST_PER_KEY)
+        || filterOperation > static_cast<FilterOperationUT>(UserHeaderFilter::Operation::ANY_BIT_SET))
+    {
+        return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+    }
+
+    subscriberOptions.userHeaderFilter.operation = static_cast<UserHeaderFilter::Operation>(filterOperation);
+    if (!subscriberOptions.userHeaderFilter.isValid())
     {
         return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     subscriberOptions.queueFullPolicy = static_cast<QueueFullPolicy>(queueFullPolicy);
+    subscriberOptions.queueConflationPolicy = static_cast<QueueConflationPolicy>(queueConflationPolicy);
+    subscriberOptions.minimumDeliveryInterval = units::Duration::fromNanoseconds(minimumDeliveryIntervalNs);
+    subscriberOptions.maximumSampleAge = units::Duration::fromNanoseconds(maximumSampleAgeNs);
+    subscriberOptions.deadline = units::Duration::fromNanoseconds(deadlineNs);
     return cxx::success<SubscriberOptions>(subscriberOptions);
 }
 } // namespace popo
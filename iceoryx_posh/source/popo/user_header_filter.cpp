@@ -0,0 +1,150 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+static_assert(std::is_trivially_copyable<UserHeaderFilter>::value,
+              "The UserHeaderFilter is stored in the shared memory and must be trivially copyable");
+
+namespace
+{
+constexpr bool isValidFieldSize(const uint32_t fieldSize) noexcept
+{
+    return fieldSize == sizeof(uint8_t) || fieldSize == sizeof(uint16_t) || fieldSize == sizeof(uint32_t)
+           || fieldSize == sizeof(uint64_t);
+}
+
+template <typename T>
+uint64_t readField(const void* const field) noexcept
+{
+    // the field is not necessarily aligned, therefore it is copied instead of dereferenced
+    T value{0U};
+    std::memcpy(&value, field, sizeof(T));
+    return value;
+}
+
+UserHeaderFilter
+create(const UserHeaderFilter::Operation operation, const uint32_t fieldOffset, const uint32_t fieldSize) noexcept
+{
+    cxx::Expects(isValidFieldSize(fieldSize) && "The field size must be 1, 2, 4 or 8!");
+    UserHeaderFilter filter;
+    filter.operation = operation;
+    filter.fieldOffset = fieldOffset;
+    filter.fieldSize = fieldSize;
+    return filter;
+}
+} // namespace
+
+UserHeaderFilter
+UserHeaderFilter::equalTo(const uint32_t fieldOffset, const uint32_t fieldSize, const uint64_t value) noexcept
+{
+    auto filter = create(Operation::EQUAL_TO, fieldOffset, fieldSize);
+    filter.firstOperand = value;
+    return filter;
+}
+
+UserHeaderFilter UserHeaderFilter::inRange(const uint32_t fieldOffset,
+                                           const uint32_t fieldSize,
+                                           const uint64_t min,
+                                           const uint64_t max) noexcept
+{
+    auto filter = create(Operation::IN_RANGE, fieldOffset, fieldSize);
+    filter.firstOperand = min;
+    filter.secondOperand = max;
+    return filter;
+}
+
+UserHeaderFilter
+UserHeaderFilter::anyBitSet(const uint32_t fieldOffset, const uint32_t fieldSize, const uint64_t mask) noexcept
+{
+    auto filter = create(Operation::ANY_BIT_SET, fieldOffset, fieldSize);
+    filter.firstOperand = mask;
+    return filter;
+}
+
+bool UserHeaderFilter::isValid() const noexcept
+{
+    switch (operation)
+    {
+    case Operation::ACCEPT_ALL:
+        return true;
+    case Operation::EQUAL_TO:
+    case Operation::IN_RANGE:
+    case Operation::ANY_BIT_SET:
+        return isValidFieldSize(fieldSize);
+    }
+    return false;
+}
+
+bool UserHeaderFilter::accepts(const mepoo::ChunkHeader& chunkHeader) const noexcept
+{
+    if (operation == Operation::ACCEPT_ALL)
+    {
+        return true;
+    }
+
+    if (chunkHeader.userHeaderId() == mepoo::ChunkHeader::NO_USER_HEADER
+        || static_cast<uint64_t>(fieldOffset) + fieldSize > chunkHeader.userHeaderSize())
+    {
+        return false;
+    }
+
+    // NOLINTJUSTIFICATION the field offset was checked against the user-header size
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto* field = static_cast<const uint8_t*>(chunkHeader.userHeader()) + fieldOffset;
+    uint64_t value{0U};
+    switch (fieldSize)
+    {
+    case sizeof(uint8_t):
+        value = readField<uint8_t>(field);
+        break;
+    case sizeof(uint16_t):
+        value = readField<uint16_t>(field);
+        break;
+    case sizeof(uint32_t):
+        value = readField<uint32_t>(field);
+        break;
+    case sizeof(uint64_t):
+        value = readField<uint64_t>(field);
+        break;
+    default:
+        return false;
+    }
+
+    switch (operation)
+    {
+    case Operation::EQUAL_TO:
+        return value == firstOperand;
+    case Operation::IN_RANGE:
+        return firstOperand <= value && value <= secondOperand;
+    case Operation::ANY_BIT_SET:
+        return (value & firstOperand) != 0U;
+    case Operation::ACCEPT_ALL:
+        return true;
+    }
+    return false;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,151 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/roudi/mempool_sizing_advisor.hpp"
+
+#include "iceoryx_platform/getopt.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace
+{
+void printHelp(const char* name) noexcept
+{
+    std::cout << "Usage: " << name << " [options] <RECORDING>" << std::endl;
+    std::cout << "Derives a RouDi mempool configuration from a chunk size recording of a segment." << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "-h, --help                        Display help." << std::endl;
+    std::cout << "-b, --memory-budget <UINT>        Maximum memory of the segment in bytes." << std::endl;
+    std::cout << "                                  default = 0 (unlimited)" << std::endl;
+    std::cout << "-n, --max-mempools <UINT>         Maximum number of mempools." << std::endl;
+    std::cout << "                                  default = " << iox::MAX_NUMBER_OF_MEMPOOLS << std::endl;
+    std::cout << "-r, --headroom <UINT>             Additional chunks on top of the recorded peak usage in percent."
+              << std::endl;
+    std::cout << "                                  default = 25" << std::endl;
+    std::cout << "-o, --output <FILE>               Write the TOML config to this file instead of stdout." << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[]) noexcept
+{
+    using iox::roudi::ChunkSizeStatistics;
+    using iox::roudi::MemPoolSizingAdvisor;
+
+    constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
+                                       {"memory-budget", required_argument, nullptr, 'b'},
+                                       {"max-mempools", required_argument, nullptr, 'n'},
+                                       {"headroom", required_argument, nullptr, 'r'},
+                                       {"output", required_argument, nullptr, 'o'},
+                                       {nullptr, 0, nullptr, 0}};
+    constexpr const char* SHORT_OPTIONS = "hb:n:r:o:";
+
+    MemPoolSizingAdvisor::Options options;
+    std::string outputPath;
+    int32_t index;
+    int32_t opt{-1};
+    while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp(argv[0]);
+            return EXIT_SUCCESS;
+        case 'b':
+            if (!iox::cxx::convert::fromString(optarg, options.m_memoryBudget))
+            {
+                std::cerr << "The memory budget must be an unsigned integer" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'n':
+            if (!iox::cxx::convert::fromString(optarg, options.m_maxNumberOfMemPools)
+                || options.m_maxNumberOfMemPools == 0U || options.m_maxNumberOfMemPools > iox::MAX_NUMBER_OF_MEMPOOLS)
+            {
+                std::cerr << "The maximum number of mempools must be in the range of [1, "
+                          << iox::MAX_NUMBER_OF_MEMPOOLS << "]" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'r':
+            if (!iox::cxx::convert::fromString(optarg, options.m_headroomPercent))
+            {
+                std::cerr << "The headroom must be an unsigned integer" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            outputPath = optarg;
+            break;
+        default:
+            printHelp(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind + 1 != argc)
+    {
+        printHelp(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream recordingFile(argv[optind]);
+    if (!recordingFile)
+    {
+        std::cerr << "Unable to open the chunk size recording " << argv[optind] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto statistics = ChunkSizeStatistics::readFrom(recordingFile);
+    if (statistics.has_error())
+    {
+        std::cerr << "The chunk size recording " << argv[optind]
+                  << ((statistics.get_error() == ChunkSizeStatistics::Error::UNSUPPORTED_VERSION)
+                          ? " has an unsupported version"
+                          : " is malformed")
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (statistics.value().getNumberOfRequests() == 0U)
+    {
+        std::cerr << "The chunk size recording " << argv[optind] << " contains no requests" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto advice = MemPoolSizingAdvisor::advise(statistics.value(), options);
+    if (!advice.m_fitsIntoBudget)
+    {
+        std::cerr << "The memory budget of " << options.m_memoryBudget
+                  << " bytes is exceeded, the configuration requires " << advice.m_requiredMemorySize << " bytes"
+                  << std::endl;
+    }
+
+    if (outputPath.empty())
+    {
+        MemPoolSizingAdvisor::writeToml(advice, std::cout);
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream outputFile(outputPath);
+    MemPoolSizingAdvisor::writeToml(advice, outputFile);
+    if (!outputFile)
+    {
+        std::cerr << "Unable to write the configuration to " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
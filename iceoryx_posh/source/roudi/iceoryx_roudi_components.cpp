@@ -23,19 +23,21 @@ namespace roudi
 {
 IceOryxRouDiComponents::IceOryxRouDiComponents(const RouDiConfig_t& roudiConfig) noexcept
     : rouDiMemoryManager(roudiConfig)
-    , portManager([&]() -> IceOryxRouDiMemoryManager* {
-        // this temporary object will create a roudi IPC channel
-        // and close it immediatelly
-        // if there was an outdated roudi IPC channel, it will be cleaned up
-        // if there is an outdated IPC channel, the start of the apps will be terminated
-        runtime::IpcInterfaceBase::cleanupOutdatedIpcChannel(roudi::IPC_CHANNEL_ROUDI_NAME);
+    , portManager(
+          [&]() -> IceOryxRouDiMemoryManager* {
+              // this temporary object will create a roudi IPC channel
+              // and close it immediatelly
+              // if there was an outdated roudi IPC channel, it will be cleaned up
+              // if there is an outdated IPC channel, the start of the apps will be terminated
+              runtime::IpcInterfaceBase::cleanupOutdatedIpcChannel(roudi::IPC_CHANNEL_ROUDI_NAME);
 
-        rouDiMemoryManager.createAndAnnounceMemory().or_else([](RouDiMemoryManagerError error) {
-            LogFatal() << "Could not create SharedMemory! Error: " << error;
-            errorHandler(PoshError::ROUDI_COMPONENTS__SHARED_MEMORY_UNAVAILABLE, iox::ErrorLevel::FATAL);
-        });
-        return &rouDiMemoryManager;
-    }())
+              rouDiMemoryManager.createAndAnnounceMemory().or_else([](RouDiMemoryManagerError error) {
+                  LogFatal() << "Could not create SharedMemory! Error: " << error;
+                  errorHandler(PoshError::ROUDI_COMPONENTS__SHARED_MEMORY_UNAVAILABLE, iox::ErrorLevel::FATAL);
+              });
+              return &rouDiMemoryManager;
+          }(),
+          roudiConfig.m_latencyIntrospection)
 {
 }
 
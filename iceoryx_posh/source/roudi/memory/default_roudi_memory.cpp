@@ -17,28 +17,78 @@
 
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 
+#include <type_traits>
+
 namespace iox
 {
 namespace roudi
 {
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
-    : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
+    : m_introspectionMemPoolBlock(introspectionMemPoolConfig(roudiConfig.m_latencyIntrospection))
     , m_segmentManagerBlock(roudiConfig)
     , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
+    , m_managementMemfd(SHM_NAME)
+    , m_useMemfdManagementMemory(useMemfdManagementMemory(roudiConfig))
 {
-    m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
+    managementMemoryProvider().addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
                      ErrorLevel::FATAL);
     });
-    m_managementShm.addMemoryBlock(&m_segmentManagerBlock).or_else([](auto) {
+    managementMemoryProvider().addMemoryBlock(&m_segmentManagerBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_SEGMENT_MANAGER_MEMORY_BLOCK,
                      ErrorLevel::FATAL);
     });
 }
-mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexcept
+
+bool DefaultRouDiMemory::useMemfdManagementMemory(const RouDiConfig_t& roudiConfig) noexcept
+{
+    if (!roudiConfig.m_memfdManagementMemory)
+    {
+        return false;
+    }
+
+    // the file descriptor is passed with the registration acknowledgement, which only unix domain sockets can carry
+    constexpr bool IS_SUPPORTED{platform::IOX_SUPPORT_MEMFD
+                                && std::is_same<platform::IoxIpcChannelType, posix::UnixDomainSocket>::value};
+    if (!IS_SUPPORTED)
+    {
+        LogWarn() << "The management memory cannot be a memfd on this platform, a named shared memory is used instead";
+    }
+    return IS_SUPPORTED;
+}
+
+MemoryProvider& DefaultRouDiMemory::managementMemoryProvider() noexcept
+{
+    if (m_useMemfdManagementMemory)
+    {
+        return m_managementMemfd;
+    }
+    return m_managementShm;
+}
+
+const MemoryProvider& DefaultRouDiMemory::managementMemoryProvider() const noexcept
+{
+    if (m_useMemfdManagementMemory)
+    {
+        return m_managementMemfd;
+    }
+    return m_managementShm;
+}
+
+cxx::optional<int32_t> DefaultRouDiMemory::managementMemoryFileDescriptor() const noexcept
+{
+    if (m_useMemfdManagementMemory)
+    {
+        return m_managementMemfd.getFileDescriptor();
+    }
+    return cxx::nullopt;
+}
+mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const bool latencyIntrospection) const noexcept
 {
     constexpr uint32_t ALIGNMENT{mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT};
     // have some spare chunks to still deliver introspection data in case there are multiple subscriber to the data
@@ -58,6 +108,12 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    if (latencyIntrospection)
+    {
+        mempoolConfig.m_mempoolConfig.push_back(
+            {cxx::align(static_cast<uint32_t>(sizeof(roudi::SubscriberLatencyIntrospectionFieldTopic)), ALIGNMENT),
+             CHUNK_COUNT});
+    }
 
     mempoolConfig.optimize();
     return mempoolConfig;
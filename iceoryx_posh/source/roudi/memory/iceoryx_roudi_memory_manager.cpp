@@ -24,10 +24,10 @@ namespace roudi
 IceOryxRouDiMemoryManager::IceOryxRouDiMemoryManager(const RouDiConfig_t& roudiConfig) noexcept
     : m_defaultMemory(roudiConfig)
 {
-    m_defaultMemory.m_managementShm.addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
+    m_defaultMemory.managementMemoryProvider().addMemoryBlock(&m_portPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ICEORYX_ROUDI_MEMORY_MANAGER__FAILED_TO_ADD_PORTPOOL_MEMORY_BLOCK, ErrorLevel::FATAL);
     });
-    m_memoryManager.addMemoryProvider(&m_defaultMemory.m_managementShm).or_else([](auto) {
+    m_memoryManager.addMemoryProvider(&m_defaultMemory.managementMemoryProvider()).or_else([](auto) {
         errorHandler(PoshError::ICEORYX_ROUDI_MEMORY_MANAGER__FAILED_TO_ADD_MANAGEMENT_MEMORY_BLOCK, ErrorLevel::FATAL);
     });
 }
@@ -48,9 +48,14 @@ cxx::expected<RouDiMemoryManagerError> IceOryxRouDiMemoryManager::destroyMemory(
     return m_memoryManager.destroyMemory();
 }
 
-const PosixShmMemoryProvider* IceOryxRouDiMemoryManager::mgmtMemoryProvider() const noexcept
+const MemoryProvider* IceOryxRouDiMemoryManager::mgmtMemoryProvider() const noexcept
 {
-    return &m_defaultMemory.m_managementShm;
+    return &m_defaultMemory.managementMemoryProvider();
+}
+
+cxx::optional<int32_t> IceOryxRouDiMemoryManager::mgmtMemoryFileDescriptor() const noexcept
+{
+    return m_defaultMemory.managementMemoryFileDescriptor();
 }
 
 cxx::optional<PortPool*> IceOryxRouDiMemoryManager::portPool() noexcept
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 by agent. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/memory/memfd_memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/unistd.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr int32_t MemfdMemoryProvider::INVALID_FD;
+
+MemfdMemoryProvider::MemfdMemoryProvider(const ShmName_t& name) noexcept
+    : m_name(name)
+{
+}
+
+MemfdMemoryProvider::~MemfdMemoryProvider() noexcept
+{
+    if (isAvailable())
+    {
+        destroy().or_else([](auto) { LogWarn() << "failed to cleanup memfd memory provider resources"; });
+    }
+}
+
+cxx::optional<int32_t> MemfdMemoryProvider::getFileDescriptor() const noexcept
+{
+    if (m_fileDescriptor == INVALID_FD)
+    {
+        return cxx::nullopt;
+    }
+    return m_fileDescriptor;
+}
+
+cxx::expected<void*, MemoryProviderError> MemfdMemoryProvider::createMemory(const uint64_t size,
+                                                                            const uint64_t alignment) noexcept
+{
+    if (alignment > posix::pageSize())
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE);
+    }
+
+    auto memfdCall = posix::posixCall(iox_memfd_create)(m_name.c_str()).failureReturnValue(INVALID_FD).evaluate();
+    if (memfdCall.has_error())
+    {
+        LogError() << "Unable to create the memory file [" << m_name << "]";
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
+    }
+    m_fileDescriptor = memfdCall->value;
+
+    // the memory file is sealed after it got its size, this way no process which receives the file descriptor can
+    // shrink the memory and cause a SIGBUS in the other processes
+    if (posix::posixCall(ftruncate)(m_fileDescriptor, static_cast<off_t>(size))
+            .failureReturnValue(-1)
+            .evaluate()
+            .has_error()
+        || posix::posixCall(iox_memfd_seal)(m_fileDescriptor).failureReturnValue(-1).evaluate().has_error())
+    {
+        LogError() << "Unable to set the size of the memory file [" << m_name << "] to " << size << " bytes";
+        closeFileDescriptor();
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_ALLOCATION_FAILED);
+    }
+
+    auto memoryMap = posix::MemoryMapBuilder()
+                         .length(size)
+                         .fileDescriptor(m_fileDescriptor)
+                         .accessMode(posix::AccessMode::READ_WRITE)
+                         .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+                         .offset(0)
+                         .create();
+    if (!memoryMap)
+    {
+        LogError() << "Unable to map the memory file [" << m_name << "]";
+        closeFileDescriptor();
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_MAPPING_FAILED);
+    }
+    m_memoryMap.emplace(std::move(memoryMap.value()));
+
+    return cxx::success<void*>(m_memoryMap->getBaseAddress());
+}
+
+cxx::expected<MemoryProviderError> MemfdMemoryProvider::destroyMemory() noexcept
+{
+    m_memoryMap.reset();
+    if (!closeFileDescriptor())
+    {
+        return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_DESTRUCTION_FAILED);
+    }
+    return cxx::success<void>();
+}
+
+bool MemfdMemoryProvider::closeFileDescriptor() noexcept
+{
+    if (m_fileDescriptor == INVALID_FD)
+    {
+        return true;
+    }
+
+    auto closeCall = posix::posixCall(iox_close)(m_fileDescriptor).failureReturnValue(-1).evaluate();
+    m_fileDescriptor = INVALID_FD;
+    return !closeCall.has_error();
+}
+
+} // namespace roudi
+} // namespace iox
@@ -18,6 +18,10 @@
 #include "iceoryx_posh/internal/roudi/memory/mempool_segment_manager_memory_block.hpp"
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/roudi/mempool_sizing_advisor.hpp"
+
+#include <fstream>
 
 namespace iox
 {
@@ -57,11 +61,38 @@ void MemPoolSegmentManagerMemoryBlock::destroy() noexcept
 {
     if (m_segmentManager)
     {
+        writeChunkSizeRecordings();
         m_segmentManager->~SegmentManager<>();
         m_segmentManager = nullptr;
     }
 }
 
+void MemPoolSegmentManagerMemoryBlock::writeChunkSizeRecordings() const noexcept
+{
+    for (uint64_t i = 0U; i < m_segmentConfig.m_sharedMemorySegments.size(); ++i)
+    {
+        const auto& segmentEntry = m_segmentConfig.m_sharedMemorySegments[i];
+        if (!segmentEntry.m_chunkSizeRecordingFile.has_value())
+        {
+            continue;
+        }
+
+        m_segmentManager->getMemoryManagerOfConfiguredSegment(i).and_then([&](auto memoryManager) {
+            const auto& path = segmentEntry.m_chunkSizeRecordingFile.value();
+            std::ofstream recordingFile(path.c_str());
+            ChunkSizeStatistics::fromMemoryManager(*memoryManager).writeTo(recordingFile);
+            if (!recordingFile)
+            {
+                LogWarn() << "Unable to write the chunk size recording of the segment with the writer group "
+                          << segmentEntry.m_writerGroup << " to " << path;
+                return;
+            }
+            LogInfo() << "Wrote the chunk size recording of the segment with the writer group "
+                      << segmentEntry.m_writerGroup << " to " << path;
+        });
+    }
+}
+
 cxx::optional<mepoo::SegmentManager<>*> MemPoolSegmentManagerMemoryBlock::segmentManager() const noexcept
 {
     return m_segmentManager ? cxx::make_optional<mepoo::SegmentManager<>*>(m_segmentManager) : cxx::nullopt_t();
@@ -0,0 +1,351 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/mempool_sizing_advisor.hpp"
+
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t ChunkSizeStatistics::FORMAT_VERSION;
+
+namespace
+{
+constexpr const char* FORMAT_IDENTIFIER{"iceoryx-chunk-size-recording"};
+constexpr uint32_t MAX_NUMBER_OF_DEMANDS{mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS};
+
+/// @brief the chunks of a specific chunk size which are required at the same time
+struct Demand
+{
+    uint32_t m_chunkSize{0U};
+    uint64_t m_chunks{0U};
+};
+
+uint64_t estimateRequiredChunks(const ChunkSizeStatistics& statistics,
+                                const ChunkSizeStatistics::Bucket& bucket) noexcept
+{
+    for (const auto& memPool : statistics.m_memPools)
+    {
+        if (memPool.m_chunkSize < bucket.m_maxChunkSize)
+        {
+            continue;
+        }
+        if (memPool.m_requests == 0U)
+        {
+            break;
+        }
+        // the failed requests would have required additional chunks, the peak is scaled up accordingly
+        const auto servedRequests = algorithm::maxVal<uint64_t>(1U, memPool.m_requests - memPool.m_failedRequests);
+        const auto peakDemand = static_cast<double>(memPool.m_peakUsedChunks)
+                                * static_cast<double>(memPool.m_requests) / static_cast<double>(servedRequests);
+        const auto bucketShare = static_cast<double>(bucket.m_count) / static_cast<double>(memPool.m_requests);
+        return algorithm::maxVal<uint64_t>(1U, static_cast<uint64_t>(std::ceil(peakDemand * bucketShare)));
+    }
+    // there is no usage watermark for the requests which were not served by a mempool
+    return 1U;
+}
+} // namespace
+
+ChunkSizeStatistics ChunkSizeStatistics::fromMemoryManager(const mepoo::MemoryManager& memoryManager) noexcept
+{
+    ChunkSizeStatistics statistics;
+    uint64_t bucketCounts[mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS]{};
+    uint32_t bucketMaxChunkSizes[mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS]{};
+
+    for (auto manager = &memoryManager; manager != nullptr; manager = manager->getOverflowMemoryManager())
+    {
+        const auto recording = manager->getChunkSizeRecording();
+        if (recording == nullptr)
+        {
+            break;
+        }
+
+        for (uint32_t i = 0U; i < mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS; ++i)
+        {
+            const auto bucket = recording->getBucket(i);
+            bucketCounts[i] += bucket.m_count;
+            bucketMaxChunkSizes[i] = algorithm::maxVal(bucketMaxChunkSizes[i], bucket.m_maxChunkSize);
+        }
+        statistics.m_requestsWithoutMemPool += recording->getRequestsWithoutMemPool();
+
+        // an overflow memory manager has the same mempools as the memory manager it extends
+        uint64_t memPoolIndex{0U};
+        for (uint32_t i = 0U; i < manager->getNumberOfMemPools(); ++i)
+        {
+            if (manager->getMemPoolReservation(i) != mepoo::NO_MEMPOOL_RESERVATION)
+            {
+                continue;
+            }
+            if (memPoolIndex == statistics.m_memPools.size())
+            {
+                statistics.m_memPools.emplace_back();
+            }
+            auto& memPool = statistics.m_memPools[memPoolIndex];
+            ++memPoolIndex;
+
+            const auto info = manager->getMemPoolInfo(i);
+            const auto counters = recording->getMemPoolCounters(i);
+            memPool.m_chunkSize = info.m_chunkSize;
+            memPool.m_chunkCount += info.m_numChunks;
+            memPool.m_peakUsedChunks += info.m_numChunks - info.m_minFreeChunks;
+            memPool.m_requests += counters.m_requests;
+            memPool.m_wastedBytes += counters.m_wastedBytes;
+            memPool.m_failedRequests += counters.m_failedRequests;
+        }
+    }
+
+    for (uint32_t i = 0U; i < mepoo::ChunkSizeRecording::NUMBER_OF_BUCKETS; ++i)
+    {
+        if (bucketCounts[i] != 0U)
+        {
+            statistics.m_buckets.emplace_back(Bucket{bucketMaxChunkSizes[i], bucketCounts[i]});
+        }
+    }
+
+    return statistics;
+}
+
+void ChunkSizeStatistics::writeTo(std::ostream& stream) const noexcept
+{
+    stream << FORMAT_IDENTIFIER << " " << FORMAT_VERSION << "\n";
+    stream << "requests-without-mempool " << m_requestsWithoutMemPool << "\n";
+    for (const auto& memPool : m_memPools)
+    {
+        stream << "mempool " << memPool.m_chunkSize << " " << memPool.m_chunkCount << " " << memPool.m_peakUsedChunks
+               << " " << memPool.m_requests << " " << memPool.m_wastedBytes << " " << memPool.m_failedRequests << "\n";
+    }
+    for (const auto& bucket : m_buckets)
+    {
+        stream << "bucket " << bucket.m_maxChunkSize << " " << bucket.m_count << "\n";
+    }
+}
+
+cxx::expected<ChunkSizeStatistics, ChunkSizeStatistics::Error>
+ChunkSizeStatistics::readFrom(std::istream& stream) noexcept
+{
+    std::string keyword;
+    uint32_t version{0U};
+    if (!(stream >> keyword >> version) || keyword != FORMAT_IDENTIFIER)
+    {
+        return cxx::error<Error>(Error::INVALID_FORMAT);
+    }
+    if (version != FORMAT_VERSION)
+    {
+        return cxx::error<Error>(Error::UNSUPPORTED_VERSION);
+    }
+
+    ChunkSizeStatistics statistics;
+    while (stream >> keyword)
+    {
+        if (keyword == "requests-without-mempool")
+        {
+            stream >> statistics.m_requestsWithoutMemPool;
+        }
+        else if (keyword == "mempool")
+        {
+            MemPool memPool;
+            stream >> memPool.m_chunkSize >> memPool.m_chunkCount >> memPool.m_peakUsedChunks >> memPool.m_requests
+                >> memPool.m_wastedBytes >> memPool.m_failedRequests;
+            // the mempools must be ordered by increasing chunk size like in the MePooConfig
+            if (!statistics.m_memPools.empty() && statistics.m_memPools.back().m_chunkSize >= memPool.m_chunkSize)
+            {
+                return cxx::error<Error>(Error::INVALID_FORMAT);
+            }
+            if (!statistics.m_memPools.push_back(memPool))
+            {
+                return cxx::error<Error>(Error::INVALID_FORMAT);
+            }
+        }
+        else if (keyword == "bucket")
+        {
+            Bucket bucket;
+            stream >> bucket.m_maxChunkSize >> bucket.m_count;
+            if (!statistics.m_buckets.empty() && statistics.m_buckets.back().m_maxChunkSize >= bucket.m_maxChunkSize)
+            {
+                return cxx::error<Error>(Error::INVALID_FORMAT);
+            }
+            if (!statistics.m_buckets.push_back(bucket))
+            {
+                return cxx::error<Error>(Error::INVALID_FORMAT);
+            }
+        }
+        else
+        {
+            return cxx::error<Error>(Error::INVALID_FORMAT);
+        }
+
+        if (stream.fail())
+        {
+            return cxx::error<Error>(Error::INVALID_FORMAT);
+        }
+    }
+
+    return cxx::success<ChunkSizeStatistics>(statistics);
+}
+
+uint64_t ChunkSizeStatistics::getNumberOfRequests() const noexcept
+{
+    uint64_t numberOfRequests{0U};
+    for (const auto& bucket : m_buckets)
+    {
+        numberOfRequests += bucket.m_count;
+    }
+    return numberOfRequests;
+}
+
+MemPoolSizingAdvisor::Advice MemPoolSizingAdvisor::advise(const ChunkSizeStatistics& statistics,
+                                                          const Options& options) noexcept
+{
+    Advice advice;
+
+    cxx::vector<Demand, MAX_NUMBER_OF_DEMANDS> demands;
+    for (const auto& bucket : statistics.m_buckets)
+    {
+        demands.emplace_back(Demand{bucket.m_maxChunkSize, estimateRequiredChunks(statistics, bucket)});
+    }
+    if (demands.empty())
+    {
+        return advice;
+    }
+
+    const auto numberOfDemands = static_cast<uint32_t>(demands.size());
+    const auto numberOfGroups = algorithm::minVal(
+        algorithm::maxVal(options.m_maxNumberOfMemPools, 1U), MAX_NUMBER_OF_MEMPOOLS, numberOfDemands);
+
+    uint64_t chunkSums[MAX_NUMBER_OF_DEMANDS + 1U]{};
+    for (uint32_t i = 0U; i < numberOfDemands; ++i)
+    {
+        chunkSums[i + 1U] = chunkSums[i] + demands[i].m_chunks;
+    }
+    // all chunks of the demands first to last are served by a mempool with the chunk size of the last demand
+    auto groupCost = [&](const uint32_t first, const uint32_t last) {
+        return static_cast<double>(demands[last].m_chunkSize)
+               * static_cast<double>(chunkSums[last + 1U] - chunkSums[first]);
+    };
+
+    // costs[last] is the minimal memory for the demands 0 to last with the current number of groups,
+    // groupStarts[group][last] is the first demand of the last group of this optimum
+    double costs[MAX_NUMBER_OF_DEMANDS]{};
+    double nextCosts[MAX_NUMBER_OF_DEMANDS]{};
+    uint32_t groupStarts[MAX_NUMBER_OF_MEMPOOLS][MAX_NUMBER_OF_DEMANDS]{};
+    for (uint32_t last = 0U; last < numberOfDemands; ++last)
+    {
+        costs[last] = groupCost(0U, last);
+    }
+    for (uint32_t group = 1U; group < numberOfGroups; ++group)
+    {
+        for (uint32_t last = 0U; last < numberOfDemands; ++last)
+        {
+            nextCosts[last] = std::numeric_limits<double>::infinity();
+            for (uint32_t first = group; first <= last; ++first)
+            {
+                const auto cost = costs[first - 1U] + groupCost(first, last);
+                if (cost < nextCosts[last])
+                {
+                    nextCosts[last] = cost;
+                    groupStarts[group][last] = first;
+                }
+            }
+        }
+        std::copy(std::begin(nextCosts), std::end(nextCosts), std::begin(costs));
+    }
+
+    Demand groups[MAX_NUMBER_OF_MEMPOOLS];
+    uint32_t last{numberOfDemands - 1U};
+    for (uint32_t group = numberOfGroups; group > 0U; --group)
+    {
+        const auto first = groupStarts[group - 1U][last];
+        groups[group - 1U] = Demand{demands[last].m_chunkSize, chunkSums[last + 1U] - chunkSums[first]};
+        last = first - 1U;
+    }
+
+    constexpr uint32_t CHUNK_HEADER_SIZE{static_cast<uint32_t>(sizeof(mepoo::ChunkHeader))};
+    for (uint32_t group = 0U; group < numberOfGroups; ++group)
+    {
+        const auto chunkPayloadSize = static_cast<uint32_t>(cxx::align<uint64_t>(
+            algorithm::maxVal(groups[group].m_chunkSize, CHUNK_HEADER_SIZE + 1U) - CHUNK_HEADER_SIZE,
+            mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT));
+        const auto chunkCount = static_cast<uint32_t>(algorithm::minVal<uint64_t>(
+            std::numeric_limits<uint32_t>::max(),
+            (groups[group].m_chunks * (100U + options.m_headroomPercent) + 99U) / 100U));
+
+        auto& mempools = advice.m_mePooConfig.m_mempoolConfig;
+        // the alignment of the chunk-payload size can merge neighboring groups
+        if (!mempools.empty() && mempools.back().m_size == chunkPayloadSize)
+        {
+            mempools.back().m_chunkCount += chunkCount;
+        }
+        else
+        {
+            mempools.emplace_back(chunkPayloadSize, chunkCount);
+        }
+    }
+
+    advice.m_requiredMemorySize = mepoo::MemoryManager::requiredFullMemorySize(advice.m_mePooConfig);
+    while (options.m_memoryBudget != 0U && advice.m_requiredMemorySize > options.m_memoryBudget)
+    {
+        const auto scale =
+            static_cast<double>(options.m_memoryBudget) / static_cast<double>(advice.m_requiredMemorySize);
+        bool isReduced{false};
+        for (auto& entry : advice.m_mePooConfig.m_mempoolConfig)
+        {
+            const auto chunkCount = algorithm::maxVal(
+                1U, static_cast<uint32_t>(std::floor(static_cast<double>(entry.m_chunkCount) * scale)));
+            isReduced |= (chunkCount < entry.m_chunkCount);
+            entry.m_chunkCount = chunkCount;
+        }
+        advice.m_requiredMemorySize = mepoo::MemoryManager::requiredFullMemorySize(advice.m_mePooConfig);
+        if (!isReduced)
+        {
+            advice.m_fitsIntoBudget = false;
+            break;
+        }
+    }
+
+    return advice;
+}
+
+void MemPoolSizingAdvisor::writeToml(const Advice& advice, std::ostream& stream) noexcept
+{
+    stream << "# mempool configuration derived from a chunk size recording\n";
+    stream << "# required memory of the segment: " << advice.m_requiredMemorySize << " bytes\n";
+    if (!advice.m_fitsIntoBudget)
+    {
+        stream << "# the memory budget is exceeded even with a single chunk per mempool\n";
+    }
+    stream << "[general]\n";
+    stream << "version = 1\n\n";
+    stream << "[[segment]]\n";
+    for (const auto& entry : advice.m_mePooConfig.m_mempoolConfig)
+    {
+        stream << "\n[[segment.mempool]]\n";
+        stream << "size = " << entry.m_size << "\n";
+        stream << "count = " << entry.m_chunkCount << "\n";
+    }
+}
+
+} // namespace roudi
+} // namespace iox
@@ -41,7 +41,7 @@ capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
     return static_cast<capro::Interfaces>(i);
 }
 
-PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
+PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface, const bool latencyIntrospection) noexcept
 {
     m_roudiMemoryInterface = roudiMemoryInterface;
 
@@ -73,8 +73,11 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         introspectionMemoryManager);
 
     // if we arrive here, the port for service discovery exists and we perform the discovery
-    PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
-    doDiscoveryForPublisherPort(serviceRegistryPort);
+    {
+        std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+        PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
+        doDiscoveryForPublisherPort(serviceRegistryPort);
+    }
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -92,6 +95,12 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     m_portIntrospection.registerPublisherPort(PublisherPortUserType(std::move(portGeneric)),
                                               PublisherPortUserType(std::move(portThroughput)),
                                               PublisherPortUserType(std::move(subscriberPortsData)));
+    if (latencyIntrospection)
+    {
+        auto subscriberLatencies = acquireInternalPublisherPortData(
+            IntrospectionSubscriberLatencyService, options, introspectionMemoryManager);
+        m_portIntrospection.registerLatencyPublisherPort(PublisherPortUserType(std::move(subscriberLatencies)));
+    }
     m_portIntrospection.run();
 }
 
@@ -102,6 +111,8 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+
     handlePublisherPorts();
 
     handleSubscriberPorts();
@@ -171,6 +182,8 @@ void PortManager::handleSubscriberPorts() noexcept
 
         doDiscoveryForSubscriberPort(subscriberPort);
 
+        subscriberPort.notifyOnMissedDeadline();
+
         // check if we have to destroy this subscriber port
         if (subscriberPort.toBeDestroyed())
         {
@@ -492,11 +505,26 @@ bool PortManager::isCompatiblePubSub(const PublisherPortRouDiType& publisher,
     return blockingPoliciesAreCompatible && historyRequestIsCompatible;
 }
 
+void PortManager::attachInlineSlotsIfRequired(const PublisherPortRouDiType& publisher,
+                                              SubscriberPortType& subscriber) noexcept
+{
+    const auto& publisherOptions = publisher.getOptions();
+    if (!publisherOptions.inlineDelivery || publisherOptions.latestValueOnly || subscriber.hasInlineSlots())
+    {
+        return;
+    }
+
+    m_portPool->addInlineSlots(subscriber.getRuntimeName()).and_then([&](auto inlineSlots) {
+        subscriber.attachInlineSlots(inlineSlots);
+    });
+}
+
 bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // only publishers with the same service description are compatible, therefore the other ones are not visited
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(subscriberSource.getCaProServiceDescription()))
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -512,6 +540,11 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
         {
+            if (capro::CaproMessageType::SUB == message.m_type)
+            {
+                attachInlineSlotsIfRequired(publisherPort, subscriberSource);
+            }
+
             auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
             if (publisherResponse.has_value())
             {
@@ -534,7 +567,8 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    // only subscribers with the same service description are compatible, therefore the other ones are not visited
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList(publisherSource.getCaProServiceDescription()))
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -561,6 +595,11 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                 // inform introspection
                 m_portIntrospection.reportMessage(subscriberResponse.value());
 
+                if (capro::CaproMessageType::SUB == subscriberResponse.value().m_type)
+                {
+                    attachInlineSlotsIfRequired(publisherSource, subscriberPort);
+                }
+
                 auto publisherResponse =
                     publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
                 if (publisherResponse.has_value())
@@ -600,7 +639,7 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    for (auto clientPortData : m_portPool->getClientPortDataList(serverSource.getCaProServiceDescription()))
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
@@ -637,7 +676,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    for (auto serverPortData : m_portPool->getServerPortDataList(clientSource.getCaProServiceDescription()))
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
@@ -678,29 +717,27 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
 
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
-    for (auto port : m_portPool->getPublisherPortDataList())
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+
+    for (auto port : m_portPool->getPublisherPortDataList(runtimeName))
     {
         PublisherPortRouDiType publisherPort(port);
-        if (runtimeName == publisherPort.getRuntimeName())
-        {
-            port->m_offeringRequested.store(false, std::memory_order_relaxed);
-            doDiscoveryForPublisherPort(publisherPort);
-        }
+        port->m_offeringRequested.store(false, std::memory_order_relaxed);
+        doDiscoveryForPublisherPort(publisherPort);
     }
 
-    for (auto port : m_portPool->getServerPortDataList())
+    for (auto port : m_portPool->getServerPortDataList(runtimeName))
     {
         popo::ServerPortRouDi serverPort(*port);
-        if (runtimeName == serverPort.getRuntimeName())
-        {
-            port->m_offeringRequested.store(false, std::memory_order_relaxed);
-            doDiscoveryForServerPort(serverPort);
-        }
+        port->m_offeringRequested.store(false, std::memory_order_relaxed);
+        doDiscoveryForServerPort(serverPort);
     }
 }
 
 void PortManager::unblockRouDiShutdown() noexcept
 {
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+
     makeAllPublisherPortsToStopOffer();
     makeAllServerPortsToStopOffer();
 }
@@ -718,73 +755,52 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
 
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+
     // If we delete all ports from RouDi we need to reset the service registry publisher
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
     }
-    for (auto port : m_portPool->getPublisherPortDataList())
+
+    // the port pool keeps track of the resources of each runtime, therefore only the resources of this runtime are
+    // visited and not all resources of the system
+    for (auto port : m_portPool->getPublisherPortDataList(runtimeName))
     {
-        PublisherPortRouDiType sender(port);
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(port);
-        }
+        destroyPublisherPort(port);
     }
 
-    for (auto port : m_portPool->getSubscriberPortDataList())
+    for (auto port : m_portPool->getSubscriberPortDataList(runtimeName))
     {
-        SubscriberPortUserType subscriber(port);
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(port);
-        }
+        destroySubscriberPort(port);
     }
 
-    for (auto port : m_portPool->getServerPortDataList())
+    for (auto port : m_portPool->getServerPortDataList(runtimeName))
     {
-        popo::ServerPortRouDi server(*port);
-        if (runtimeName == server.getRuntimeName())
-        {
-            destroyServerPort(port);
-        }
+        destroyServerPort(port);
     }
 
-    for (auto port : m_portPool->getClientPortDataList())
+    for (auto port : m_portPool->getClientPortDataList(runtimeName))
     {
-        popo::ClientPortRouDi client(*port);
-        if (runtimeName == client.getRuntimeName())
-        {
-            destroyClientPort(port);
-        }
+        destroyClientPort(port);
     }
 
-    for (auto port : m_portPool->getInterfacePortDataList())
+    for (auto port : m_portPool->getInterfacePortDataList(runtimeName))
     {
-        popo::InterfacePort interface(port);
-        if (runtimeName == interface.getRuntimeName())
-        {
-            m_portPool->removeInterfacePort(port);
-            LogDebug() << "Deleted Interface of application " << runtimeName;
-        }
+        m_portPool->removeInterfacePort(port);
+        LogDebug() << "Deleted Interface of application " << runtimeName;
     }
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    for (auto nodeData : m_portPool->getNodeDataList(runtimeName))
     {
-        if (runtimeName == nodeData->m_runtimeName)
-        {
-            m_portPool->removeNodeData(nodeData);
-            LogDebug() << "Deleted node of application " << runtimeName;
-        }
+        m_portPool->removeNodeData(nodeData);
+        LogDebug() << "Deleted node of application " << runtimeName;
     }
 
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    for (auto conditionVariableData : m_portPool->getConditionVariableDataList(runtimeName))
     {
-        if (runtimeName == conditionVariableData->m_runtimeName)
-        {
-            m_portPool->removeConditionVariableData(conditionVariableData);
-            LogDebug() << "Deleted condition variable of application" << runtimeName;
-        }
+        m_portPool->removeConditionVariableData(conditionVariableData);
+        LogDebug() << "Deleted condition variable of application" << runtimeName;
     }
 }
 
@@ -834,6 +850,13 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
 
     subscriberPortRoudi.releaseAllChunks();
 
+    // the subscriber is disconnected from all publishers, its inline slots can be returned to the pool
+    auto inlineSlots = subscriberPortRoudi.detachInlineSlots();
+    if (inlineSlots != nullptr)
+    {
+        m_portPool->removeInlineSlots(inlineSlots);
+    }
+
     m_portIntrospection.removeSubscriber(subscriberPortUser);
 
     LogDebug() << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
@@ -852,6 +875,7 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo)
         .and_then([&](auto publisherPortData) {
+            std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
             PublisherPortRouDiType port(publisherPortData);
             this->doDiscoveryForPublisherPort(port);
         });
@@ -864,6 +888,8 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
                                                       mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                                       const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::unique_lock<std::mutex> discoveryLock(m_discoveryMutex);
+
     if (doesViolateCommunicationPolicy<iox::build::CommunicationPolicy>(service).and_then(
             [&](const auto& usedByProcess) {
                 LogWarn()
@@ -886,6 +912,13 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         return cxx::error<PortPoolError>(PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
     }
 
+    // unique publishers are added under the discovery lock, otherwise a concurrent request for the same service could
+    // pass the check, too; all other publishers are constructed concurrently to the discovery
+    if (!std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        discoveryLock.unlock();
+    }
+
     // we can create a new port
     auto maybePublisherPortData = m_portPool->addPublisherPort(
         service, payloadDataSegmentMemoryManager, runtimeName, publisherOptions, portConfigInfo.memoryInfo);
@@ -915,6 +948,7 @@ PortManager::acquireInternalPublisherPortData(const capro::ServiceDescription& s
         })
         .and_then([&](auto publisherPortData) {
             // now the port to send registry information exists and can be used to publish service registry changes
+            std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
             PublisherPortRouDiType port(publisherPortData);
             this->doDiscoveryForPublisherPort(port);
         })
@@ -951,6 +985,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
+            std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
             SubscriberPortType subscriberPort(subscriberPortData);
             doDiscoveryForSubscriberPort(subscriberPort);
         }
@@ -973,6 +1008,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
+            std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
             popo::ClientPortRouDi clientPort(*clientPortData);
             this->doDiscoveryForClientPort(clientPort);
         });
@@ -985,6 +1021,10 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
+    // the check for an existing server and the creation of the new one happen under the discovery lock, otherwise a
+    // concurrent request for the same service could pass the check, too
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
     for (const auto serverPortData : m_portPool->getServerPortDataList())
@@ -1049,7 +1089,7 @@ void PortManager::publishServiceRegistry() const noexcept
                           CHUNK_NO_USER_HEADER_SIZE,
                           CHUNK_NO_USER_HEADER_ALIGNMENT)
         .and_then([&](auto& chunk) {
-            // It's ok to copy as the modifications happen in the same thread and not concurrently
+            // It's ok to copy as the modifications happen under the discovery lock which is held by the caller
             new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
 
             publisher.sendChunk(chunk);
@@ -1057,6 +1097,33 @@ void PortManager::publishServiceRegistry() const noexcept
         .or_else([](auto&) { LogWarn() << "Could not allocate a chunk for the service registry!"; });
 }
 
+void PortManager::serviceRegistryChanged() noexcept
+{
+    if (m_numberOfServiceRegistryPublicationDeferrals > 0U)
+    {
+        m_hasDeferredServiceRegistryChanges = true;
+        return;
+    }
+    publishServiceRegistry();
+}
+
+cxx::ScopeGuard PortManager::deferServiceRegistryPublication() noexcept
+{
+    std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+    ++m_numberOfServiceRegistryPublicationDeferrals;
+
+    return cxx::ScopeGuard([this] {
+        std::lock_guard<std::mutex> discoveryLock(m_discoveryMutex);
+        // the last guard publishes the changes
+        --m_numberOfServiceRegistryPublicationDeferrals;
+        if (m_numberOfServiceRegistryPublicationDeferrals == 0U && m_hasDeferredServiceRegistryChanges)
+        {
+            m_hasDeferredServiceRegistryChanges = false;
+            publishServiceRegistry();
+        }
+    });
+}
+
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
@@ -1068,13 +1135,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         LogWarn() << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    serviceRegistryChanged();
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    serviceRegistryChanged();
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1083,13 +1150,13 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         LogWarn() << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    serviceRegistryChanged();
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    serviceRegistryChanged();
 }
 
 cxx::expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -29,23 +29,103 @@ PortPool::PortPool(PortPoolData& portPoolData) noexcept
 
 cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> PortPool::getInterfacePortDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_interfacePortMembers.content();
 }
 
 cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_nodeMembers.content();
 }
 
 cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
 PortPool::getConditionVariableDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_publisherPortMembers.contentOf(runtimeName);
+}
+
+cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_subscriberPortMembers.contentOf(runtimeName);
+}
+
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS>
+PortPool::getClientPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_clientPortMembers.contentOf(runtimeName);
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS>
+PortPool::getServerPortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_serverPortMembers.contentOf(runtimeName);
+}
+
+cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>
+PortPool::getInterfacePortDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_interfacePortMembers.contentOf(runtimeName);
+}
+
+cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_nodeMembers.contentOf(runtimeName);
+}
+
+cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+PortPool::getConditionVariableDataList(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_conditionVariableMembers.contentOf(runtimeName);
+}
+
+cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_publisherPortMembers.contentOf(serviceDescription);
+}
+
+cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_subscriberPortMembers.contentOf(serviceDescription);
+}
+
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS>
+PortPool::getClientPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_clientPortMembers.contentOf(serviceDescription);
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS>
+PortPool::getServerPortDataList(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_portPoolData->m_serverPortMembers.contentOf(serviceDescription);
+}
+
 cxx::expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces interface) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
@@ -63,6 +143,7 @@ cxx::expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const Run
                                                                        const NodeName_t& nodeName,
                                                                        const uint64_t nodeDeviceIdentifier) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_portPoolData->m_nodeMembers.hasFreeSpace())
     {
         auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
@@ -80,6 +161,7 @@ cxx::expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const Run
 cxx::expected<popo::ConditionVariableData*, PortPoolError>
 PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_portPoolData->m_conditionVariableMembers.hasFreeSpace())
     {
         auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
@@ -93,28 +175,56 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+cxx::expected<popo::InlineSlots*, PortPoolError> PortPool::addInlineSlots(const RuntimeName_t& runtimeName) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_portPoolData->m_inlineSlotsMembers.hasFreeSpace())
+    {
+        auto inlineSlots = m_portPoolData->m_inlineSlotsMembers.insert(runtimeName);
+        return cxx::success<popo::InlineSlots*>(inlineSlots);
+    }
+    else
+    {
+        // not an error, a subscriber without inline slots receives the samples as chunks
+        LogWarn() << "Out of inline slots! Requested by runtime '" << runtimeName
+                  << "', the samples are delivered as chunks instead";
+        return cxx::error<PortPoolError>(PortPoolError::INLINE_SLOTS_LIST_FULL);
+    }
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_interfacePortMembers.erase(portData);
 }
 
 void PortPool::removeNodeData(const runtime::NodeData* const nodeData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_nodeMembers.erase(nodeData);
 }
 
 void PortPool::removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeInlineSlots(const popo::InlineSlots* const inlineSlots) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_portPoolData->m_inlineSlotsMembers.erase(inlineSlots);
+}
+
 cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_publisherPortMembers.content();
 }
 
 cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSubscriberPortDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
@@ -125,6 +235,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            const popo::PublisherOptions& publisherOptions,
                            const mepoo::MemoryInfo& memoryInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_portPoolData->m_publisherPortMembers.hasFreeSpace())
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
@@ -146,6 +257,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
                             const popo::SubscriberOptions& subscriberOptions,
                             const mepoo::MemoryInfo& memoryInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_portPoolData->m_subscriberPortMembers.hasFreeSpace())
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
@@ -164,11 +276,13 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
 
 cxx::vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getClientPortDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_clientPortMembers.content();
 }
 
 cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPoolData->m_serverPortMembers.content();
 }
 
@@ -179,6 +293,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
                         const popo::ClientOptions& clientOptions,
                         const mepoo::MemoryInfo& memoryInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (!m_portPoolData->m_clientPortMembers.hasFreeSpace())
     {
         LogWarn() << "Out of client ports! Requested by runtime '" << runtimeName << "' and with service description '"
@@ -199,6 +314,7 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
                         const popo::ServerOptions& serverOptions,
                         const mepoo::MemoryInfo& memoryInfo) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (!m_portPoolData->m_serverPortMembers.hasFreeSpace())
     {
         LogWarn() << "Out of server ports! Requested by runtime '" << runtimeName << "' and with service description '"
@@ -214,20 +330,24 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
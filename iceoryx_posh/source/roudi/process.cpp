@@ -59,6 +59,17 @@ void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
     }
 }
 
+void Process::sendViaIpcChannelWithFileDescriptor(const runtime::IpcMessage& data,
+                                                  const int32_t fileDescriptor) noexcept
+{
+    bool sendSuccess = m_ipcChannel.sendWithFileDescriptor(data, fileDescriptor);
+    if (!sendSuccess)
+    {
+        LogWarn() << "Process cannot send message with file descriptor over communication channel";
+        errorHandler(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, ErrorLevel::MODERATE);
+    }
+}
+
 uint64_t Process::getSessionId() noexcept
 {
     return m_sessionId.load(std::memory_order_relaxed);
@@ -84,5 +95,15 @@ bool Process::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+void Process::setNumberOfMappedSegments(const uint64_t numberOfMappedSegments) noexcept
+{
+    m_numberOfMappedSegments = numberOfMappedSegments;
+}
+
+uint64_t Process::getNumberOfMappedSegments() const noexcept
+{
+    return m_numberOfMappedSegments;
+}
+
 } // namespace roudi
 } // namespace iox
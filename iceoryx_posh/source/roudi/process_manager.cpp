@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/memory/relative_pointer.hpp"
@@ -78,6 +79,7 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             m_portManager.unblockProcessShutdown(name);
@@ -91,6 +93,7 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -103,6 +106,7 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -115,6 +119,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -125,6 +130,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -194,6 +200,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint64_t sessionId,
                                      const version::VersionInfo& versionInfo) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     bool returnValue{false};
 
     findProcess(name)
@@ -257,17 +264,29 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         return false;
     }
     m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+    // the runtime maps at least the segments which are announced now when it receives the REG_ACK
+    m_processList.back().setNumberOfMappedSegments(m_segmentManager->getNumberOfSegments());
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
     const bool sendKeepAlive = isMonitored;
 
+    // with a memfd as management memory the application has no name to open it, it maps the file descriptor which is
+    // passed with the REG_ACK instead
+    const auto mgmtMemoryFileDescriptor = m_roudiMemoryInterface.mgmtMemoryFileDescriptor();
     auto offset = memory::UntypedRelativePointer::getOffset(memory::segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId << sendKeepAlive;
+               << m_mgmtSegmentId << sendKeepAlive << mgmtMemoryFileDescriptor.has_value();
 
-    m_processList.back().sendViaIpcChannel(sendBuffer);
+    if (mgmtMemoryFileDescriptor.has_value())
+    {
+        m_processList.back().sendViaIpcChannelWithFileDescriptor(sendBuffer, mgmtMemoryFileDescriptor.value());
+    }
+    else
+    {
+        m_processList.back().sendViaIpcChannel(sendBuffer);
+    }
 
     // set current timestamp again (already done in Process's constructor
     m_processList.back().setTimestamp(mepoo::BaseClock_t::now());
@@ -280,6 +299,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -333,6 +353,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 
 void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // reset timestamp
@@ -341,10 +362,31 @@ void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexce
         .or_else([&]() { LogWarn() << "Received Keepalive from unknown process " << name; });
 }
 
+void ProcessManager::updateMappedSegmentsOfProcess(const RuntimeName_t& name,
+                                                   const uint64_t numberOfMappedSegments) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) { process->setNumberOfMappedSegments(numberOfMappedSegments); })
+        .or_else([&]() { LogWarn() << "Received mapped segments from unknown process " << name; });
+}
+
+void ProcessManager::linkOverflowSegmentsMappedByAllProcesses() noexcept
+{
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
+    auto numberOfMappedSegments = m_segmentManager->getNumberOfSegments();
+    for (const auto& process : m_processList)
+    {
+        numberOfMappedSegments = algorithm::minVal(numberOfMappedSegments, process.getNumberOfMappedSegments());
+    }
+    m_segmentManager->linkOverflowSegments(numberOfMappedSegments);
+}
+
 void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
@@ -365,6 +407,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) {
             m_portManager.acquireNodeData(runtimeName, nodeName)
@@ -399,6 +442,7 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
@@ -413,6 +457,7 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a SubscriberPort
@@ -454,6 +499,7 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a PublisherPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -491,27 +537,8 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
 
-                std::string error;
-                switch (maybePublisher.get_error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
+                sendBuffer << runtime::IpcMessageErrorTypeToString(
+                    toPublisherIpcMessageErrorType(maybePublisher.get_error()));
 
                 process->sendViaIpcChannel(sendBuffer);
                 LogError() << "Could not create PublisherPort for application '" << name
@@ -524,11 +551,110 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
         });
 }
 
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name,
+                                        const runtime::PortRequestContainer& requests) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK)
+                       << cxx::convert::toString(m_mgmtSegmentId);
+
+            // the service registry is published once for all new publishers when the guard goes out of scope
+            auto deferredServiceRegistryPublication = m_portManager.deferServiceRegistryPublication();
+            for (const auto& batchedRequest : requests)
+            {
+                // the runtime omits the node name to keep the CREATE_PORTS message short
+                auto request = batchedRequest;
+                if (request.publisherOptions.nodeName.empty())
+                {
+                    request.publisherOptions.nodeName = name;
+                }
+                if (request.subscriberOptions.nodeName.empty())
+                {
+                    request.subscriberOptions.nodeName = name;
+                }
+
+                if (request.type == runtime::PortRequestType::PUBLISHER)
+                {
+                    if (!segmentInfo.m_memoryManager.has_value())
+                    {
+                        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                                   << runtime::IpcMessageErrorTypeToString(
+                                          runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+                        continue;
+                    }
+
+                    m_portManager
+                        .acquirePublisherPortData(request.service,
+                                                  request.publisherOptions,
+                                                  name,
+                                                  &segmentInfo.m_memoryManager.value().get(),
+                                                  request.portConfigInfo)
+                        .and_then([&](auto publisher) {
+                            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                                       << cxx::convert::toString(memory::UntypedRelativePointer::getOffset(
+                                              memory::segment_id_t{m_mgmtSegmentId}, publisher));
+                            LogDebug() << "Created new PublisherPort for application '" << name
+                                       << "' with service description '" << request.service << "'";
+                        })
+                        .or_else([&](auto error) {
+                            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                                       << runtime::IpcMessageErrorTypeToString(toPublisherIpcMessageErrorType(error));
+                            LogError() << "Could not create PublisherPort for application '" << name
+                                       << "' with service description '" << request.service << "'";
+                        });
+                }
+                else
+                {
+                    m_portManager
+                        .acquireSubscriberPortData(
+                            request.service, request.subscriberOptions, name, request.portConfigInfo)
+                        .and_then([&](auto subscriber) {
+                            sendBuffer << runtime::IpcMessageTypeToString(
+                                runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                                       << cxx::convert::toString(memory::UntypedRelativePointer::getOffset(
+                                              memory::segment_id_t{m_mgmtSegmentId}, subscriber));
+                            LogDebug() << "Created new SubscriberPort for application '" << name
+                                       << "' with service description '" << request.service << "'";
+                        })
+                        .or_else([&](auto) {
+                            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                                       << runtime::IpcMessageErrorTypeToString(
+                                              runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+                            LogError() << "Could not create SubscriberPort for application '" << name
+                                       << "' with service description '" << request.service << "'";
+                        });
+                }
+            }
+
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() { LogWarn() << "Unknown application '" << name << "' requested ports"; });
+}
+
+runtime::IpcMessageErrorType ProcessManager::toPublisherIpcMessageErrorType(const PortPoolError error) noexcept
+{
+    switch (error)
+    {
+    case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+        return runtime::IpcMessageErrorType::NO_UNIQUE_CREATED;
+    case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        return runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN;
+    default:
+        return runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL;
+    }
+}
+
 void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const capro::ServiceDescription& service,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ClientPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -581,6 +707,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ServerPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -630,6 +757,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> processListLock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
@@ -663,12 +791,17 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
 
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
     m_processIntrospection = processIntrospection;
 }
 
 void ProcessManager::run() noexcept
 {
-    monitorProcesses();
+    {
+        std::lock_guard<std::shared_timed_mutex> processListLock(m_processListMutex);
+        monitorProcesses();
+    }
+    // the discovery does not access the process list and runs concurrently to the requests of the processes
     discoveryUpdate();
 }
 
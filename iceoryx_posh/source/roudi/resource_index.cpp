@@ -0,0 +1,45 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/resource_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+uint64_t hashOf(const RuntimeName_t& runtimeName) noexcept
+{
+    // FNV-1a, the hash only needs to spread the runtimes over the lists of a ResourceIndex
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    const auto* const data = runtimeName.c_str();
+    for (uint64_t i = 0U; i < runtimeName.size(); ++i)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<uint8_t>(data[i]));
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t hashOf(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return serviceDescription.getHash();
+}
+
+} // namespace roudi
+} // namespace iox
@@ -25,6 +25,7 @@
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 
 namespace iox
 {
@@ -38,14 +39,11 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
 {
@@ -54,14 +52,27 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
         LogWarn() << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
     // since RouDi offers the introspection services, also add it to the list of processes
     m_processIntrospection.addProcess(getpid(), IPC_CHANNEL_ROUDI_NAME);
 
+    auto runtimeMessageWorkers = roudiStartupParameters.m_runtimeMessageWorkers;
+    if (runtimeMessageWorkers > MAX_RUNTIME_MESSAGE_WORKERS)
+    {
+        LogWarn() << "Requested " << runtimeMessageWorkers << " runtime message workers, limiting to "
+                  << MAX_RUNTIME_MESSAGE_WORKERS;
+        runtimeMessageWorkers = MAX_RUNTIME_MESSAGE_WORKERS;
+    }
+    // with a single worker the messages are processed by the thread which receives them
+    for (uint32_t i = 0U; runtimeMessageWorkers > 1U && i < runtimeMessageWorkers; ++i)
+    {
+        m_runtimeMessageWorkers.emplace_back();
+    }
+
     // run the threads
     m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
     posix::setThreadName(m_monitoringAndDiscoveryThread.native_handle(), "Mon+Discover");
@@ -79,6 +90,12 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        worker.m_thread = std::thread(&RouDi::processRuntimeMessagesOfWorker, this, std::ref(worker));
+        posix::setThreadName(worker.m_thread.native_handle(), "IPC-msg-worker");
+    }
+
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
 }
@@ -101,11 +118,11 @@ void RouDi::shutdown() noexcept
     {
         cxx::DeadlineTimer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -118,15 +135,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -139,6 +156,8 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         LogDebug() << "...'IPC-msg-process' thread joined.";
     }
+
+    stopRuntimeMessageWorkers();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -150,7 +169,11 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        m_prcMgr.run();
+
+        m_roudiMemoryInterface->segmentManager().and_then(
+            [](auto segmentManager) { segmentManager->createOverflowSegmentsOnDemand(); });
+        m_prcMgr.linkOverflowSegmentsMappedByAllProcesses();
 
         cyclicUpdateHook();
 
@@ -171,10 +194,76 @@ void RouDi::processRuntimeMessages() noexcept
         runtime::IpcMessage message;
         if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            std::string runtimeName = message.getElementAtIndex(1);
+            if (m_runtimeMessageWorkers.empty())
+            {
+                handleRuntimeMessage(message);
+            }
+            else
+            {
+                dispatchRuntimeMessage(message);
+            }
+        }
+    }
+}
+
+void RouDi::handleRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+    std::string runtimeName = message.getElementAtIndex(1);
+
+    processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+}
+
+void RouDi::dispatchRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    // the messages of a runtime are always assigned to the same worker to preserve their order
+    const auto workerIndex = std::hash<std::string>()(message.getElementAtIndex(1)) % m_runtimeMessageWorkers.size();
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+    {
+        std::unique_lock<std::mutex> lock(worker.m_mutex);
+        worker.m_messagesChanged.wait(lock, [&] { return !worker.m_messages.full(); });
+        worker.m_messages.push_back(message);
+    }
+    worker.m_messagesChanged.notify_all();
+}
+
+void RouDi::processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept
+{
+    while (true)
+    {
+        runtime::IpcMessage message;
+        {
+            std::unique_lock<std::mutex> lock(worker.m_mutex);
+            worker.m_messagesChanged.wait(
+                lock, [&] { return !worker.m_messages.empty() || !m_runRuntimeMessageWorkers; });
+            // the remaining messages are processed before stopping, e.g. the TERMINATION of a runtime
+            if (worker.m_messages.empty())
+            {
+                return;
+            }
+            message = worker.m_messages.front();
+            worker.m_messages.pop_front();
+        }
+        worker.m_messagesChanged.notify_all();
 
-            processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+        handleRuntimeMessage(message);
+    }
+}
+
+void RouDi::stopRuntimeMessageWorkers() noexcept
+{
+    // called after the 'IPC-msg-process' thread is joined, therefore no further messages are dispatched
+    m_runRuntimeMessageWorkers = false;
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        {
+            // the lock ensures that a worker does not miss the notification between its check and its wait
+            std::lock_guard<std::mutex> lock(worker.m_mutex);
+        }
+        worker.m_messagesChanged.notify_all();
+        if (worker.m_thread.joinable())
+        {
+            worker.m_thread.join();
         }
     }
 }
@@ -251,7 +340,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -288,11 +377,41 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        const uint32_t numberOfElements = message.getNumberOfElements();
+        if (numberOfElements < 3U || numberOfElements - 2U > MAX_PORT_REQUESTS_PER_BATCH)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                       << "\"received!";
+            break;
+        }
+
+        runtime::PortRequestContainer requests;
+        for (uint32_t index = 2U; index < numberOfElements; ++index)
+        {
+            auto deserializationResult =
+                runtime::PortRequest::deserialize(cxx::Serialization(message.getElementAtIndex(index)));
+            if (deserializationResult.has_error())
+            {
+                LogError() << "Deserialization of 'PortRequest' failed when '"
+                           << message.getElementAtIndex(index).c_str() << "' was provided\n";
+                break;
+            }
+            requests.emplace_back(deserializationResult.value());
+        }
+
+        if (requests.size() == numberOfElements - 2U)
+        {
+            m_prcMgr.addPortsForProcess(runtimeName, requests);
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CLIENT:
     {
         if (message.getNumberOfElements() != 5)
@@ -325,7 +444,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -361,7 +480,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -374,7 +493,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -390,7 +509,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(capro::IdString_t(cxx::TruncateToCapacity, message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(3)));
         }
         break;
@@ -405,13 +524,28 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
     case runtime::IpcMessageType::KEEPALIVE:
     {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
+        m_prcMgr.updateLivelinessOfProcess(runtimeName);
+        break;
+    }
+    case runtime::IpcMessageType::SEGMENTS_MAPPED:
+    {
+        uint64_t numberOfMappedSegments{0U};
+        if (message.getNumberOfElements() != 3
+            || !cxx::convert::fromString(message.getElementAtIndex(2).c_str(), numberOfMappedSegments))
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::SEGMENTS_MAPPED\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            m_prcMgr.updateMappedSegmentsOfProcess(runtimeName, numberOfMappedSegments);
+        }
         break;
     }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
@@ -424,7 +558,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -437,7 +571,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -445,7 +579,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         LogError() << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -460,12 +594,13 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    // the runtime messages might be processed by multiple worker threads
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
@@ -37,10 +37,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-message-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:w:";
     int32_t index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -73,6 +74,13 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-w, --runtime-message-workers <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads processing the messages from"
+                      << std::endl;
+            std::cout << "                                  the runtimes, e.g. registrations and port requests."
+                      << std::endl;
+            std::cout << "                                  default = " << roudi::DEFAULT_RUNTIME_MESSAGE_WORKERS
+                      << ", max = " << roudi::MAX_RUNTIME_MESSAGE_WORKERS << std::endl;
 
             m_run = false;
             break;
@@ -165,6 +173,22 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'w':
+        {
+            uint32_t runtimeMessageWorkers{0U};
+            if (!cxx::convert::fromString(optarg, runtimeMessageWorkers) || runtimeMessageWorkers == 0U
+                || runtimeMessageWorkers > roudi::MAX_RUNTIME_MESSAGE_WORKERS)
+            {
+                LogError() << "The number of runtime message workers must be in the range of [1, "
+                           << roudi::MAX_RUNTIME_MESSAGE_WORKERS << "]";
+                m_run = false;
+            }
+            else
+            {
+                m_runtimeMessageWorkers = runtimeMessageWorkers;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -216,6 +240,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                                      m_logLevel,
                                                      m_compatibilityCheckLevel,
                                                      m_processKillDelay,
+                                                     m_runtimeMessageWorkers,
                                                      m_uniqueRouDiId,
                                                      m_run,
                                                      iox::roudi::ConfigFilePathString_t("")});
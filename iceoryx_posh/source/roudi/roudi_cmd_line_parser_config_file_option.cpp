@@ -86,6 +86,7 @@ cxx::expected<CmdLineArgs_t, CmdLineParserResult> CmdLineParserConfigFileOption:
                                                      m_logLevel,
                                                      m_compatibilityCheckLevel,
                                                      m_processKillDelay,
+                                                     m_runtimeMessageWorkers,
                                                      m_uniqueRouDiId,
                                                      m_run,
                                                      m_customConfigFilePath});
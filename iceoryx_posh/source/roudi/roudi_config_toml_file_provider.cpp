@@ -108,44 +108,90 @@ TomlRouDiConfigFileProvider::parse() noexcept
     }
 
     iox::RouDiConfig_t parsedConfig;
+    parsedConfig.m_latencyIntrospection = general->get_as<bool>("latency-introspection").value_or(false);
+    parsedConfig.m_memfdManagementMemory = general->get_as<bool>("memfd-management-memory").value_or(false);
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
+        auto useHugePages = segment->get_as<bool>("huge-pages").value_or(false);
+        auto prefault = segment->get_as<bool>("prefault").value_or(false);
+        auto lockMemory = segment->get_as<bool>("lock-memory").value_or(false);
+        iox::cxx::optional<iox::mepoo::SegmentFile> segmentFile;
+        auto filePath = segment->get_as<std::string>("file");
+        if (filePath)
+        {
+            segmentFile.emplace();
+            segmentFile->m_path = iox::mepoo::SegmentFile::Path_t(iox::cxx::TruncateToCapacity, *filePath);
+            segmentFile->m_size = segment->get_as<uint64_t>("file-size").value_or(0U);
+            segmentFile->m_synchronousMapping = segment->get_as<bool>("file-map-sync").value_or(false);
+        }
+        iox::mepoo::SegmentOverflow overflow;
+        overflow.m_maxSegments = segment->get_as<uint32_t>("overflow-segments").value_or(0U);
+        overflow.m_thresholdPercent = segment->get_as<uint32_t>("overflow-threshold")
+                                          .value_or(iox::mepoo::SegmentOverflow::DEFAULT_THRESHOLD_PERCENT);
         iox::mepoo::MePooConfig mempoolConfig;
-        auto mempools = segment->get_table_array("mempool");
-        if (!mempools)
+        iox::cxx::optional<iox::mepoo::SegmentFile::Path_t> chunkSizeRecordingFile;
+        auto chunkSizeRecordingPath = segment->get_as<std::string>("chunk-size-recording");
+        if (chunkSizeRecordingPath)
         {
-            return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
-                iox::roudi::RouDiConfigFileParseError::SEGMENT_WITHOUT_MEMPOOL);
+            chunkSizeRecordingFile.emplace(iox::cxx::TruncateToCapacity, *chunkSizeRecordingPath);
+            mempoolConfig.m_recordChunkSizes = true;
+        }
+        auto buddyPoolSize = segment->get_as<uint64_t>("buddy-pool-size");
+        if (buddyPoolSize)
+        {
+            mempoolConfig.setBuddyMemPool(
+                {*buddyPoolSize,
+                 segment->get_as<uint32_t>("buddy-pool-min-chunk-size")
+                     .value_or(iox::mepoo::MePooConfig::BuddyMemPoolEntry::DEFAULT_MIN_CHUNK_SIZE)});
         }
 
-        if (mempools->get().size() > iox::MAX_NUMBER_OF_MEMPOOLS)
+        auto mempools = segment->get_table_array("mempool");
+        if (!mempools && !buddyPoolSize)
         {
             return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
-                iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED);
+                iox::roudi::RouDiConfigFileParseError::SEGMENT_WITHOUT_MEMPOOL);
         }
 
-        for (auto mempool : *mempools)
+        if (mempools)
         {
-            auto chunkSize = mempool->get_as<uint32_t>("size");
-            auto chunkCount = mempool->get_as<uint32_t>("count");
-            if (!chunkSize)
+            if (mempools->get().size() > iox::MAX_NUMBER_OF_MEMPOOLS)
             {
                 return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
-                    iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_SIZE);
+                    iox::roudi::RouDiConfigFileParseError::MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED);
             }
-            if (!chunkCount)
+
+            for (auto mempool : *mempools)
             {
-                return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
-                    iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
+                auto chunkSize = mempool->get_as<uint32_t>("size");
+                auto chunkCount = mempool->get_as<uint32_t>("count");
+                if (!chunkSize)
+                {
+                    return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                        iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_SIZE);
+                }
+                if (!chunkCount)
+                {
+                    return iox::cxx::error<iox::roudi::RouDiConfigFileParseError>(
+                        iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
+                }
+                auto reservation = mempool->get_as<iox::mepoo::MemPoolReservation_t>("reservation")
+                                       .value_or(iox::mepoo::NO_MEMPOOL_RESERVATION);
+                mempoolConfig.addMemPool({*chunkSize, *chunkCount, reservation});
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
         }
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::groupName_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             useHugePages,
+             prefault,
+             lockMemory,
+             segmentFile,
+             overflow,
+             chunkSizeRecordingFile});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
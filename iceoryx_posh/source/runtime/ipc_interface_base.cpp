@@ -150,6 +150,61 @@ bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Durat
     return !m_ipcChannel.timedSend(msg.getMessage(), timeout).or_else(logLengthError).has_error();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::sendWithFileDescriptor(const IpcMessage& msg,
+                                                          const int32_t fileDescriptor) const noexcept
+{
+    static_cast<void>(fileDescriptor);
+    LogError() << "Unable to send the message " << msg.getMessage()
+               << " with a file descriptor, the IPC channel does not support it";
+    return false;
+}
+
+template <>
+bool IpcInterface<posix::UnixDomainSocket>::sendWithFileDescriptor(const IpcMessage& msg,
+                                                                   const int32_t fileDescriptor) const noexcept
+{
+    if (!msg.isValid())
+    {
+        LogError() << "Trying to send the message " << msg.getMessage() << " which "
+                   << "does not follow the specified syntax.";
+        return false;
+    }
+
+    return !m_ipcChannel.sendWithFileDescriptor(msg.getMessage(), fileDescriptor)
+                .or_else([&msg](auto&) {
+                    LogError() << "Unable to send the message " << msg.getMessage() << " with a file descriptor";
+                })
+                .has_error();
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedReceiveWithFileDescriptor(const units::Duration timeout,
+                                                                  IpcMessage& answer,
+                                                                  cxx::optional<int32_t>& fileDescriptor) const noexcept
+{
+    fileDescriptor.reset();
+    return timedReceive(timeout, answer);
+}
+
+template <>
+bool IpcInterface<posix::UnixDomainSocket>::timedReceiveWithFileDescriptor(
+    const units::Duration timeout, IpcMessage& answer, cxx::optional<int32_t>& fileDescriptor) const noexcept
+{
+    fileDescriptor.reset();
+    return !m_ipcChannel.timedReceiveWithFileDescriptor(timeout)
+                .and_then([&answer, &fileDescriptor](auto& message) {
+                    // a message without a file descriptor has -1 as file descriptor
+                    if (message.fileDescriptor >= 0)
+                    {
+                        fileDescriptor.emplace(message.fileDescriptor);
+                    }
+                    IpcInterface<posix::UnixDomainSocket>::setMessageFromString(message.message.c_str(), answer);
+                })
+                .has_error()
+           && answer.isValid();
+}
+
 template <typename IpcChannelType>
 const RuntimeName_t& IpcInterface<IpcChannelType>::getRuntimeName() const noexcept
 {
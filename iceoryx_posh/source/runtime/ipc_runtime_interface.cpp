@@ -18,8 +18,10 @@
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
+#include "iceoryx_platform/unistd.hpp"
 
 #include <thread>
 
@@ -143,6 +145,11 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     }
 }
 
+IpcRuntimeInterface::~IpcRuntimeInterface() noexcept
+{
+    closeFileDescriptor(m_mgmtMemoryFileDescriptor);
+}
+
 bool IpcRuntimeInterface::sendKeepalive() noexcept
 {
     return (m_sendKeepalive)
@@ -150,6 +157,13 @@ bool IpcRuntimeInterface::sendKeepalive() noexcept
                : true;
 }
 
+bool IpcRuntimeInterface::sendMappedSegments(const uint64_t numberOfMappedSegments) noexcept
+{
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::SEGMENTS_MAPPED) << m_runtimeName << numberOfMappedSegments;
+    return m_RoudiIpcInterface.send(sendBuffer);
+}
+
 memory::UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOffset() const noexcept
 {
     cxx::Ensures(m_segmentManagerAddressOffset.has_value()
@@ -217,14 +231,15 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
     {
         using namespace units::duration_literals;
         IpcMessage receiveBuffer;
+        cxx::optional<int32_t> fileDescriptor;
         // wait for IpcMessageType::REG_ACK from RouDi for 1 seconds
-        if (m_AppIpcInterface->timedReceive(1_s, receiveBuffer))
+        if (m_AppIpcInterface->timedReceiveWithFileDescriptor(1_s, receiveBuffer, fileDescriptor))
         {
             std::string cmd = receiveBuffer.getElementAtIndex(0U);
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -240,8 +255,23 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+                bool hasMgmtMemoryFileDescriptor{false};
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(6U).c_str(), hasMgmtMemoryFileDescriptor);
                 if (transmissionTimestamp == receivedTimestamp)
                 {
+                    if (hasMgmtMemoryFileDescriptor)
+                    {
+                        if (!fileDescriptor.has_value())
+                        {
+                            LogFatal() << "Received a REG_ACK without the file descriptor of the management memory!";
+                            errorHandler(PoshError::IPC_INTERFACE__REG_ACK_WITHOUT_MGMT_MEMORY_FILE_DESCRIPTOR);
+                            return RegAckResult::TIMEOUT;
+                        }
+                        closeFileDescriptor(m_mgmtMemoryFileDescriptor);
+                        m_mgmtMemoryFileDescriptor = fileDescriptor;
+                        fileDescriptor.reset();
+                    }
+                    closeFileDescriptor(fileDescriptor);
                     return RegAckResult::SUCCESS;
                 }
                 else
@@ -254,14 +284,34 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 LogError() << "Wrong response received " << receiveBuffer.getMessage();
             }
         }
+        closeFileDescriptor(fileDescriptor);
     }
 
     return RegAckResult::TIMEOUT;
 }
 
+void IpcRuntimeInterface::closeFileDescriptor(const cxx::optional<int32_t>& fileDescriptor) noexcept
+{
+    if (fileDescriptor.has_value())
+    {
+        posix::posixCall(iox_close)(fileDescriptor.value())
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([](auto& r) {
+                LogError() << "Unable to close the file descriptor of the management memory: "
+                           << r.getHumanReadableErrnum();
+            });
+    }
+}
+
 uint64_t IpcRuntimeInterface::getSegmentId() const noexcept
 {
     return m_segmentId;
 }
+
+cxx::optional<int32_t> IpcRuntimeInterface::getMgmtMemoryFileDescriptor() const noexcept
+{
+    return m_mgmtMemoryFileDescriptor;
+}
 } // namespace runtime
 } // namespace iox
@@ -0,0 +1,129 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortRequest PortRequest::publisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = PortRequestType::PUBLISHER;
+    request.service = service;
+    request.publisherOptions = publisherOptions;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
+
+PortRequest PortRequest::subscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = PortRequestType::SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = subscriberOptions;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
+
+namespace
+{
+// the options and the port config info of most requests are the default ones; they are sent as empty strings to fit
+// as many requests as possible into a single IPC message
+std::string emptyIfDefault(const std::string& serialized, const std::string& serializedDefault) noexcept
+{
+    return (serialized == serializedDefault) ? std::string() : serialized;
+}
+} // namespace
+
+cxx::Serialization PortRequest::serialize() const noexcept
+{
+    const std::string options =
+        (type == PortRequestType::PUBLISHER)
+            ? emptyIfDefault(publisherOptions.serialize().toString(), popo::PublisherOptions().serialize().toString())
+            : emptyIfDefault(subscriberOptions.serialize().toString(),
+                             popo::SubscriberOptions().serialize().toString());
+    return cxx::Serialization::create(static_cast<std::underlying_type_t<PortRequestType>>(type),
+                                      static_cast<cxx::Serialization>(service).toString(),
+                                      options,
+                                      emptyIfDefault(static_cast<cxx::Serialization>(portConfigInfo).toString(),
+                                                     static_cast<cxx::Serialization>(PortConfigInfo()).toString()));
+}
+
+cxx::expected<PortRequest, cxx::Serialization::Error>
+PortRequest::deserialize(const cxx::Serialization& serialized) noexcept
+{
+    using PortRequestTypeUT = std::underlying_type_t<PortRequestType>;
+
+    PortRequestTypeUT type{0U};
+    std::string service;
+    std::string options;
+    std::string portConfigInfo;
+
+    if (!serialized.extract(type, service, options, portConfigInfo)
+        || type > static_cast<PortRequestTypeUT>(PortRequestType::SUBSCRIBER))
+    {
+        return cxx::error<cxx::Serialization::Error>(cxx::Serialization::Error::DESERIALIZATION_FAILED);
+    }
+
+    auto deserializedService = capro::ServiceDescription::deserialize(cxx::Serialization(service));
+    if (deserializedService.has_error())
+    {
+        return cxx::error<cxx::Serialization::Error>(deserializedService.get_error());
+    }
+
+    PortRequest request;
+    request.type = static_cast<PortRequestType>(type);
+    request.service = deserializedService.value();
+    if (!portConfigInfo.empty())
+    {
+        request.portConfigInfo = PortConfigInfo(cxx::Serialization(portConfigInfo));
+    }
+
+    if (options.empty())
+    {
+        return cxx::success<PortRequest>(request);
+    }
+
+    if (request.type == PortRequestType::PUBLISHER)
+    {
+        auto deserializedOptions = popo::PublisherOptions::deserialize(cxx::Serialization(options));
+        if (deserializedOptions.has_error())
+        {
+            return cxx::error<cxx::Serialization::Error>(deserializedOptions.get_error());
+        }
+        request.publisherOptions = deserializedOptions.value();
+    }
+    else
+    {
+        auto deserializedOptions = popo::SubscriberOptions::deserialize(cxx::Serialization(options));
+        if (deserializedOptions.has_error())
+        {
+            return cxx::error<cxx::Serialization::Error>(deserializedOptions.get_error());
+        }
+        request.subscriberOptions = deserializedOptions.value();
+    }
+
+    return cxx::success<PortRequest>(request);
+}
+
+} // namespace runtime
+} // namespace iox
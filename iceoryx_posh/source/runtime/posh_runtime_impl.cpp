@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/runtime/posh_runtime_impl.hpp"
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/variant.hpp"
@@ -32,6 +33,18 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+// a CREATE_PORTS request must fit into the IPC messages in both directions; the size of the CREATE_PORTS_ACK is
+// bounded by the message type and segment id header and a message type and offset or error per port, all of them
+// being numbers with at most 20 digits plus separator
+constexpr uint64_t MAX_CREATE_PORTS_MESSAGE_SIZE =
+    algorithm::minVal(ROUDI_MESSAGE_SIZE, APP_MESSAGE_SIZE) - platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+constexpr uint64_t MAX_NUMBER_SIZE_WITH_SEPARATOR{21U};
+constexpr uint64_t MAX_PORT_REQUESTS_PER_MESSAGE =
+    (MAX_CREATE_PORTS_MESSAGE_SIZE - 2U * MAX_NUMBER_SIZE_WITH_SEPARATOR) / (2U * MAX_NUMBER_SIZE_WITH_SEPARATOR);
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const RuntimeLocation location) noexcept
     : PoshRuntime(name)
     , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME, *name.value(), runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
@@ -43,7 +56,8 @@ PoshRuntimeImpl::PoshRuntimeImpl(cxx::optional<const RuntimeName_t*> name, const
                    ? cxx::nullopt
                    : cxx::optional<SharedMemoryUser>({m_ipcChannelInterface.getShmTopicSize(),
                                                       m_ipcChannelInterface.getSegmentId(),
-                                                      m_ipcChannelInterface.getSegmentManagerAddressOffset()});
+                                                      m_ipcChannelInterface.getSegmentManagerAddressOffset(),
+                                                      m_ipcChannelInterface.getMgmtMemoryFileDescriptor()});
     }())
 {
 }
@@ -81,18 +95,7 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_HISTORY_CAPACITY =
-        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
-
-    auto options = publisherOptions;
-    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
-    {
-        LogWarn() << "Requested history capacity " << options.historyCapacity
-                  << " exceeds the maximum possible one for this publisher"
-                  << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY;
-        options.historyCapacity = MAX_HISTORY_CAPACITY;
-    }
-
+    auto options = limitPublisherOptions(publisherOptions);
     if (options.nodeName.empty())
     {
         options.nodeName = m_appName;
@@ -100,47 +103,13 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
+               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
     {
-        switch (maybePublisher.get_error())
-        {
-        case IpcMessageErrorType::NO_UNIQUE_CREATED:
-            LogWarn() << "Service '" << service << "' already in use by another process.";
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-            LogWarn() << "Usage of internal service '" << service << "' is forbidden.";
-            errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::PUBLISHER_LIST_FULL:
-            LogWarn() << "Service '" << service << "' could not be created since we are out of memory for publishers.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
-            LogWarn() << "Service '" << service << "' could not be created. Request publisher got invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. Request publisher got wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                         "user. Try using another user or adapt RouDi's config.";
-            errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        handlePublisherRequestError(service, maybePublisher.get_error());
         return nullptr;
     }
     return maybePublisher.value();
@@ -191,30 +160,7 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
-
-    auto options = subscriberOptions;
-    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        LogWarn() << "Requested queue capacity " << options.queueCapacity
-                  << " exceeds the maximum possible one for this subscriber"
-                  << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
-        options.queueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (0U == options.queueCapacity)
-    {
-        LogWarn() << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
-                  << " the capacity is set to 1";
-        options.queueCapacity = 1U;
-    }
-
-    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
-    {
-        LogWarn() << "Requested historyRequest for " << service
-                  << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
-        options.historyRequest = subscriberOptions.queueCapacity;
-    }
-
+    auto options = limitSubscriberOptions(service, subscriberOptions);
     if (options.nodeName.empty())
     {
         options.nodeName = m_appName;
@@ -229,27 +175,7 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
 
     if (maybeSubscriber.has_error())
     {
-        switch (maybeSubscriber.get_error())
-        {
-        case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
-            LogWarn() << "Service '" << service << "' could not be created since we are out of memory for subscribers.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
-            LogWarn() << "Service '" << service << "' could not be created. Request subscriber got invalid response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
-            LogWarn() << "Service '" << service
-                      << "' could not be created. Request subscriber got wrong IPC channel response.";
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
-            errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        handleSubscriberRequestError(service, maybeSubscriber.get_error());
         return nullptr;
     }
     return maybeSubscriber.value();
@@ -295,6 +221,251 @@ PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexce
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
+PortRequestResultContainer PoshRuntimeImpl::createPorts(const PortRequestContainer& requests) noexcept
+{
+    PortRequestResultContainer results;
+    uint64_t firstRequestOfMessage{0U};
+    while (firstRequestOfMessage < requests.size())
+    {
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+
+        uint64_t numberOfRequests{0U};
+        for (uint64_t index = firstRequestOfMessage;
+             index < requests.size() && numberOfRequests < MAX_PORT_REQUESTS_PER_MESSAGE;
+             ++index)
+        {
+            // an empty node name is filled in by RouDi with the runtime name to keep the message short
+            auto limitedRequest = requests[index];
+            if (limitedRequest.type == PortRequestType::PUBLISHER)
+            {
+                limitedRequest.publisherOptions = limitPublisherOptions(limitedRequest.publisherOptions);
+            }
+            else
+            {
+                limitedRequest.subscriberOptions =
+                    limitSubscriberOptions(limitedRequest.service, limitedRequest.subscriberOptions);
+            }
+            const std::string request = limitedRequest.serialize().toString();
+
+            // the first request is always added, a request which does not fit into an empty message fails the same
+            // way as with getMiddlewarePublisher and getMiddlewareSubscriber; all other requests are split into
+            // further messages only when the platform message size is exceeded
+            if (numberOfRequests > 0U
+                && sendBuffer.getMessage().size() + request.size() + 1U > MAX_CREATE_PORTS_MESSAGE_SIZE)
+            {
+                break;
+            }
+            sendBuffer << request;
+            ++numberOfRequests;
+        }
+
+        requestPortsFromRoudi(sendBuffer, &requests[firstRequestOfMessage], numberOfRequests, results);
+        firstRequestOfMessage += numberOfRequests;
+    }
+
+    return results;
+}
+
+void PoshRuntimeImpl::requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                                            const PortRequest* const requests,
+                                            const uint64_t numberOfRequests,
+                                            PortRequestResultContainer& results) noexcept
+{
+    IpcMessage receiveBuffer;
+    bool isInvalidResponse{false};
+    bool isWrongResponse{false};
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        LogError() << "Request ports got invalid response!";
+        isInvalidResponse = true;
+    }
+    else if (receiveBuffer.getNumberOfElements() != 2U + 2U * numberOfRequests
+             || stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+                    != IpcMessageType::CREATE_PORTS_ACK)
+    {
+        LogError() << "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+        isWrongResponse = true;
+    }
+
+    memory::segment_id_underlying_t segmentId{0U};
+    if (!isInvalidResponse && !isWrongResponse)
+    {
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), segmentId);
+    }
+
+    for (uint64_t index = 0U; index < numberOfRequests; ++index)
+    {
+        const auto& request = requests[index];
+        const bool isPublisher = (request.type == PortRequestType::PUBLISHER);
+
+        PortRequestResult result;
+        result.type = request.type;
+
+        IpcMessageErrorType error = isPublisher ? IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE
+                                                : IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE;
+        void* ptr{nullptr};
+        if (isInvalidResponse)
+        {
+            error = isPublisher ? IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE
+                                : IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE;
+        }
+        else if (!isWrongResponse)
+        {
+            const auto messageIndex = static_cast<uint32_t>(2U + 2U * index);
+            const auto responseType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(messageIndex).c_str());
+            const std::string responseValue = receiveBuffer.getElementAtIndex(messageIndex + 1U);
+
+            if (responseType
+                == (isPublisher ? IpcMessageType::CREATE_PUBLISHER_ACK : IpcMessageType::CREATE_SUBSCRIBER_ACK))
+            {
+                memory::UntypedRelativePointer::offset_t offset{0U};
+                cxx::convert::fromString(responseValue.c_str(), offset);
+                ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, offset);
+            }
+            else if (responseType == IpcMessageType::ERROR)
+            {
+                LogError() << "Request ports received no valid port for service '" << request.service
+                           << "' from RouDi.";
+                error = stringToIpcMessageErrorType(responseValue.c_str());
+            }
+        }
+
+        if (isPublisher)
+        {
+            result.publisherPortData = reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr);
+            if (ptr == nullptr)
+            {
+                handlePublisherRequestError(request.service, error);
+            }
+        }
+        else
+        {
+            result.subscriberPortData = reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr);
+            if (ptr == nullptr)
+            {
+                handleSubscriberRequestError(request.service, error);
+            }
+        }
+        results.emplace_back(result);
+    }
+}
+
+popo::PublisherOptions PoshRuntimeImpl::limitPublisherOptions(const popo::PublisherOptions& publisherOptions) const
+    noexcept
+{
+    constexpr uint64_t MAX_HISTORY_CAPACITY =
+        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
+
+    auto options = publisherOptions;
+    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
+    {
+        LogWarn() << "Requested history capacity " << options.historyCapacity
+                  << " exceeds the maximum possible one for this publisher"
+                  << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY;
+        options.historyCapacity = MAX_HISTORY_CAPACITY;
+    }
+
+    return options;
+}
+
+popo::SubscriberOptions PoshRuntimeImpl::limitSubscriberOptions(const capro::ServiceDescription& service,
+                                                                const popo::SubscriberOptions& subscriberOptions) const
+    noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = subscriberOptions;
+    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        LogWarn() << "Requested queue capacity " << options.queueCapacity
+                  << " exceeds the maximum possible one for this subscriber"
+                  << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.queueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.queueCapacity)
+    {
+        LogWarn() << "Requested queue capacity of 0 doesn't make sense as no data would be received,"
+                  << " the capacity is set to 1";
+        options.queueCapacity = 1U;
+    }
+
+    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
+    {
+        LogWarn() << "Requested historyRequest for " << service
+                  << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
+        options.historyRequest = subscriberOptions.queueCapacity;
+    }
+
+    return options;
+}
+
+void PoshRuntimeImpl::handlePublisherRequestError(const capro::ServiceDescription& service,
+                                                  const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::NO_UNIQUE_CREATED:
+        LogWarn() << "Service '" << service << "' already in use by another process.";
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        LogWarn() << "Usage of internal service '" << service << "' is forbidden.";
+        errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::PUBLISHER_LIST_FULL:
+        LogWarn() << "Service '" << service << "' could not be created since we are out of memory for publishers.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
+        LogWarn() << "Service '" << service << "' could not be created. Request publisher got invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. Request publisher got wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                     "user. Try using another user or adapt RouDi's config.";
+        errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+void PoshRuntimeImpl::handleSubscriberRequestError(const capro::ServiceDescription& service,
+                                                   const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
+        LogWarn() << "Service '" << service << "' could not be created since we are out of memory for subscribers.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
+        LogWarn() << "Service '" << service << "' could not be created. Request subscriber got invalid response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
+        LogWarn() << "Service '" << service
+                  << "' could not be created. Request subscriber got wrong IPC channel response.";
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        LogWarn() << "Unknown error occurred while creating service '" << service << "'.";
+        errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
 popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
@@ -656,6 +827,24 @@ void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
         LogWarn() << "Error in sending keep alive";
     }
 
+    // the overflow segments are mapped here and not on their first use, RouDi lets the publishers use them only after
+    // all applications reported that they are mapped
+    if (m_ShmInterface.has_value())
+    {
+        const auto numberOfMappedSegments = m_ShmInterface->mapAnnouncedSegments();
+        if (numberOfMappedSegments != m_numberOfReportedSegments)
+        {
+            if (m_ipcChannelInterface.sendMappedSegments(numberOfMappedSegments))
+            {
+                m_numberOfReportedSegments = numberOfMappedSegments;
+            }
+            else
+            {
+                LogWarn() << "Error in sending the number of mapped segments";
+            }
+        }
+    }
+
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
     // usually set; luckily the runtime already has a thread running and therefore this thread is used to unblock the
     // application shutdown from a potentially blocking publisher with the
@@ -21,16 +21,56 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
 namespace iox
 {
 namespace runtime
 {
 constexpr cxx::perms SharedMemoryUser::SHM_SEGMENT_PERMISSIONS;
+constexpr const char SharedMemoryUser::PREFAULT_SEGMENTS_ENV_VARIABLE[];
+constexpr const char SharedMemoryUser::LOCK_SEGMENTS_ENV_VARIABLE[];
+
+namespace
+{
+bool isEnabledInEnv(const char* const variableName) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-M18.0.3 : Use of getenv is allowed in MISRA amendment#6312
+    // JUSTIFICATION getenv is required to configure the mapping per application; it is only called during the
+    // construction of the runtime
+    // NOLINTNEXTLINE(concurrency-mt-unsafe)
+    const auto* value = std::getenv(variableName);
+    return (value != nullptr) && (std::strcmp(value, "on") == 0);
+}
+} // namespace
 
 SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
                                    const uint64_t segmentId,
-                                   const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+                                   const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                                   const cxx::optional<int32_t>& mgmtMemoryFileDescriptor) noexcept
+    : m_prefaultSegments(isEnabledInEnv(PREFAULT_SEGMENTS_ENV_VARIABLE))
+    , m_lockSegments(isEnabledInEnv(LOCK_SEGMENTS_ENV_VARIABLE))
 {
+    if (mgmtMemoryFileDescriptor.has_value())
+    {
+        posix::MemoryMapBuilder()
+            .length(topicSize)
+            .fileDescriptor(mgmtMemoryFileDescriptor.value())
+            .accessMode(posix::AccessMode::READ_WRITE)
+            .flags(posix::MemoryMapFlags::SHARE_CHANGES)
+            .offset(0)
+            .create()
+            .and_then([this, topicSize, segmentId, segmentManagerAddressOffset](auto& memoryMap) {
+                this->registerMgmtSegment(
+                    memoryMap.getBaseAddress(), topicSize, segmentId, segmentManagerAddressOffset);
+                m_mgmtMemoryMap.emplace(std::move(memoryMap));
+            })
+            .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_MAPP_ERR); });
+        return;
+    }
+
     posix::SharedMemoryObjectBuilder()
         .name(roudi::SHM_NAME)
         .memorySizeInBytes(topicSize)
@@ -39,68 +79,114 @@ SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
         .permissions(SHM_SEGMENT_PERMISSIONS)
         .create()
         .and_then([this, segmentId, segmentManagerAddressOffset](auto& sharedMemoryObject) {
-            auto registeredSuccessfully =
-                memory::UntypedRelativePointer::registerPtrWithId(memory::segment_id_t{segmentId},
-                                                                  sharedMemoryObject.getBaseAddress(),
-                                                                  sharedMemoryObject.getSizeInBytes());
+            this->registerMgmtSegment(sharedMemoryObject.getBaseAddress(),
+                                      sharedMemoryObject.getSizeInBytes(),
+                                      segmentId,
+                                      segmentManagerAddressOffset);
+            m_shmObject.emplace(std::move(sharedMemoryObject));
+        })
+        .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_MAPP_ERR); });
+}
 
-            if (!registeredSuccessfully)
-            {
-                errorHandler(PoshError::POSH__SHM_APP_COULD_NOT_REGISTER_PTR_WITH_GIVEN_SEGMENT_ID);
-            }
+void SharedMemoryUser::registerMgmtSegment(
+    void* const baseAddress,
+    const uint64_t size,
+    const uint64_t segmentId,
+    const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+{
+    auto registeredSuccessfully =
+        memory::UntypedRelativePointer::registerPtrWithId(memory::segment_id_t{segmentId}, baseAddress, size);
 
-            LogDebug() << "Application registered management segment "
-                       << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
-                       << sharedMemoryObject.getSizeInBytes() << " to id " << segmentId;
+    if (!registeredSuccessfully)
+    {
+        errorHandler(PoshError::POSH__SHM_APP_COULD_NOT_REGISTER_PTR_WITH_GIVEN_SEGMENT_ID);
+    }
 
-            this->openDataSegments(segmentId, segmentManagerAddressOffset);
+    LogDebug() << "Application registered management segment " << iox::log::hex(baseAddress) << " with size " << size
+               << " to id " << segmentId;
 
-            m_shmObject.emplace(std::move(sharedMemoryObject));
-        })
-        .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_MAPP_ERR); });
+    openDataSegments(segmentId, segmentManagerAddressOffset);
 }
 
 void SharedMemoryUser::openDataSegments(
     const uint64_t segmentId, const memory::UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
 {
     auto* ptr = memory::UntypedRelativePointer::getPtr(memory::segment_id_t{segmentId}, segmentManagerAddressOffset);
-    auto* segmentManager = static_cast<mepoo::SegmentManager<>*>(ptr);
+    m_segmentManager = static_cast<mepoo::SegmentManager<>*>(ptr);
+    m_numberOfAnnouncedSegments = m_segmentManager->getNumberOfSegments();
 
-    auto segmentMapping = segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
+    auto segmentMapping = m_segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
     for (const auto& segment : segmentMapping)
     {
-        auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
-        posix::SharedMemoryObjectBuilder()
-            .name(segment.m_sharedMemoryName)
-            .memorySizeInBytes(segment.m_size)
-            .accessMode(accessMode)
-            .openMode(posix::OpenMode::OPEN_EXISTING)
-            .permissions(SHM_SEGMENT_PERMISSIONS)
-            .create()
-            .and_then([this, &segment](auto& sharedMemoryObject) {
-                if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
-                {
-                    errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
-                }
-
-                auto registeredSuccessfully =
-                    memory::UntypedRelativePointer::registerPtrWithId(memory::segment_id_t{segment.m_segmentId},
-                                                                      sharedMemoryObject.getBaseAddress(),
-                                                                      sharedMemoryObject.getSizeInBytes());
-
-                if (!registeredSuccessfully)
-                {
-                    errorHandler(PoshError::POSH__SHM_APP_COULD_NOT_REGISTER_PTR_WITH_GIVEN_SEGMENT_ID);
-                }
-
-                LogDebug() << "Application registered payload data segment "
-                           << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
-                           << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
-
-                m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
-            })
-            .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+        openDataSegment(segment);
     }
 }
+
+uint64_t SharedMemoryUser::mapAnnouncedSegments() noexcept
+{
+    const auto numberOfAnnouncedSegments = m_segmentManager->getNumberOfSegments();
+    if (numberOfAnnouncedSegments == m_numberOfAnnouncedSegments)
+    {
+        return m_numberOfAnnouncedSegments;
+    }
+
+    auto segmentMapping = m_segmentManager->getSegmentMappings(posix::PosixUser::getUserOfCurrentProcess());
+    for (const auto& segment : segmentMapping)
+    {
+        if (std::find(m_dataSegmentIds.begin(), m_dataSegmentIds.end(), segment.m_segmentId) == m_dataSegmentIds.end())
+        {
+            openDataSegment(segment);
+        }
+    }
+
+    m_numberOfAnnouncedSegments = numberOfAnnouncedSegments;
+    return numberOfAnnouncedSegments;
+}
+
+void SharedMemoryUser::openDataSegment(const mepoo::SegmentManager<>::SegmentMapping& segment) noexcept
+{
+    auto accessMode = segment.m_isWritable ? posix::AccessMode::READ_WRITE : posix::AccessMode::READ_ONLY;
+    cxx::optional<posix::SharedMemory::FilePath_t> filePath;
+    if (segment.m_file)
+    {
+        filePath.emplace(segment.m_file->m_path);
+    }
+    posix::SharedMemoryObjectBuilder()
+        .name(segment.m_sharedMemoryName)
+        .memorySizeInBytes(segment.m_size)
+        .accessMode(accessMode)
+        .openMode(posix::OpenMode::OPEN_EXISTING)
+        .permissions(SHM_SEGMENT_PERMISSIONS)
+        .prefault(segment.m_prefault || m_prefaultSegments)
+        .lockMemory(segment.m_lockMemory || m_lockSegments)
+        .filePath(filePath)
+        .synchronousMapping(segment.m_file && segment.m_file->m_synchronousMapping)
+        .create()
+        .and_then([this, &segment](auto& sharedMemoryObject) {
+            if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
+            {
+                errorHandler(PoshError::POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
+            }
+
+            auto registeredSuccessfully =
+                memory::UntypedRelativePointer::registerPtrWithId(memory::segment_id_t{segment.m_segmentId},
+                                                                  sharedMemoryObject.getBaseAddress(),
+                                                                  sharedMemoryObject.getSizeInBytes());
+
+            if (!registeredSuccessfully)
+            {
+                errorHandler(PoshError::POSH__SHM_APP_COULD_NOT_REGISTER_PTR_WITH_GIVEN_SEGMENT_ID);
+            }
+
+            LogDebug() << "Application registered payload data segment "
+                       << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
+                       << sharedMemoryObject.getSizeInBytes() << " to id " << segment.m_segmentId;
+
+            m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
+            m_dataSegmentIds.emplace_back(segment.m_segmentId);
+        })
+        .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
+}
+
 } // namespace runtime
 } // namespace iox
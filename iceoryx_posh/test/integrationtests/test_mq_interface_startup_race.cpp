@@ -98,8 +98,10 @@ class CMqInterfaceStartupRace_test : public Test
         constexpr uint32_t DUMMY_SEGMENT_ID{13};
         constexpr uint32_t INDEX_OF_TIMESTAMP{4};
         constexpr uint32_t SEND_KEEP_ALIVE{true};
+        constexpr bool HAS_MGMT_MEMORY_FILE_DESCRIPTOR{false};
         regAck << IpcMessageTypeToString(IpcMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
-               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << SEND_KEEP_ALIVE;
+               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << SEND_KEEP_ALIVE
+               << HAS_MGMT_MEMORY_FILE_DESCRIPTOR;
 
         if (m_appQueue.has_error())
         {
@@ -56,7 +56,10 @@ class MockSubscriberPortUser
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
     MOCK_METHOD0(hasLostChunksSinceLastCall, bool());
+    MOCK_CONST_METHOD0(hasMissedDeadline, bool());
+    MOCK_CONST_METHOD0(numberOfExpiredChunks, uint64_t());
     MOCK_METHOD2(setConditionVariable, bool(iox::popo::ConditionVariableData&, uint64_t));
+    MOCK_METHOD2(setConditionVariableForMissedDeadline, bool(iox::popo::ConditionVariableData&, uint64_t));
     MOCK_METHOD0(isConditionVariableSet, bool());
     MOCK_METHOD0(unsetConditionVariable, bool());
     MOCK_METHOD0(destroy, void());
@@ -78,6 +81,8 @@ class MockBaseSubscriber
     MOCK_METHOD0(unsubscribe, void());
     MOCK_CONST_METHOD0(hasData, bool());
     MOCK_METHOD0(hasMissedData, bool());
+    MOCK_CONST_METHOD0(hasMissedDeadline, bool());
+    MOCK_CONST_METHOD0(numberOfExpiredSamples, uint64_t());
     MOCK_METHOD0(takeChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
@@ -429,6 +429,40 @@ TEST_F(ServiceDescription_test, LessThanOperatorReturnsFalseIfEventStringOfFirst
     EXPECT_FALSE(serviceDescription1 < serviceDescription2);
 }
 
+TEST_F(ServiceDescription_test, EqualServiceDescriptionsHaveTheSameHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55573189-ad9c-40d6-a73a-1025f3349c98");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent");
+    ServiceDescription serviceDescription2(
+        "TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U}, iox::capro::Interfaces::DDS);
+
+    ASSERT_TRUE(serviceDescription1 == serviceDescription2);
+    EXPECT_THAT(serviceDescription1.getHash(), Eq(serviceDescription2.getHash()));
+}
+
+TEST_F(ServiceDescription_test, ServiceDescriptionsWithShiftedStringsHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d7ab61a-144d-4595-9411-546c4fcd84f3");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent");
+    ServiceDescription serviceDescription2("TestServiceT", "estInstance", "TestEvent");
+
+    EXPECT_FALSE(serviceDescription1 == serviceDescription2);
+    EXPECT_THAT(serviceDescription1.getHash(), Ne(serviceDescription2.getHash()));
+}
+
+TEST_F(ServiceDescription_test, DeserializedServiceDescriptionHasTheSameHashAsTheOriginal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adf6dd34-c20b-4878-a7b5-420a2120ca60");
+    ServiceDescription serviceDescription("TestService", "TestInstance", "TestEvent");
+
+    auto deserialized =
+        ServiceDescription::deserialize(static_cast<iox::cxx::Serialization>(serviceDescription));
+
+    ASSERT_FALSE(deserialized.has_error());
+    EXPECT_THAT(deserialized.value().getHash(), Eq(serviceDescription.getHash()));
+    EXPECT_TRUE(deserialized.value() == serviceDescription);
+}
+
 TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42bc3f21-d9f4-4cc3-a37e-6508e1f981c1");
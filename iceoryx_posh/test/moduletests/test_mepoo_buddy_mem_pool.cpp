@@ -0,0 +1,234 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_hoofs/testing/mocks/error_handler_mock.hpp"
+#include "iceoryx_posh/internal/mepoo/buddy_mem_pool.hpp"
+#include "test.hpp"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class BuddyMemPool_test : public Test
+{
+  public:
+    static constexpr uint32_t MIN_CHUNK_SIZE{256U};
+    static constexpr uint32_t NUMBER_OF_BLOCKS{16U};
+    static constexpr uint64_t ARENA_SIZE{NUMBER_OF_BLOCKS * MIN_CHUNK_SIZE};
+    static constexpr uint64_t MEMORY_SIZE{ARENA_SIZE + 1024U};
+
+    BuddyMemPool_test()
+        : allocator(m_rawMemory, MEMORY_SIZE)
+        , sut(ARENA_SIZE, MIN_CHUNK_SIZE, allocator, allocator)
+    {
+    }
+
+    alignas(BuddyMemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::posix::Allocator allocator;
+
+    BuddyMemPool sut;
+};
+
+TEST_F(BuddyMemPool_test, CtorInitializesTheArenaWithValuesPassedToTheCtor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e6b3f21-8a4c-4d97-b1e5-9c2a7f3d8b40");
+    EXPECT_THAT(sut.getSize(), Eq(ARENA_SIZE));
+    EXPECT_THAT(sut.getMinChunkSize(), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.getMaxChunkSize(), Eq(ARENA_SIZE));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getUsedSize(), Eq(0U));
+}
+
+TEST_F(BuddyMemPool_test, CtorWithMinChunkSizeWhichIsNotAPowerOfTwoCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d42a9c5-1b3e-4f86-a0d7-5e8c2b6f1a93");
+    alignas(BuddyMemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t memory[MEMORY_SIZE];
+    iox::posix::Allocator otherAllocator{memory, MEMORY_SIZE};
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    BuddyMemPool otherSut(ARENA_SIZE, MIN_CHUNK_SIZE + 8U, otherAllocator, otherAllocator);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__BUDDY_MEMPOOL_INVALID_CONFIGURATION));
+    EXPECT_THAT(otherSut.getChunkSize(1U), Eq(0U));
+    EXPECT_THAT(otherSut.getChunk(1U), Eq(nullptr));
+}
+
+TEST_F(BuddyMemPool_test, ChunkSizeIsTheNextPowerOfTwoMultipleOfTheMinChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b38e5d17-c6a2-4e09-8f41-2d7b9a0c5e66");
+    EXPECT_THAT(sut.getChunkSize(1U), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.getChunkSize(MIN_CHUNK_SIZE), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.getChunkSize(MIN_CHUNK_SIZE + 1U), Eq(2U * MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.getChunkSize(4U * MIN_CHUNK_SIZE + 1U), Eq(8U * MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut.getChunkSize(static_cast<uint32_t>(ARENA_SIZE)), Eq(ARENA_SIZE));
+    EXPECT_THAT(sut.getChunkSize(static_cast<uint32_t>(ARENA_SIZE) + 1U), Eq(0U));
+}
+
+TEST_F(BuddyMemPool_test, GetChunkUntilTheArenaIsExhaustedProvidesDistinctChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f9a0c38-e71d-4b2a-96c4-8b3e1d7f2a05");
+    std::set<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        auto chunk = sut.getChunk(MIN_CHUNK_SIZE);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.insert(chunk);
+    }
+
+    EXPECT_THAT(chunks.size(), Eq(NUMBER_OF_BLOCKS));
+    EXPECT_THAT(sut.getChunk(1U), Eq(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+    EXPECT_THAT(sut.getUsedSize(), Eq(ARENA_SIZE));
+}
+
+TEST_F(BuddyMemPool_test, FreeChunkMergesTheBuddiesBackToTheLargestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a26c8e4f-3d05-4179-b8e2-6f1a9c7d4b31");
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        chunks.push_back(sut.getChunk(MIN_CHUNK_SIZE));
+    }
+    EXPECT_THAT(sut.getChunk(static_cast<uint32_t>(ARENA_SIZE)), Eq(nullptr));
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getChunk(static_cast<uint32_t>(ARENA_SIZE)), Ne(nullptr));
+}
+
+TEST_F(BuddyMemPool_test, ChunkIsNotMergedWhileItsBuddyIsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4d71b96-0f2c-4a38-9e57-1c8b3a6d0f72");
+    auto firstChunk = sut.getChunk(MIN_CHUNK_SIZE);
+    auto secondChunk = sut.getChunk(MIN_CHUNK_SIZE);
+    ASSERT_THAT(firstChunk, Ne(nullptr));
+    ASSERT_THAT(secondChunk, Ne(nullptr));
+
+    sut.freeChunk(firstChunk);
+
+    EXPECT_THAT(sut.getChunk(static_cast<uint32_t>(ARENA_SIZE)), Eq(nullptr));
+    auto largeChunk = sut.getChunk(NUMBER_OF_BLOCKS / 2U * MIN_CHUNK_SIZE);
+    EXPECT_THAT(largeChunk, Ne(nullptr));
+    EXPECT_THAT(largeChunk, Ne(firstChunk));
+    EXPECT_THAT(sut.getChunk(MIN_CHUNK_SIZE), Eq(firstChunk));
+}
+
+TEST_F(BuddyMemPool_test, ArenaWhichIsNotAPowerOfTwoMultipleOfTheMinChunkSizeIsFullyUsable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29b5f7e3-86a1-4c0d-b4f9-7e2d5a1c8b04");
+    alignas(BuddyMemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t memory[MEMORY_SIZE];
+    iox::posix::Allocator otherAllocator{memory, MEMORY_SIZE};
+    constexpr uint32_t OTHER_NUMBER_OF_BLOCKS{12U};
+    BuddyMemPool otherSut(OTHER_NUMBER_OF_BLOCKS * MIN_CHUNK_SIZE, MIN_CHUNK_SIZE, otherAllocator, otherAllocator);
+
+    EXPECT_THAT(otherSut.getMaxChunkSize(), Eq(8U * MIN_CHUNK_SIZE));
+    EXPECT_THAT(otherSut.getChunk(8U * MIN_CHUNK_SIZE), Ne(nullptr));
+    EXPECT_THAT(otherSut.getChunk(4U * MIN_CHUNK_SIZE), Ne(nullptr));
+    EXPECT_THAT(otherSut.getChunk(1U), Eq(nullptr));
+    EXPECT_THAT(otherSut.getUsedSize(), Eq(OTHER_NUMBER_OF_BLOCKS * MIN_CHUNK_SIZE));
+}
+
+TEST_F(BuddyMemPool_test, GetBlockIndexReturnsTheIndexOfTheFirstBlockOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1d94f6e-2b73-4c08-95e1-7f3b0c6d8a52");
+    auto smallChunk = static_cast<uint8_t*>(sut.getChunk(MIN_CHUNK_SIZE));
+    auto largeChunk = static_cast<uint8_t*>(sut.getChunk(4U * MIN_CHUNK_SIZE));
+    ASSERT_THAT(smallChunk, Ne(nullptr));
+    ASSERT_THAT(largeChunk, Ne(nullptr));
+
+    const auto smallBlockIndex = sut.getBlockIndex(smallChunk);
+    const auto largeBlockIndex = sut.getBlockIndex(largeChunk);
+    EXPECT_THAT(smallBlockIndex, Lt(NUMBER_OF_BLOCKS));
+    EXPECT_THAT(largeBlockIndex, Lt(NUMBER_OF_BLOCKS));
+    EXPECT_THAT(largeBlockIndex % 4U, Eq(0U));
+    EXPECT_THAT((largeChunk - smallChunk) / static_cast<int64_t>(MIN_CHUNK_SIZE),
+                Eq(static_cast<int64_t>(largeBlockIndex) - static_cast<int64_t>(smallBlockIndex)));
+}
+
+TEST_F(BuddyMemPool_test, FreeChunkTwiceCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c07e2a5b-94f3-4d61-8a1c-3b6f0e9d2c87");
+    auto chunk = sut.getChunk(MIN_CHUNK_SIZE);
+    ASSERT_THAT(chunk, Ne(nullptr));
+    sut.freeChunk(chunk);
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    sut.freeChunk(chunk);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(BuddyMemPool_test, AcquiringAndReleasingChunksDoesNotWriteToTheArena)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9342ea39-cc9e-44c1-8a82-659220e9f663");
+    alignas(BuddyMemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t managementMemory[MEMORY_SIZE - ARENA_SIZE];
+    alignas(BuddyMemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t chunkMemory[ARENA_SIZE];
+    iox::posix::Allocator managementAllocator{managementMemory, sizeof(managementMemory)};
+    iox::posix::Allocator chunkMemoryAllocator{chunkMemory, sizeof(chunkMemory)};
+    BuddyMemPool otherSut(ARENA_SIZE, MIN_CHUNK_SIZE, managementAllocator, chunkMemoryAllocator);
+
+    // a process which maps the arena read-only must be able to release chunks
+    constexpr uint8_t PATTERN{0xA5U};
+    std::fill(std::begin(chunkMemory), std::end(chunkMemory), PATTERN);
+
+    std::vector<void*> chunks;
+    chunks.emplace_back(otherSut.getChunk(MIN_CHUNK_SIZE));
+    chunks.emplace_back(otherSut.getChunk(3U * MIN_CHUNK_SIZE));
+    chunks.emplace_back(otherSut.getChunk(MIN_CHUNK_SIZE));
+    chunks.emplace_back(otherSut.getChunk(8U * MIN_CHUNK_SIZE));
+    for (auto chunk : chunks)
+    {
+        ASSERT_THAT(chunk, Ne(nullptr));
+    }
+    otherSut.freeChunk(chunks[2U]);
+    otherSut.freeChunk(chunks[0U]);
+    otherSut.freeChunk(chunks[3U]);
+    otherSut.freeChunk(chunks[1U]);
+
+    EXPECT_THAT(otherSut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(static_cast<uint64_t>(std::count(std::begin(chunkMemory), std::end(chunkMemory), PATTERN)),
+                Eq(ARENA_SIZE));
+    EXPECT_THAT(otherSut.getChunk(ARENA_SIZE), Eq(static_cast<void*>(chunkMemory)));
+}
+
+TEST_F(BuddyMemPool_test, ManagementMemoryContainsTheStateAndTheFreeListLinksOfEveryBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e430511-ed8a-43d8-8829-4c21e58bfa7c");
+    EXPECT_THAT(BuddyMemPool::requiredManagementMemorySize(ARENA_SIZE, MIN_CHUNK_SIZE),
+                Eq(NUMBER_OF_BLOCKS * (sizeof(uint8_t) + 2U * sizeof(uint32_t))));
+    EXPECT_THAT(BuddyMemPool::requiredChunkMemorySize(ARENA_SIZE, MIN_CHUNK_SIZE), Eq(ARENA_SIZE));
+}
+
+} // namespace
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/memory/relative_pointer.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -49,12 +50,16 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(sut.chunkSize(), Eq(CHUNK_SIZE));
 
     // deliberately used a magic number to make the test fail when CHUNK_HEADER_VERSION changes
-    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(1U));
+    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(2U));
 
     EXPECT_THAT(sut.originId(), Eq(iox::popo::UniquePortId(iox::popo::InvalidPortId)));
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
 
+    EXPECT_THAT(sut.publishTimestamp(), Eq(0U));
+
+    EXPECT_THAT(sut.nextSegment(), Eq(nullptr));
+
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
     EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
@@ -66,6 +71,39 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(userPayloadStartAddress - chunkStartAddress, Eq(sizeof(ChunkHeader)));
 }
 
+TEST(ChunkHeader_test, SetUserHeaderIdIdentifiesTheUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c8395f0-0ed6-40a4-b999-0eb30b250c0e");
+    constexpr uint32_t CHUNK_SIZE{128U};
+    constexpr uint16_t USER_HEADER_ID{0x0042};
+    auto chunkSettingsResult =
+        ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    // the user-header and user-payload are placed after the ChunkHeader
+    alignas(ChunkHeader) uint8_t storage[CHUNK_SIZE];
+    auto* sut = new (&storage[0]) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+    ASSERT_THAT(sut->userHeaderId(), Eq(ChunkHeader::UNKNOWN_USER_HEADER));
+
+    sut->setUserHeaderId(USER_HEADER_ID);
+
+    EXPECT_THAT(sut->userHeaderId(), Eq(USER_HEADER_ID));
+    sut->~ChunkHeader();
+}
+
+TEST(ChunkHeader_test, SetUserHeaderIdIsIgnoredWithoutUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d61d96d5-3caf-482e-8859-a09c201b3849");
+    constexpr uint32_t CHUNK_SIZE{753U};
+    constexpr uint16_t USER_HEADER_ID{0x0042};
+    auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(chunkSettingsResult.has_error());
+    ChunkHeader sut{CHUNK_SIZE, chunkSettingsResult.value()};
+
+    sut.setUserHeaderId(USER_HEADER_ID);
+
+    EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
+}
+
 TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
 {
     ::testing::Test::RecordProperty("TEST_ID", "8f88f81a-7e18-11ec-b34d-dd7741c14c43");
@@ -82,13 +120,15 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
         uint16_t userHeaderId{0};
         uint64_t originId{0U};
         uint64_t sequenceNumber{0U};
+        uint64_t publishTimestamp{0U};
+        uint64_t nextSegment{0U};
         uint32_t userHeaderSize{0U};
         uint32_t userPayloadSize{0U};
         uint32_t userPayloadAlignment{0U};
         uint32_t userPayloadOffset{0U};
     };
 
-    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{1U};
+    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{2U};
     EXPECT_THAT(ChunkHeader::CHUNK_HEADER_VERSION, Eq(EXPECTED_CHUNK_HEADER_VERSION));
 
     EXPECT_THAT(sizeof(ChunkHeader), Eq(sizeof(ExpectedChunkHeaderLayout)));
@@ -116,6 +156,7 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(chunkHeaderVersion);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderId);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(sequenceNumber);
+    IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(publishTimestamp);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadAlignment);
@@ -128,6 +169,20 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     auto originId = static_cast<OriginIdType>(reinterpret_cast<ChunkHeader*>(&sut)->originId());
     EXPECT_THAT(originId, Eq(PATTERN));
 
+    // special handling for nextSegment since it is stored as RelativePointerData which can only be resolved in a
+    // registered segment; the sut itself is used as segment
+    zeroizeSut();
+    ASSERT_THAT(sizeof(iox::memory::RelativePointerData), Eq(sizeof(ExpectedChunkHeaderLayout::nextSegment)));
+    auto segmentId = iox::memory::UntypedRelativePointer::registerPtr(&sut, sizeof(ExpectedChunkHeaderLayout));
+    ASSERT_TRUE(segmentId.has_value());
+    const iox::memory::RelativePointerData nextSegmentData{
+        static_cast<iox::memory::RelativePointerData::identifier_t>(*segmentId), PATTERN};
+    std::memcpy(&sut.nextSegment, &nextSegmentData, sizeof(sut.nextSegment));
+    auto nextSegment = reinterpret_cast<ChunkHeader*>(&sut)->nextSegment();
+    iox::memory::UntypedRelativePointer::unregisterPtr(iox::memory::segment_id_t{*segmentId});
+    EXPECT_THAT(reinterpret_cast<uint64_t>(nextSegment) - reinterpret_cast<uint64_t>(&sut),
+                Eq(static_cast<uint64_t>(PATTERN)));
+
     // special handling for userPayloadOffset since it cannot easily be accessed
     zeroizeSut();
     sut.userPayloadOffset = PATTERN;
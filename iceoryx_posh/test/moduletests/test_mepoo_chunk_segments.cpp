@@ -0,0 +1,100 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chunk_segments.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkSegments_test : public Test
+{
+  public:
+    ChunkSegments_test()
+    {
+        MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+    }
+
+    SharedChunk getChunk(const uint32_t userPayloadSize)
+    {
+        auto chunkSettings = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+        return memoryManager.getChunk(chunkSettings).value();
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
+    static constexpr uint64_t MEMORY_SIZE{16U * 1024U};
+
+    alignas(8) uint8_t memory[MEMORY_SIZE];
+    iox::posix::Allocator allocator{memory, MEMORY_SIZE};
+    MemoryManager memoryManager;
+};
+
+TEST_F(ChunkSegments_test, RangeOfNullptrIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4119cf35-56fb-4e0c-a53c-e91d3449d6a7");
+    ChunkSegments sut(nullptr);
+
+    EXPECT_TRUE(sut.begin() == sut.end());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.userPayloadSize(), Eq(0U));
+    EXPECT_THAT(ChunkSegments::fromUserPayload(nullptr).size(), Eq(0U));
+}
+
+TEST_F(ChunkSegments_test, RangeOfChunkWithoutSegmentsContainsOnlyTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d76140d-9ffa-4111-bc92-60c546f4dbf3");
+    constexpr uint32_t USER_PAYLOAD_SIZE{16U};
+    auto chunk = getChunk(USER_PAYLOAD_SIZE);
+
+    auto sut = ChunkSegments::fromUserPayload(chunk.getUserPayload());
+
+    ASSERT_TRUE(sut.begin() != sut.end());
+    EXPECT_THAT(&*sut.begin(), Eq(chunk.getChunkHeader()));
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+}
+
+TEST_F(ChunkSegments_test, RangeContainsAllSegmentsInTheOrderTheyWereAppended)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d17f7535-bd22-4358-85cf-40bc64454aff");
+    constexpr uint32_t USER_PAYLOAD_SIZES[]{8U, 16U, 32U};
+    auto chunk = getChunk(USER_PAYLOAD_SIZES[0]);
+    chunk.appendSegment(getChunk(USER_PAYLOAD_SIZES[1]));
+    chunk.appendSegment(getChunk(USER_PAYLOAD_SIZES[2]));
+
+    ChunkSegments sut(chunk.getChunkHeader());
+
+    uint64_t index{0U};
+    for (const auto& segment : sut)
+    {
+        ASSERT_THAT(index, Lt(3U));
+        EXPECT_THAT(segment.userPayloadSize(), Eq(USER_PAYLOAD_SIZES[index]));
+        ++index;
+    }
+    EXPECT_THAT(index, Eq(3U));
+    EXPECT_THAT(sut.size(), Eq(3U));
+    EXPECT_THAT(sut.userPayloadSize(), Eq(USER_PAYLOAD_SIZES[0] + USER_PAYLOAD_SIZES[1] + USER_PAYLOAD_SIZES[2]));
+}
+
+} // namespace
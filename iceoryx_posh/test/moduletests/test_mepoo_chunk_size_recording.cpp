@@ -0,0 +1,117 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_recording.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class ChunkSizeRecording_test : public Test
+{
+  public:
+    ChunkSizeRecording sut;
+};
+
+TEST_F(ChunkSizeRecording_test, SmallChunkSizesHaveABucketEach)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a9f1d64-c27e-4b85-9d03-8e6b5c2f7a19");
+    for (uint32_t chunkSize = 0U; chunkSize < 2U * ChunkSizeRecording::SUB_BUCKETS_PER_OCTAVE; ++chunkSize)
+    {
+        EXPECT_THAT(ChunkSizeRecording::bucketIndex(chunkSize), Eq(chunkSize));
+    }
+}
+
+TEST_F(ChunkSizeRecording_test, BucketIndexIsMonotonicAndTheRelativeBucketWidthIsBounded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6e2b80f-51a3-4d7c-8f94-0b1d7e3a6c52");
+    uint32_t previousIndex{0U};
+    uint32_t firstChunkSizeOfBucket{0U};
+    for (uint64_t chunkSize = 1U; chunkSize <= std::numeric_limits<uint32_t>::max(); chunkSize += chunkSize / 64U + 1U)
+    {
+        const auto index = ChunkSizeRecording::bucketIndex(static_cast<uint32_t>(chunkSize));
+        ASSERT_THAT(index, Ge(previousIndex));
+        ASSERT_THAT(index, Lt(ChunkSizeRecording::NUMBER_OF_BUCKETS));
+        if (index != previousIndex)
+        {
+            firstChunkSizeOfBucket = static_cast<uint32_t>(chunkSize);
+        }
+        EXPECT_THAT(chunkSize - firstChunkSizeOfBucket,
+                    Lt(firstChunkSizeOfBucket / ChunkSizeRecording::SUB_BUCKETS_PER_OCTAVE + 1U));
+        previousIndex = index;
+    }
+    EXPECT_THAT(ChunkSizeRecording::bucketIndex(std::numeric_limits<uint32_t>::max()),
+                Eq(ChunkSizeRecording::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(ChunkSizeRecording_test, RecordCountsTheRequestAndKeepsTheLargestChunkSizeOfTheBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84d5f0a7-2c3b-4e16-b9a8-d7f2e1c05b63");
+    constexpr uint32_t CHUNK_SIZE{1000U};
+    constexpr uint32_t LARGER_CHUNK_SIZE{1010U};
+    ASSERT_THAT(ChunkSizeRecording::bucketIndex(CHUNK_SIZE), Eq(ChunkSizeRecording::bucketIndex(LARGER_CHUNK_SIZE)));
+
+    sut.record(LARGER_CHUNK_SIZE, 0U, 1024U);
+    sut.record(CHUNK_SIZE, 0U, 1024U);
+
+    const auto bucket = sut.getBucket(ChunkSizeRecording::bucketIndex(CHUNK_SIZE));
+    EXPECT_THAT(bucket.m_count, Eq(2U));
+    EXPECT_THAT(bucket.m_maxChunkSize, Eq(LARGER_CHUNK_SIZE));
+    const auto counters = sut.getMemPoolCounters(0U);
+    EXPECT_THAT(counters.m_requests, Eq(2U));
+    EXPECT_THAT(counters.m_wastedBytes, Eq(2U * 1024U - CHUNK_SIZE - LARGER_CHUNK_SIZE));
+    EXPECT_THAT(counters.m_failedRequests, Eq(0U));
+}
+
+TEST_F(ChunkSizeRecording_test, RecordWithoutAcquiredChunkCountsAFailedRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1b7c392-6e0d-4a5f-8c21-4a9e3d6b0f78");
+    sut.record(100U, 2U, 0U);
+
+    const auto counters = sut.getMemPoolCounters(2U);
+    EXPECT_THAT(counters.m_requests, Eq(1U));
+    EXPECT_THAT(counters.m_wastedBytes, Eq(0U));
+    EXPECT_THAT(counters.m_failedRequests, Eq(1U));
+    EXPECT_THAT(sut.getBucket(ChunkSizeRecording::bucketIndex(100U)).m_count, Eq(1U));
+}
+
+TEST_F(ChunkSizeRecording_test, RecordWithoutMemPoolIsOnlyCountedInTheHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e8a6d05-b9c4-4f73-a1e6-7c0f5b3d9a24");
+    sut.record(5000U, ChunkSizeRecording::NO_MEMPOOL, 8192U);
+
+    EXPECT_THAT(sut.getRequestsWithoutMemPool(), Eq(1U));
+    EXPECT_THAT(sut.getBucket(ChunkSizeRecording::bucketIndex(5000U)).m_count, Eq(1U));
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        EXPECT_THAT(sut.getMemPoolCounters(i).m_requests, Eq(0U));
+    }
+}
+
+TEST_F(ChunkSizeRecording_test, OutOfRangeIndicesReturnEmptyBucketsAndCounters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c4f2e71-0a8d-4b36-95e7-e3b1a6c8d0f5");
+    sut.record(100U, 0U, 128U);
+
+    EXPECT_THAT(sut.getBucket(ChunkSizeRecording::NUMBER_OF_BUCKETS).m_count, Eq(0U));
+    EXPECT_THAT(sut.getMemPoolCounters(ChunkSizeRecording::NO_MEMPOOL).m_requests, Eq(0U));
+}
+
+} // namespace
@@ -152,6 +152,26 @@ TEST_F(MePooConfig_Test, OptimizeMethodSortsTheAddedMempoolsInTheMemPoolConfigCo
     EXPECT_THAT((sut.m_mempoolConfig[2].m_size), Eq(SIZE_1));
 }
 
+TEST_F(MePooConfig_Test, OptimizeMethodDoesNotCombineMempoolsOfDifferentReservations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a2e9f14-b3c7-4d58-8f01-7e4c2b9d5a36");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t SIZE{128U};
+    constexpr iox::mepoo::MemPoolReservation_t RESERVATION{1U};
+    sut.addMemPool({SIZE, CHUNK_COUNT, RESERVATION});
+    sut.addMemPool({SIZE, CHUNK_COUNT});
+    sut.addMemPool({SIZE, CHUNK_COUNT, RESERVATION});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_reservation, Eq(iox::mepoo::NO_MEMPOOL_RESERVATION));
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_reservation, Eq(RESERVATION));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_chunkCount, Eq(CHUNK_COUNT * 2U));
+}
+
 TEST_F(MePooConfig_Test, VerifyOptimizeMethodOnMePooConfigWithNoAddedMemPools)
 {
     ::testing::Test::RecordProperty("TEST_ID", "8ee01d92-acb6-4841-b844-2ae151c53200");
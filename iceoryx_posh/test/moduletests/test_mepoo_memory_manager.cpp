@@ -468,6 +468,326 @@ TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
     });
 }
 
+TEST_F(MemoryManager_test, ReservedMemPoolsOnlyNeedToBeOrderedWithinTheirReservation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0e8a3c-2f71-4b96-a4c8-e91b7d6f3052");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr iox::mepoo::MemPoolReservation_t RESERVATION{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, RESERVATION});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, RESERVATION});
+
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    ASSERT_EQ(sut->getNumberOfMemPools(), 4U);
+    EXPECT_EQ(sut->getMemPoolReservation(1U), iox::mepoo::NO_MEMPOOL_RESERVATION);
+    EXPECT_EQ(sut->getMemPoolReservation(2U), RESERVATION);
+    EXPECT_EQ(sut->getMemPoolReservation(3U), RESERVATION);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithoutReservationNeverUsesReservedMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7a41c96-3b5d-4f28-8d0e-6c2f9a1b5e73");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr iox::mepoo::MemPoolReservation_t RESERVATION{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, RESERVATION});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_128)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithReservationOnlyUsesReservedMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c3f5b70-d182-4e6a-b49f-0a8e7d2c6f15");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNK_COUNT{2U};
+    constexpr iox::mepoo::MemPoolReservation_t RESERVATION{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, RESERVED_CHUNK_COUNT, RESERVATION});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < RESERVED_CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettings_128, RESERVATION)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_128, RESERVATION)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, RESERVED_CHUNK_COUNT);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithUnknownReservationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41b8d2e6-7fa3-4c05-9e61-d3a5c8f2b097");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr iox::mepoo::MemPoolReservation_t UNKNOWN_RESERVATION{42U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::cxx::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE};
+    sut->getChunk(chunkSettings_32, UNKNOWN_RESERVATION)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithOnlyBuddyMemPoolProvidesPowerOfTwoSizedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a7c1e52-94d8-4b0f-a6e3-5f2d8c71b904");
+    constexpr uint64_t BUDDY_MEMPOOL_SIZE{64U * 1024U};
+    constexpr uint32_t MIN_CHUNK_SIZE{256U};
+    mempoolconf.setBuddyMemPool({BUDDY_MEMPOOL_SIZE, MIN_CHUNK_SIZE});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    ASSERT_THAT(sut->getBuddyMemPool(), Ne(nullptr));
+    const auto chunkSettings_900 =
+        iox::mepoo::ChunkSettings::create(900U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    auto smallChunk = sut->getChunk(chunkSettings_128);
+    auto largeChunk = sut->getChunk(chunkSettings_900);
+    ASSERT_FALSE(smallChunk.has_error());
+    ASSERT_FALSE(largeChunk.has_error());
+
+    EXPECT_THAT(smallChunk.value().getChunkHeader()->chunkSize(), Eq(MIN_CHUNK_SIZE));
+    EXPECT_THAT(largeChunk.value().getChunkHeader()->chunkSize(), Eq(4U * MIN_CHUNK_SIZE));
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedChunks(), Eq(2U));
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedSize(), Eq(5U * MIN_CHUNK_SIZE));
+
+    smallChunk.value() = iox::mepoo::SharedChunk();
+    largeChunk.value() = iox::mepoo::SharedChunk();
+
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedSize(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesBuddyMemPoolOnlyWhenNoMemPoolFits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c81f4d27-6e3a-4b95-8d10-2a7e9f5c3b68");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.setBuddyMemPool({64U * 1024U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_128);
+    auto largeChunkStore = getChunksFromSut(1U, chunkSettings_256);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    ASSERT_THAT(sut->getBuddyMemPool(), Ne(nullptr));
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedChunks(), Eq(1U));
+}
+
+TEST_F(MemoryManager_test, GetChunkWithReservationNeverUsesBuddyMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5b2e8a1-0c49-4d7e-93a6-7d1c4e8b2f30");
+    constexpr iox::mepoo::MemPoolReservation_t RESERVATION{1U};
+    mempoolconf.setBuddyMemPool({64U * 1024U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto errorHandlerGuard =
+        iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([](auto, auto) {});
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE};
+    sut->getChunk(chunkSettings_32, RESERVATION)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    EXPECT_THAT(sut->getBuddyMemPool()->getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesOverflowMemoryManagerWhenMemPoolIsOutOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e8c5a39-d2f7-4b60-9a84-6c3f0b7e2d15");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager overflowMemoryManager;
+    overflowMemoryManager.configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getOverflowMemoryManager(), Eq(nullptr));
+    sut->setOverflowMemoryManager(overflowMemoryManager);
+    EXPECT_THAT(sut->getOverflowMemoryManager(), Eq(&overflowMemoryManager));
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_128);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(overflowMemoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+
+    chunkStore.clear();
+    EXPECT_THAT(overflowMemoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ContainsChunkIsTrueForChunksOfTheMemPoolsAndTheBuddyMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4d5b9b7-bf2d-490f-b3c0-66916485fea9");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.setBuddyMemPool({64U * 1024U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto largeChunkStore = getChunksFromSut(1U, chunkSettings_256);
+    uint64_t notAChunk{0U};
+
+    EXPECT_TRUE(sut->containsChunk(chunkStore[0].getChunkHeader()));
+    EXPECT_TRUE(sut->containsChunk(chunkStore[1].getChunkHeader()));
+    EXPECT_TRUE(sut->containsChunk(largeChunkStore[0].getChunkHeader()));
+    EXPECT_FALSE(sut->containsChunk(&notAChunk));
+}
+
+TEST_F(MemoryManager_test, ContainsChunkIsTrueForChunksOfTheOverflowMemoryManager)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "144f0bd6-9854-4540-9b2a-abdcdd27f8d7");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::MemoryManager overflowMemoryManager;
+    overflowMemoryManager.configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto overflowChunk = overflowMemoryManager.getChunk(chunkSettings_128).value();
+
+    EXPECT_FALSE(sut->containsChunk(overflowChunk.getChunkHeader()));
+    sut->setOverflowMemoryManager(overflowMemoryManager);
+    EXPECT_TRUE(sut->containsChunk(overflowChunk.getChunkHeader()));
+    EXPECT_FALSE(overflowMemoryManager.containsChunk(getChunksFromSut(1U, chunkSettings_128)[0].getChunkHeader()));
+}
+
+TEST_F(MemoryManager_test, GetMaxUsagePercentReturnsTheUsageOfTheMostUsedMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4f07c92-5b3e-4d18-87e1-e92d6b0c5f43");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getMaxUsagePercent(), Eq(0U));
+    auto chunkStore32 = getChunksFromSut(2U, chunkSettings_32);
+    auto chunkStore128 = getChunksFromSut(7U, chunkSettings_128);
+    EXPECT_THAT(sut->getMaxUsagePercent(), Eq(70U));
+}
+
+TEST_F(MemoryManager_test, ChunkSizeRecordingIsNotAvailableWhenItIsNotEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d6b94e2-7c1a-4f38-b5e9-2a8f3c71d604");
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->getChunkSizeRecording(), Eq(nullptr));
+}
+
+TEST_F(MemoryManager_test, GetChunkRecordsTheRequiredChunkSizeAndTheWasteOfTheMemPoolWhenRecordingIsEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e73a05c8-4b2f-4d91-a6e0-5f9c1b8d2e37");
+    using iox::mepoo::ChunkSizeRecording;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 10U});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, 1U});
+    const auto managementMemorySizeWithoutRecording =
+        iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf);
+    mempoolconf.m_recordChunkSizes = true;
+    EXPECT_THAT(iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf),
+                Ge(managementMemorySizeWithoutRecording + sizeof(ChunkSizeRecording)));
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(2U, chunkSettings_32);
+    auto chunkStore64 = getChunksFromSut(1U, chunkSettings_64);
+    {
+        auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+            [](const iox::PoshError, const iox::ErrorLevel) {});
+        EXPECT_TRUE(sut->getChunk(chunkSettings_64).has_error());
+        EXPECT_TRUE(sut->getChunk(chunkSettings_256).has_error());
+    }
+
+    const auto recording = sut->getChunkSizeRecording();
+    ASSERT_THAT(recording, Ne(nullptr));
+    const auto requiredChunkSize32 = chunkSettings_32.requiredChunkSize();
+    const auto requiredChunkSize64 = chunkSettings_64.requiredChunkSize();
+    const auto bucket32 = recording->getBucket(ChunkSizeRecording::bucketIndex(requiredChunkSize32));
+    EXPECT_THAT(bucket32.m_count, Eq(2U));
+    EXPECT_THAT(bucket32.m_maxChunkSize, Eq(requiredChunkSize32));
+    EXPECT_THAT(recording->getBucket(ChunkSizeRecording::bucketIndex(requiredChunkSize64)).m_count, Eq(2U));
+
+    const auto counters32 = recording->getMemPoolCounters(0U);
+    EXPECT_THAT(counters32.m_requests, Eq(2U));
+    EXPECT_THAT(counters32.m_wastedBytes, Eq(0U));
+    EXPECT_THAT(counters32.m_failedRequests, Eq(0U));
+    const auto counters128 = recording->getMemPoolCounters(1U);
+    EXPECT_THAT(counters128.m_requests, Eq(2U));
+    EXPECT_THAT(counters128.m_wastedBytes, Eq(CHUNK_SIZE_128 - CHUNK_SIZE_64));
+    EXPECT_THAT(counters128.m_failedRequests, Eq(1U));
+    EXPECT_THAT(recording->getRequestsWithoutMemPool(), Eq(1U));
+}
+
+TEST_F(MemoryManager_test, ChunkManagementsOfTheChunksOfAMemPoolAreStoredInAnArrayIndexedByTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58e2c3a9-0f41-4b7d-a6c3-d91e7b2f4056");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStore64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto chunkManagement32a = chunkStore32[0].release();
+    auto chunkManagement32b = chunkStore32[1].release();
+    auto chunkManagement64 = chunkStore64[0].release();
+
+    const auto distance =
+        std::abs(reinterpret_cast<uint8_t*>(chunkManagement32a) - reinterpret_cast<uint8_t*>(chunkManagement32b));
+    EXPECT_THAT(distance, Eq(static_cast<int64_t>(sizeof(iox::mepoo::ChunkManagement))));
+    EXPECT_THAT(chunkManagement64->m_chunkManagementPool.get(), Eq(nullptr));
+
+    // releasing and re-acquiring a chunk places its ChunkManagement at the same location
+    const auto chunkHeader64 = chunkManagement64->m_chunkHeader.get();
+    iox::mepoo::SharedChunk{chunkManagement64};
+    auto reacquiredChunkStore64 = getChunksFromSut(1U, chunkSettings_64);
+    ASSERT_THAT(reacquiredChunkStore64[0].getChunkHeader(), Eq(chunkHeader64));
+    EXPECT_THAT(reacquiredChunkStore64[0].release(), Eq(chunkManagement64));
+
+    iox::mepoo::SharedChunk{chunkManagement32a};
+    iox::mepoo::SharedChunk{chunkManagement32b};
+    iox::mepoo::SharedChunk{chunkManagement64};
+}
+
+TEST_F(MemoryManager_test, AllChunksCanBeAcquiredWhenTheManagementMemoryHasTheRequiredSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c47f19b2-83e5-4a6d-9b20-e5d8a13c7f69");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    const auto managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf);
+    const auto chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf);
+    iox::posix::Allocator managementAllocator(rawMemory, managementMemorySize);
+    iox::posix::Allocator chunkMemoryAllocator(static_cast<uint8_t*>(rawMemory) + managementMemorySize,
+                                               chunkMemorySize);
+    sut->configureMemoryManager(mempoolconf, managementAllocator, chunkMemoryAllocator);
+
+    auto chunkStore32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStore128 = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+    EXPECT_THAT(sut->getMaxUsagePercent(), Eq(100U));
+}
+
 TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be653b65-a2d1-42eb-98b5-d161c6ba7c08");
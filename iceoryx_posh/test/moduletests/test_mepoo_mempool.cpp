@@ -168,6 +168,25 @@ TEST_F(MemPool_test, VerifyFreeChunkMethodWhichFreesTheUsedChunk)
     }
 }
 
+TEST_F(MemPool_test, GetChunkIndexReturnsTheIndexOfTheChunkInTheMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c8e5a17-94b2-4f60-8d1e-b7a25c04f918");
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(reinterpret_cast<uint8_t*>(sut.getChunk()));
+    }
+
+    std::vector<bool> isIndexUsed(NUMBER_OF_CHUNKS, false);
+    for (const auto chunk : chunks)
+    {
+        const auto index = sut.getChunkIndex(chunk);
+        ASSERT_THAT(index, Lt(NUMBER_OF_CHUNKS));
+        EXPECT_FALSE(isIndexUsed[index]);
+        isIndexUsed[index] = true;
+    }
+}
+
 TEST_F(MemPool_test, FreeChunkMethodWhenSameChunkIsTriedToFreeTwiceReturnsError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0fc95552-4714-4a8a-9144-98aafbd37dc7");
@@ -123,6 +123,18 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::cxx::perms, permissions, iox::cxx::perms::none)
 
+        IOX_BUILDER_PARAMETER(bool, useHugePages, false)
+
+        IOX_BUILDER_PARAMETER(bool, prefault, false)
+
+        IOX_BUILDER_PARAMETER(uint32_t, numberOfPrefaultThreads, 1U)
+
+        IOX_BUILDER_PARAMETER(bool, lockMemory, false)
+
+        IOX_BUILDER_PARAMETER(iox::cxx::optional<SharedMemory::FilePath_t>, filePath, iox::cxx::nullopt)
+
+        IOX_BUILDER_PARAMETER(bool, synchronousMapping, false)
+
       public:
         iox::cxx::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
@@ -184,6 +196,40 @@ TEST_F(MePooSegment_test, SharedMemoryCreationParameter)
         MePooSegment_test::SharedMemoryObject_MOCK::createFct();
 }
 
+TEST_F(MePooSegment_test, SegmentFileIsReusedWithTheConfiguredSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7e2c9d4-3b18-4f6a-8e05-6d1f9b2c7e43");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    constexpr uint64_t FILE_SIZE{1U << 22U};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [&](const SharedMemory::Name_t,
+                                                                        const uint64_t memorySizeInBytes,
+                                                                        const iox::posix::AccessMode,
+                                                                        const iox::posix::OpenMode openMode,
+                                                                        const void*,
+                                                                        const iox::cxx::perms) {
+        EXPECT_THAT(memorySizeInBytes, Eq(FILE_SIZE));
+        EXPECT_THAT(openMode, Eq(iox::posix::OpenMode::OPEN_OR_CREATE));
+    };
+    SegmentFile file;
+    file.m_path = "/tmp/roudi_segment_file_test";
+    file.m_size = FILE_SIZE;
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            iox::mepoo::MemoryInfo(),
+            false,
+            false,
+            false,
+            file};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    ASSERT_TRUE(sut.getFile().has_value());
+    EXPECT_THAT(sut.getFile()->m_path, Eq(file.m_path));
+}
+
 TEST_F(MePooSegment_test, GetSharedMemoryObject)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e1c12dd0-fd7d-4be3-918b-08d16a68c8e0");
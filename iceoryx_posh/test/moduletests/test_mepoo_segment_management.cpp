@@ -26,6 +26,8 @@
 #include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 
 namespace
 {
@@ -40,7 +42,11 @@ class MePooSegmentMock
                      Allocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const bool useHugePages IOX_MAYBE_UNUSED,
+                     const bool prefault IOX_MAYBE_UNUSED,
+                     const bool lockMemory IOX_MAYBE_UNUSED,
+                     const iox::cxx::optional<SegmentFile>& file IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
@@ -201,6 +207,63 @@ TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupFails)
     EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT));
 }
 
+TEST_F(SegmentManager_test, overflowSegmentIsCreatedWhenTheUsageThresholdIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c2e7f08-a91b-4d36-b7c4-0e8d3f6a1b92");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SegmentOverflow overflow;
+    overflow.m_maxSegments = 1U;
+    overflow.m_thresholdPercent = 70U;
+    SegmentConfig segmentConfig;
+    segmentConfig.m_sharedMemorySegments.push_back({"iox_roudi_test1",
+                                                    "iox_roudi_test2",
+                                                    mepooConfig,
+                                                    MemoryInfo(),
+                                                    false,
+                                                    false,
+                                                    false,
+                                                    iox::cxx::nullopt,
+                                                    overflow});
+    SUT sut{segmentConfig, &allocator};
+    auto& memoryManager =
+        sut.getSegmentInformationWithWriteAccessForUser(PosixUser{"iox_roudi_test2"}).m_memoryManager.value().get();
+    auto chunkSettings = ChunkSettings::create(128U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    std::vector<SharedChunk> chunks;
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        chunks.emplace_back(memoryManager.getChunk(chunkSettings).value());
+    }
+    sut.createOverflowSegmentsOnDemand();
+    EXPECT_THAT(sut.getNumberOfSegments(), Eq(1U));
+
+    chunks.emplace_back(memoryManager.getChunk(chunkSettings).value());
+    sut.createOverflowSegmentsOnDemand();
+    ASSERT_THAT(sut.getNumberOfSegments(), Eq(2U));
+    EXPECT_THAT(memoryManager.getOverflowMemoryManager(), Eq(nullptr));
+
+    sut.linkOverflowSegments(1U);
+    EXPECT_THAT(memoryManager.getOverflowMemoryManager(), Eq(nullptr));
+
+    sut.linkOverflowSegments(2U);
+    ASSERT_THAT(memoryManager.getOverflowMemoryManager(), Ne(nullptr));
+
+    auto mapping = sut.getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(2U));
+    EXPECT_TRUE(mapping[1].m_isWritable);
+    EXPECT_THAT(mapping[1].m_sharedMemoryName, Eq(iox::ShmName_t("iox_roudi_test2_overflow1")));
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        chunks.emplace_back(memoryManager.getChunk(chunkSettings).value());
+    }
+    EXPECT_THAT(memoryManager.getOverflowMemoryManager()->getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+
+    sut.createOverflowSegmentsOnDemand();
+    EXPECT_THAT(sut.getNumberOfSegments(), Eq(2U));
+}
+
 TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "79db009a-da1a-4140-b375-f174af615d54");
@@ -53,14 +53,13 @@ class SharedChunk_Test : public Test
         return v;
     }
 
-    static constexpr uint32_t CHUNK_SIZE{64U};
     static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
     static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
 
     char memory[4096U];
     iox::posix::Allocator allocator{memory, 4096U};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
-    MemPool chunkMgmtPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+    MemPool chunkMgmtPool{sizeof(ChunkManagement), NUMBER_OF_CHUNKS, allocator, allocator};
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
     SharedChunk sut{chunkManagement};
@@ -322,4 +321,72 @@ TEST_F(SharedChunk_Test, ReleaseMethodReturnsChunkManagementPointerOfSharedChunk
     EXPECT_EQ(sut.getChunkHeader(), nullptr);
 }
 
+TEST_F(SharedChunk_Test, HasNoOtherOwnersIsTrueForTheOnlyOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "00f9bfe7-daa3-4641-bce6-c207c97b1afd");
+    EXPECT_TRUE(sut.hasNoOtherOwners());
+}
+
+TEST_F(SharedChunk_Test, HasNoOtherOwnersIsFalseWhenTheChunkIsShared)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "288bb5d0-87bd-46b4-87f9-86c6eb90ca4d");
+    {
+        SharedChunk otherOwner(sut);
+        EXPECT_FALSE(sut.hasNoOtherOwners());
+        EXPECT_FALSE(otherOwner.hasNoOtherOwners());
+    }
+    EXPECT_TRUE(sut.hasNoOtherOwners());
+}
+
+TEST_F(SharedChunk_Test, HasNoOtherOwnersIsFalseForAnEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7af35882-921b-455f-b7d3-aa4f1c3c60cb");
+    SharedChunk sut;
+
+    EXPECT_FALSE(sut.hasNoOtherOwners());
+}
+
+TEST_F(SharedChunk_Test, AppendedSegmentsAreChainedInTheChunkHeaders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "932d3941-06da-48c4-a3fd-12cb5f92dfef");
+    auto firstSegment = GetChunkManagement(mempool.getChunk());
+    auto secondSegment = GetChunkManagement(mempool.getChunk());
+
+    sut.appendSegment(SharedChunk(firstSegment));
+    sut.appendSegment(SharedChunk(secondSegment));
+
+    ASSERT_THAT(sut.getChunkHeader()->nextSegment(), Eq(firstSegment->m_chunkHeader.get()));
+    ASSERT_THAT(firstSegment->m_chunkHeader->nextSegment(), Eq(secondSegment->m_chunkHeader.get()));
+    EXPECT_THAT(secondSegment->m_chunkHeader->nextSegment(), Eq(nullptr));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(3U));
+}
+
+TEST_F(SharedChunk_Test, AppendedSegmentsAreFreedTogetherWithTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58b81e1a-73dc-4ce1-83d1-a19ee7d58506");
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - 1U; ++i)
+    {
+        sut.appendSegment(SharedChunk(GetChunkManagement(mempool.getChunk())));
+    }
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+
+    sut = SharedChunk();
+
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(SharedChunk_Test, AppendedSegmentsAreKeptAliveByOtherOwnersOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "866329ab-a86d-4334-b771-6ed2cfc8c50d");
+    sut.appendSegment(SharedChunk(GetChunkManagement(mempool.getChunk())));
+    SharedChunk otherOwner(sut);
+
+    sut = SharedChunk();
+
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(2U));
+    otherOwner = SharedChunk();
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+}
+
 } // namespace
@@ -141,7 +141,7 @@ class SharedPointer_Test : public Test
     char memory[4096U];
     iox::posix::Allocator allocator{memory, 4096U};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, 10U, allocator, allocator};
-    MemPool chunkMgmtPool{64U, 10U, allocator, allocator};
+    MemPool chunkMgmtPool{sizeof(ChunkManagement), 10U, allocator, allocator};
 
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
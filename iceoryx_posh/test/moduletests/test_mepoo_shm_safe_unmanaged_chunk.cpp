@@ -182,6 +182,68 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.cloneToSharedChunk());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, CallCloneToSharedChunkIfReferencedOnDefaultConstructedSutResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a03d1dc1-1691-4851-9f72-f1be59b819ed");
+    ShmSafeUnmanagedChunk sut;
+
+    EXPECT_FALSE(sut.cloneToSharedChunkIfReferenced());
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallCloneToSharedChunkIfReferencedOnReferencedChunkResultsInNotEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd576803-ca23-480c-8641-3c8f737521e3");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+
+    auto clonedSharedChunk = sut.cloneToSharedChunkIfReferenced();
+    EXPECT_TRUE(clonedSharedChunk);
+
+    sut.releaseToSharedChunk();
+    sharedChunk = SharedChunk();
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 1U);
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallCloneToSharedChunkIfReferencedOnAlreadyFreedChunkResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59a9e10b-b8f7-42c3-87f5-1dee64a837a8");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    ShmSafeUnmanagedChunk copyWithoutOwnership = sut;
+    sut.releaseToSharedChunk();
+    sharedChunk = SharedChunk();
+    ASSERT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+
+    EXPECT_FALSE(copyWithoutOwnership.cloneToSharedChunkIfReferenced());
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallCloneToSharedChunkIfReferencedOnReusedChunkResultsInSharedChunkOfTheNewChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0beaf5e7-ee4a-4d3d-b7db-034c4155b72b");
+    auto sharedChunk = getChunkFromMemoryManager();
+    const auto* chunkHeader = sharedChunk.getChunkHeader();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    ShmSafeUnmanagedChunk copyWithoutOwnership = sut;
+    sut.releaseToSharedChunk();
+    sharedChunk = SharedChunk();
+
+    // the ChunkManagement of the released chunk is reinitialized for the next chunk of the mempool
+    auto newSharedChunk = getChunkFromMemoryManager();
+    ASSERT_EQ(newSharedChunk.getChunkHeader(), chunkHeader);
+
+    auto clonedSharedChunk = copyWithoutOwnership.cloneToSharedChunkIfReferenced();
+    EXPECT_EQ(clonedSharedChunk.getChunkHeader(), chunkHeader);
+
+    clonedSharedChunk = SharedChunk();
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 1U);
+    newSharedChunk = SharedChunk();
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+}
+
 TEST_F(ShmSafeUnmanagedChunk_test, CallGetChunkHeaderOnNonConstDefaultConstructedSutResultsInNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ca9d879c-73e5-466f-a84c-356719b660f5");
@@ -59,6 +59,7 @@ class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<port_t>
     using SubscriberParent::disableState;
     using SubscriberParent::enableEvent;
     using SubscriberParent::enableState;
+    using SubscriberParent::getCallbackForIsStateConditionSatisfied;
     using SubscriberParent::takeChunk;
 
     using SubscriberParent::port;
@@ -202,6 +203,49 @@ TEST_F(BaseSubscriberTest, AttachEventToWaitsetForwardedToUnderlyingSubscriberPo
     EXPECT_CALL(sut.port(), unsetConditionVariable()).Times(1);
 }
 
+TEST_F(BaseSubscriberTest, AttachDeadlineMissedStateToWaitsetAttachesConditionVariableForMissedDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fc1e092-19ca-49d2-bc31-459f0be54cb7");
+    iox::popo::ConditionVariableData condVar("Horscht");
+    WaitSetTest waitSet(condVar);
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), setConditionVariable(_, _)).Times(0);
+    EXPECT_CALL(sut.port(), setConditionVariableForMissedDeadline(_, _)).Times(1);
+    // ===== Test ===== //
+    ASSERT_FALSE(waitSet.attachState(sut, iox::popo::SubscriberState::DEADLINE_MISSED).has_error());
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+    EXPECT_CALL(sut.port(), unsetConditionVariable()).Times(1);
+}
+
+TEST_F(BaseSubscriberTest, AttachDeadlineMissedEventToWaitsetAttachesConditionVariableForMissedDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a703ad0-06b5-4ef2-918a-ef469a3d59bf");
+    iox::popo::ConditionVariableData condVar("Horscht");
+    WaitSetTest waitSet(condVar);
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), setConditionVariable(_, _)).Times(0);
+    EXPECT_CALL(sut.port(), setConditionVariableForMissedDeadline(_, _)).Times(1);
+    // ===== Test ===== //
+    ASSERT_FALSE(waitSet.attachEvent(sut, iox::popo::SubscriberEvent::DEADLINE_MISSED).has_error());
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+    EXPECT_CALL(sut.port(), unsetConditionVariable()).Times(1);
+}
+
+TEST_F(BaseSubscriberTest, DeadlineMissedStateIsSatisfiedWhenTheDeadlineIsMissed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3264cbc-fca8-421b-b6db-9cafbecccf34");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), hasMissedDeadline).WillOnce(Return(true));
+    // ===== Test ===== //
+    auto callback = sut.getCallbackForIsStateConditionSatisfied(iox::popo::SubscriberState::DEADLINE_MISSED);
+    // ===== Verify ===== //
+    ASSERT_TRUE(callback.has_value());
+    EXPECT_TRUE((*callback)());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, WaitSetUnsetStateBasedConditionVariableWhenGoingOutOfScope)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9af5c23d-7584-4142-bd1b-1eaca706d887");
@@ -320,6 +364,28 @@ TEST_F(BaseSubscriberTest, HasMissedSamplesCallForwardedToUnderlyingSubscriberPo
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, HasMissedDeadlineCallForwardedToUnderlyingSubscriberPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b23ebc1-5456-49ef-b900-64a3ee95df23");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), hasMissedDeadline).Times(1);
+    // ===== Test ===== //
+    sut.hasMissedDeadline();
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, NumberOfExpiredSamplesCallForwardedToUnderlyingSubscriberPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86b9dc3b-013b-46bd-a145-767cdaaec62d");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), numberOfExpiredChunks).Times(1);
+    // ===== Test ===== //
+    sut.numberOfExpiredSamples();
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, DestroysUnderlyingPortOnDestruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a3004af-4ccd-4df0-bdd8-6e22e97d2428");
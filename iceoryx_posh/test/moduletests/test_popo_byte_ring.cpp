@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/byte_ring.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class ByteRing_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{64U};
+
+    void write(const std::string& record)
+    {
+        ASSERT_FALSE(sut.write(record.data(), static_cast<ByteRing::RecordSize_t>(record.size())).has_error());
+    }
+
+    std::string read(ByteRingReader& reader)
+    {
+        char buffer[CAPACITY];
+        auto result = reader.read(buffer, sizeof(buffer));
+        EXPECT_FALSE(result.has_error());
+        if (result.has_error())
+        {
+            return std::string();
+        }
+        return std::string(buffer, result.value());
+    }
+
+    alignas(ByteRing) uint8_t memory[sizeof(ByteRing) + CAPACITY];
+    ByteRing& sut{*new (memory) ByteRing(CAPACITY)};
+};
+
+TEST_F(ByteRing_test, CapacityMustBeAPowerOfTwoWhichCanHoldARecord)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b709e634-9676-4aa7-a009-35cc53e1bd18");
+    EXPECT_TRUE(ByteRing::isValidCapacity(16U));
+    EXPECT_TRUE(ByteRing::isValidCapacity(1024U * 1024U));
+    EXPECT_FALSE(ByteRing::isValidCapacity(0U));
+    EXPECT_FALSE(ByteRing::isValidCapacity(8U));
+    EXPECT_FALSE(ByteRing::isValidCapacity(96U));
+    EXPECT_FALSE(ByteRing::isValidCapacity(uint64_t{1U} << 32U));
+}
+
+TEST_F(ByteRing_test, MaxRecordSizeIsCapacityWithoutFrameHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96782de8-9d64-4dc4-88ea-24c5b50e5f10");
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+    EXPECT_THAT(sut.maxRecordSize(), Eq(CAPACITY - ByteRing::FRAME_HEADER_SIZE));
+}
+
+TEST_F(ByteRing_test, ReadingAnEmptyRingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aae96b56-253c-42dc-8dce-6657338b8c21");
+    ByteRingReader reader(sut);
+    char buffer[CAPACITY];
+
+    auto result = reader.read(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::NO_RECORD_AVAILABLE));
+    EXPECT_FALSE(reader.hasLostRecords());
+}
+
+TEST_F(ByteRing_test, RecordsAreReadInTheOrderTheyWereWritten)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "631ef82c-3187-429a-b6af-7d81c665d543");
+    ByteRingReader reader(sut);
+    write("hypnotoad");
+    write("");
+    write("brain slug");
+
+    EXPECT_THAT(read(reader), Eq("hypnotoad"));
+    EXPECT_THAT(read(reader), Eq(""));
+    EXPECT_THAT(read(reader), Eq("brain slug"));
+    EXPECT_TRUE(reader.read(nullptr, 0U).has_error());
+}
+
+TEST_F(ByteRing_test, WritingARecordLargerThanTheMaxRecordSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95cb31fa-a457-4c04-8261-02c6a79b1776");
+    char record[CAPACITY]{};
+
+    auto result = sut.write(record, sut.maxRecordSize() + 1U);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::RECORD_TOO_LARGE));
+    EXPECT_FALSE(sut.write(record, sut.maxRecordSize()).has_error());
+}
+
+TEST_F(ByteRing_test, RecordWhichDoesNotFitIntoTheBufferIsNotConsumed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b752d19-6973-40e1-8a0f-f692df8bc25c");
+    ByteRingReader reader(sut);
+    write("nibbler");
+    char buffer[4U];
+
+    auto result = reader.read(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::BUFFER_TOO_SMALL));
+    EXPECT_THAT(read(reader), Eq("nibbler"));
+}
+
+TEST_F(ByteRing_test, EveryReaderHasItsOwnCursor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5208f9ea-8b2a-4057-b4d0-6335d6862d93");
+    ByteRingReader readerA(sut);
+    ByteRingReader readerB(sut);
+    write("fry");
+    write("leela");
+
+    EXPECT_THAT(read(readerA), Eq("fry"));
+    EXPECT_THAT(read(readerA), Eq("leela"));
+    EXPECT_THAT(read(readerB), Eq("fry"));
+    EXPECT_THAT(read(readerB), Eq("leela"));
+}
+
+TEST_F(ByteRing_test, RecordsWrappingAroundTheEndOfTheRingAreReadCompletely)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e2de1a1-fffd-434f-8a7a-afc671b5137a");
+    ByteRingReader reader(sut);
+    for (uint32_t i = 0U; i < 20U; ++i)
+    {
+        const auto record = "record number " + std::to_string(i);
+        write(record);
+        EXPECT_THAT(read(reader), Eq(record));
+    }
+    EXPECT_FALSE(reader.hasLostRecords());
+}
+
+TEST_F(ByteRing_test, OverwrittenRecordsAreReportedAsLostAndTheReaderContinuesWithTheOldestRecord)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6f53a10-c057-47c3-a5e2-106645486c51");
+    ByteRingReader reader(sut);
+    // every record occupies 16 bytes including the frame header, the ring holds the last 4 of them
+    for (uint32_t i = 0U; i < 6U; ++i)
+    {
+        write("rec" + std::to_string(i));
+    }
+
+    EXPECT_THAT(read(reader), Eq("rec2"));
+    EXPECT_TRUE(reader.hasLostRecords());
+    EXPECT_FALSE(reader.hasLostRecords());
+    EXPECT_THAT(read(reader), Eq("rec3"));
+    EXPECT_THAT(read(reader), Eq("rec4"));
+    EXPECT_THAT(read(reader), Eq("rec5"));
+    EXPECT_FALSE(reader.hasLostRecords());
+}
+
+TEST_F(ByteRing_test, ReaderCreatedLaterStartsWithTheOldestAvailableRecord)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5cc0a5a-36b9-43e6-badd-da8b74fa454a");
+    char record[CAPACITY]{};
+    ASSERT_FALSE(sut.write(record, sut.maxRecordSize()).has_error());
+    write("bender");
+
+    ByteRingReader reader(sut);
+
+    EXPECT_THAT(read(reader), Eq("bender"));
+    EXPECT_FALSE(reader.hasLostRecords());
+}
+
+} // namespace
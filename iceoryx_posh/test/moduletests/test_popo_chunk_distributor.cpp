@@ -24,11 +24,13 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -36,6 +38,7 @@ using namespace ::testing;
 using namespace iox::popo;
 using namespace iox::cxx;
 using namespace iox::mepoo;
+using namespace iox::units::duration_literals;
 
 using ChunkDistributorTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -63,6 +66,52 @@ class ChunkDistributor_test : public Test
         *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
         return SharedChunk(chunkMgmt);
     }
+
+    SharedChunk allocateChunkWithUserHeader(const uint64_t value, const uint64_t userHeaderValue)
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        auto chunk = mempool.getChunk();
+
+        auto chunkSettingsResult =
+            ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t), alignof(uint64_t));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+        *static_cast<uint64_t*>(chunkHeader->userHeader()) = userHeaderValue;
+        return SharedChunk(chunkMgmt);
+    }
+
+    SharedChunk allocateSmallChunk(const uint64_t value)
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        auto chunk = mempool.getChunk();
+
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+        return SharedChunk(chunkMgmt);
+    }
+
+    static uint64_t getInlineValue(const ChunkHeader* const chunkHeader)
+    {
+        return *static_cast<const uint64_t*>(chunkHeader->userPayload());
+    }
+
     uint32_t getSharedChunkValue(const SharedChunk& chunk)
     {
         return *static_cast<uint32_t*>(chunk.getUserPayload());
@@ -116,6 +165,38 @@ class ChunkDistributor_test : public Test
         return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
     }
 
+    std::shared_ptr<ChunkDistributorData_t> getLatestValueChunkDistributorData()
+    {
+        constexpr bool LATEST_VALUE_ONLY{true};
+        return std::make_shared<ChunkDistributorData_t>(
+            ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_SIZE, LATEST_VALUE_ONLY);
+    }
+
+    std::shared_ptr<ChunkDistributorData_t> getInlineChunkDistributorData(const uint64_t historyCapacity = 0U)
+    {
+        constexpr bool LATEST_VALUE_ONLY{false};
+        constexpr bool INLINE_DELIVERY{true};
+        return std::make_shared<ChunkDistributorData_t>(
+            ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, historyCapacity, LATEST_VALUE_ONLY, INLINE_DELIVERY);
+    }
+
+    std::shared_ptr<ChunkQueueData_t> getChunkQueueDataWithInlineSlots()
+    {
+        auto queueData = getChunkQueueData();
+        m_inlineSlots.emplace_back(new InlineSlots());
+        ChunkQueuePopper<ChunkQueueData_t>(queueData.get()).attachInlineSlots(m_inlineSlots.back().get());
+        return queueData;
+    }
+
+    std::shared_ptr<ChunkQueueData_t> getFilteredChunkQueueData(const uint64_t acceptedUserHeaderValue)
+    {
+        auto queueData = getChunkQueueData();
+        queueData->m_userHeaderFilter = UserHeaderFilter::equalTo(0U, sizeof(uint64_t), acceptedUserHeaderValue);
+        return queueData;
+    }
+
+    std::vector<std::unique_ptr<InlineSlots>> m_inlineSlots;
+
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
 
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
@@ -822,4 +903,375 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, LatestValueModeDoesNotPushIntoQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "296d71a4-e8e1-45f9-beb9-8cae7fb050a5");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.size(), Eq(0U));
+    EXPECT_FALSE(queue.empty());
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeNotifiesTheConditionVariablesOfTheQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "323ef9e0-437c-449c-959c-78a80453d6a3");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    queue1.setConditionVariable(condVar, 0U);
+    queue2.setConditionVariable(condVar, 1U);
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+
+    auto notificationIds = condVarWaiter.timedWait(1_ns);
+    ASSERT_THAT(notificationIds.size(), Eq(2U));
+    EXPECT_THAT(notificationIds[0], Eq(0U));
+    EXPECT_THAT(notificationIds[1], Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeProvidesOnlyTheNewestChunkToEveryQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "422a9e0c-6843-4625-9e47-6cd03c9f6e98");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2));
+
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeProvidesTheNewestChunkToALateJoiningQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0acc9deb-9401-4ad5-959a-41b305b60ea8");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2));
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeDoesNotProvideChunksToRemovedQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7a5e227-d585-4843-b559-76c620626d9a");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeDoesNotProvideChunksAfterRemovingAllQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3da0044-910f-4346-9e89-2c07eb6691ac");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.removeAllQueues();
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeClearHistoryReleasesTheNewestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0af87372-1989-44b3-8393-8b916f59de9c");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+
+    sut.clearHistory();
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeCopiesSmallChunksIntoTheInlineSlotsOfEveryQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9734a62-9ea2-420b-a6e1-bfd002d4756f");
+    auto sutData = this->getInlineChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData1 = this->getChunkQueueDataWithInlineSlots();
+    auto queueData2 = this->getChunkQueueDataWithInlineSlots();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateSmallChunk(7U)), Eq(2U));
+
+    // the queues hold copies, the chunk was released when the last reference went out of scope
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        EXPECT_FALSE(queue.tryPop().has_value());
+        const auto* chunkHeader = queue.tryPopInline();
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(this->getInlineValue(chunkHeader), Eq(7U));
+        EXPECT_TRUE(queue.releaseInline(chunkHeader));
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeDeliversChunksWhichDoNotFitIntoAnInlineSlotAsChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9c3017c-a43a-4ccf-8690-a91cb8e6ef29");
+    auto sutData = this->getInlineChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueDataWithInlineSlots();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(3U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_THAT(queue.tryPopInline(), Eq(nullptr));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3U));
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeWithOverflowingQueueDiscardsTheOldestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09aaf359-49dd-4b1c-b749-c62c62f713ee");
+    auto sutData = this->getInlineChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueDataWithInlineSlots();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint64_t i = 0U; i <= InlineSlots::CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateSmallChunk(i)), Eq(1U));
+    }
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.hasLostChunks());
+    const auto* chunkHeader = queue.tryPopInline();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(this->getInlineValue(chunkHeader), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeCopiesTheHistoryIntoTheInlineSlotsOfALateJoiningQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bdf9b374-adf9-4ac6-a4d1-b59087fd2aba");
+    auto sutData = this->getInlineChunkDistributorData(this->HISTORY_SIZE);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateSmallChunk(1U));
+    sut.deliverToAllStoredQueues(this->allocateSmallChunk(2U));
+
+    auto queueData = this->getChunkQueueDataWithInlineSlots();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 2U).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_FALSE(queue.tryPop().has_value());
+    for (uint64_t value = 1U; value <= 2U; ++value)
+    {
+        const auto* chunkHeader = queue.tryPopInline();
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(this->getInlineValue(chunkHeader), Eq(value));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeDeliversChunksToQueuesWithoutInlineSlotsAsChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26137ca3-6519-4751-a5c2-f773a040e9bc");
+    auto sutData = this->getInlineChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateSmallChunk(5U)), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_FALSE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getInlineValue(maybeSharedChunk->getChunkHeader()), Eq(5U));
+}
+
+TYPED_TEST(ChunkDistributor_test, InlineModeIsDisabledInTheLatestValueMode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5acf7615-bca8-48be-8670-3a1696e85d8b");
+    constexpr bool LATEST_VALUE_ONLY{true};
+    constexpr bool INLINE_DELIVERY{true};
+    typename TestFixture::ChunkDistributorData_t sutData(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, LATEST_VALUE_ONLY, INLINE_DELIVERY);
+
+    EXPECT_FALSE(sutData.m_inlineDelivery);
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesSkipsQueueWhoseFilterRejectsTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85619309-ed15-4218-82ff-066e33a1f8a3");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto unfilteredQueueData = this->getChunkQueueData();
+    auto filteredQueueData = this->getFilteredChunkQueueData(1U);
+    ASSERT_FALSE(sut.tryAddQueue(unfilteredQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(filteredQueueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(11U, 2U)), Eq(1U));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(12U, 1U)), Eq(2U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> unfilteredQueue(unfilteredQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> filteredQueue(filteredQueueData.get());
+    EXPECT_THAT(unfilteredQueue.size(), Eq(2U));
+    ASSERT_THAT(filteredQueue.size(), Eq(1U));
+    auto maybeSharedChunk = filteredQueue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(12U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkWithoutUserHeaderIsNotDeliveredToFilteredQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90a37c70-e870-4a43-b85a-910bd10dac03");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getFilteredChunkQueueData(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1U)), Eq(0U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, HistoryOnAddIsFilteredForFilteredQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20c06914-954f-40a8-a559-655307f223d6");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 1U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 2U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(3U, 1U));
+
+    auto queueData = this->getFilteredChunkQueueData(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 3U).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_THAT(queue.size(), Eq(2U));
+    for (const uint32_t expectedValue : {1U, 3U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueModeDoesNotProvideRejectedChunkToFilteredQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f7a9eaa-6020-45dc-b642-4d120d6de8c8");
+    auto sutData = this->getLatestValueChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getFilteredChunkQueueData(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 2U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 1U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesSkipsSamplesNotAdmittedByTheRateLimiterOfTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37204d98-5972-448e-84f2-b743336f91b9");
+    constexpr uint64_t DECIMATION{3U};
+    constexpr uint64_t NUMBER_OF_CHUNKS{7U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto unlimitedQueueData = this->getChunkQueueData();
+    auto limitedQueueData = this->getChunkQueueData();
+    limitedQueueData->m_deliveryRateLimiter.configure(DECIMATION, iox::units::Duration::zero());
+    ASSERT_FALSE(sut.tryAddQueue(unlimitedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(limitedQueueData.get()).has_error());
+
+    uint64_t numberOfDeliveries{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        numberOfDeliveries += sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> unlimitedQueue(unlimitedQueueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> limitedQueue(limitedQueueData.get());
+    EXPECT_THAT(unlimitedQueue.size(), Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(limitedQueue.size(), Eq(3U));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_CHUNKS + 3U));
+    for (const uint32_t expectedValue : {0U, 3U, 6U})
+    {
+        auto maybeSharedChunk = limitedQueue.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, RateLimiterCountsOnlySamplesAcceptedByTheFilter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13616997-0a7e-435f-a310-9f3671fe4536");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getFilteredChunkQueueData(1U);
+    queueData->m_deliveryRateLimiter.configure(2U, iox::units::Duration::zero());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(1U, 1U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(2U, 2U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(3U, 1U));
+    sut.deliverToAllStoredQueues(this->allocateChunkWithUserHeader(4U, 1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_THAT(queue.size(), Eq(2U));
+    for (const uint32_t expectedValue : {1U, 4U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+}
+
 } // namespace
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/typed_mem_pool.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
@@ -25,9 +26,14 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/conflation_key_header.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -59,6 +65,37 @@ class ChunkQueue_testBase
         return SharedChunk(chunkMgmt);
     }
 
+    SharedChunk allocateChunkWithConflationKey(const uint64_t key,
+                                               const uint64_t value,
+                                               const uint16_t userHeaderId = ConflationKeyHeader::USER_HEADER_ID)
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        auto chunk = mempool.getChunk();
+
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t),
+                                                         alignof(uint64_t),
+                                                         sizeof(ConflationKeyHeader),
+                                                         alignof(ConflationKeyHeader));
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
+        chunkHeader->setUserHeaderId(userHeaderId);
+        static_cast<ConflationKeyHeader*>(chunkHeader->userHeader())->key = key;
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+        new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        return SharedChunk(chunkMgmt);
+    }
+
+    static uint64_t getValue(const SharedChunk& chunk)
+    {
+        return *static_cast<const uint64_t*>(chunk.getUserPayload());
+    }
+
     static constexpr uint32_t USER_PAYLOAD_SIZE{128U};
     static constexpr size_t MEGABYTE = 1U << 20U;
     static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
@@ -99,6 +136,7 @@ class ChunkQueue_test : public Test, public ChunkQueue_testBase
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, m_variantQueueType};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+    InlineSlots m_inlineSlots;
 };
 
 TYPED_TEST(ChunkQueue_test, InitialEmpty)
@@ -264,6 +302,195 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushDoesNotNotifyConditionVariableAttachedForMissedDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7a36c3f-f489-45ac-9ae3-21a93f00cf57");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariableForMissedDeadline(condVar, 0U);
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, MissedDeadlineIsNotNotifiedWithoutDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "886bb1fa-9c4d-4054-a9ff-0a5d5f738e86");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariableForMissedDeadline(condVar, 0U);
+
+    EXPECT_FALSE(this->m_popper.notifyOnMissedDeadline());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, MissedDeadlineIsNotifiedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8ee82e9-9cf4-416d-9d5f-49c8aa845834");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_deadlineNs = 1U;
+    this->m_chunkData.m_lastArrivalTimestampNs.store(monotonicTimestamp());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    this->m_popper.setConditionVariableForMissedDeadline(condVar, 0U);
+
+    EXPECT_TRUE(this->m_popper.notifyOnMissedDeadline());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_FALSE(this->m_popper.notifyOnMissedDeadline());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, MissedDeadlineIsNotifiedAgainWhenMissedAfterTheNextChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4fddd4fe-1d10-4308-af87-3846e443465f");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_chunkData.m_deadlineNs = 1U;
+    this->m_chunkData.m_lastArrivalTimestampNs.store(monotonicTimestamp());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    this->m_popper.setConditionVariableForMissedDeadline(condVar, 0U);
+    ASSERT_TRUE(this->m_popper.notifyOnMissedDeadline());
+    condVarWaiter.timedWait(1_ns);
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    EXPECT_TRUE(this->m_popper.notifyOnMissedDeadline());
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, PushInlineCopiesTheChunkIntoAnInlineSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a53d50d7-4f2e-4819-9022-fcfa8690795b");
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+    ChunkMock<uint64_t> chunk;
+    *chunk.sample() = 73U;
+
+    EXPECT_TRUE(this->m_pusher.pushInline(*chunk.chunkHeader()));
+
+    EXPECT_FALSE(this->m_popper.empty());
+    EXPECT_FALSE(this->m_popper.tryPop().has_value());
+    const auto* chunkHeader = this->m_popper.tryPopInline();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(*static_cast<const uint64_t*>(chunkHeader->userPayload()), Eq(73U));
+    EXPECT_TRUE(this->m_popper.empty());
+    EXPECT_TRUE(this->m_popper.releaseInline(chunkHeader));
+}
+
+TYPED_TEST(ChunkQueue_test, PushInlineAndNotifyConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1eec955e-e7d1-4253-b7ea-a772b694d49d");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+    ChunkMock<uint64_t> chunk;
+
+    this->m_pusher.pushInline(*chunk.chunkHeader());
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, ClearReleasesThePendingInlineSlotsButNotTheTakenOnes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9dee17da-7b89-4429-bc21-b9b174e7f545");
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+    ChunkMock<uint64_t> chunk;
+    this->m_pusher.pushInline(*chunk.chunkHeader());
+    this->m_pusher.pushInline(*chunk.chunkHeader());
+    const auto* takenChunkHeader = this->m_popper.tryPopInline();
+    ASSERT_THAT(takenChunkHeader, Ne(nullptr));
+
+    this->m_popper.clear();
+
+    EXPECT_TRUE(this->m_popper.empty());
+    EXPECT_THAT(this->m_popper.tryPopInline(), Eq(nullptr));
+    EXPECT_TRUE(this->m_popper.releaseInline(takenChunkHeader));
+}
+
+TYPED_TEST(ChunkQueue_test, InitiallyNoInlineSlotsAreAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5fa0dad-e036-4316-8961-4c6a442fb358");
+    EXPECT_FALSE(this->m_popper.hasInlineSlots());
+    EXPECT_FALSE(this->m_pusher.hasInlineSlots());
+    EXPECT_THAT(this->m_popper.detachInlineSlots(), Eq(nullptr));
+}
+
+TYPED_TEST(ChunkQueue_test, AttachedInlineSlotsCanBeDetached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "392d77b3-e5d8-40ea-bb9f-728ac14bce18");
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+
+    EXPECT_TRUE(this->m_popper.hasInlineSlots());
+    EXPECT_TRUE(this->m_pusher.hasInlineSlots());
+    EXPECT_THAT(this->m_popper.detachInlineSlots(), Eq(&this->m_inlineSlots));
+    EXPECT_FALSE(this->m_popper.hasInlineSlots());
+}
+
+TYPED_TEST(ChunkQueue_test, PushInlineWithoutInlineSlotsLosesTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8cb1e15f-df07-4182-a930-71c0ff5dd29f");
+    ChunkMock<uint64_t> chunk;
+
+    EXPECT_FALSE(this->m_pusher.pushInline(*chunk.chunkHeader()));
+
+    EXPECT_TRUE(this->m_popper.empty());
+    EXPECT_TRUE(this->m_popper.hasLostChunks());
+}
+
+TYPED_TEST(ChunkQueue_test, InlineChunksAndChunksInTheQueueArePoppedInTheOrderOfArrival)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab0485fd-943c-4407-b5b2-7c98f61d855d");
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+    ChunkMock<uint64_t> inlineChunk;
+    *inlineChunk.sample() = 2U;
+
+    auto firstChunk = this->allocateChunk();
+    *static_cast<uint64_t*>(firstChunk.getUserPayload()) = 1U;
+    this->m_pusher.push(firstChunk);
+    this->m_pusher.pushInline(*inlineChunk.chunkHeader());
+    auto lastChunk = this->allocateChunk();
+    *static_cast<uint64_t*>(lastChunk.getUserPayload()) = 3U;
+    this->m_pusher.push(lastChunk);
+
+    EXPECT_FALSE(this->m_popper.isInlineChunkNext());
+    auto maybeFirstChunk = this->m_popper.tryPop();
+    ASSERT_TRUE(maybeFirstChunk.has_value());
+    EXPECT_THAT(this->getValue(*maybeFirstChunk), Eq(1U));
+
+    ASSERT_TRUE(this->m_popper.isInlineChunkNext());
+    const auto* chunkHeader = this->m_popper.tryPopInline();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(*static_cast<const uint64_t*>(chunkHeader->userPayload()), Eq(2U));
+    EXPECT_TRUE(this->m_popper.releaseInline(chunkHeader));
+
+    EXPECT_FALSE(this->m_popper.isInlineChunkNext());
+    auto maybeLastChunk = this->m_popper.tryPop();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(this->getValue(*maybeLastChunk), Eq(3U));
+}
+
+TYPED_TEST(ChunkQueue_test, InlineChunkIsNextWhenTheChunksWhichArrivedBeforeItWereCleared)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a16ae33-9fa2-4d43-8ce8-f1eb3c386b01");
+    this->m_popper.attachInlineSlots(&this->m_inlineSlots);
+    ChunkMock<uint64_t> inlineChunk;
+
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+    this->m_popper.clear();
+    this->m_pusher.pushInline(*inlineChunk.chunkHeader());
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_TRUE(this->m_popper.isInlineChunkNext());
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -282,6 +509,7 @@ class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
                                  iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+    InlineSlots m_inlineSlots;
 };
 
 TYPED_TEST(ChunkQueueFiFo_test, InitialSize)
@@ -346,6 +574,7 @@ class ChunkQueueSoFi_test : public Test, public ChunkQueue_testBase
                                  iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+    InlineSlots m_inlineSlots;
 };
 
 TYPED_TEST(ChunkQueueSoFi_test, InitialSize)
@@ -416,4 +645,133 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TYPED_TEST_SUITE(ChunkQueueConflation_test, ChunkQueueSubjects, );
+
+template <typename TestTypes>
+class ChunkQueueConflation_test : public Test, public ChunkQueue_testBase
+{
+  public:
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, typename TestTypes::PolicyType_t>;
+
+    void pushWithKey(const uint64_t key, const uint64_t value)
+    {
+        EXPECT_TRUE(m_pusher.push(allocateChunkWithConflationKey(key, value)));
+    }
+
+    void expectPoppedValue(const uint64_t value)
+    {
+        auto maybeChunk = m_popper.tryPop();
+        ASSERT_TRUE(maybeChunk.has_value());
+        EXPECT_THAT(getValue(*maybeChunk), Eq(value));
+    }
+
+    ChunkQueueData_t m_chunkData{
+        QueueFullPolicy::DISCARD_OLDEST_DATA, TestTypes::variantQueueType, QueueConflationPolicy::KEEP_LATEST_PER_KEY};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+    InlineSlots m_inlineSlots;
+};
+
+TYPED_TEST(ChunkQueueConflation_test, ChunkWithSameKeyReplacesPendingChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a0a1cc6-b39e-4d1f-a8a4-2c1e63f9b1f4");
+    this->pushWithKey(1U, 10U);
+    this->pushWithKey(1U, 11U);
+
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+    this->expectPoppedValue(11U);
+    EXPECT_TRUE(this->m_popper.empty());
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ReplacedChunkIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61d4a7a8-f0b5-4d04-9a86-0e5f8b6fb3c1");
+    this->pushWithKey(1U, 10U);
+    this->pushWithKey(1U, 11U);
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ChunksWithDifferentKeysAreQueued)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b8d5c55-7c4a-4c3b-93b4-7e49e9d1a0c2");
+    this->pushWithKey(1U, 10U);
+    this->pushWithKey(2U, 20U);
+    this->pushWithKey(3U, 30U);
+
+    EXPECT_THAT(this->m_popper.size(), Eq(3U));
+    this->expectPoppedValue(10U);
+    this->expectPoppedValue(20U);
+    this->expectPoppedValue(30U);
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ReplacedChunkKeepsItsPositionInTheQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5e3f6f1-0c71-4a9d-9f59-5d2f0e3c8a17");
+    this->pushWithKey(1U, 10U);
+    this->pushWithKey(2U, 20U);
+    this->pushWithKey(3U, 30U);
+    this->pushWithKey(2U, 21U);
+
+    EXPECT_THAT(this->m_popper.size(), Eq(3U));
+    this->expectPoppedValue(10U);
+    this->expectPoppedValue(21U);
+    this->expectPoppedValue(30U);
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ChunkWithSameKeyAsAlreadyPoppedChunkIsQueued)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f7c0e9b-3b2c-47e5-a6a0-1d8f6b5e2c93");
+    this->pushWithKey(1U, 10U);
+    this->expectPoppedValue(10U);
+
+    this->pushWithKey(1U, 11U);
+
+    this->expectPoppedValue(11U);
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ChunksWithoutKeyAreQueued)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e1b6d2a-58f4-4c1e-b0a7-6c3d2f8e4b15");
+    this->m_pusher.push(this->allocateChunk());
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(this->m_popper.size(), Eq(2U));
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ChunkWithKeyDoesNotReplaceChunkWithoutKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a8e5d7-2f61-4b9c-8e04-7a1d5b3f6e28");
+    this->m_pusher.push(this->allocateChunk());
+    this->pushWithKey(0U, 1U);
+
+    EXPECT_THAT(this->m_popper.size(), Eq(2U));
+}
+
+TYPED_TEST(ChunkQueueConflation_test, ChunksWithOtherUserHeaderAreNotConflated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcb842c5-bb85-47d7-8e72-3ed9e7847711");
+    // e.g. a custom user-header which starts with a constant version field
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunkWithConflationKey(1U, 10U, ChunkHeader::UNKNOWN_USER_HEADER)));
+    EXPECT_TRUE(this->m_pusher.push(this->allocateChunkWithConflationKey(1U, 11U, ChunkHeader::UNKNOWN_USER_HEADER)));
+
+    EXPECT_THAT(this->m_popper.size(), Eq(2U));
+    this->expectPoppedValue(10U);
+    this->expectPoppedValue(11U);
+}
+
+TYPED_TEST(ChunkQueueConflation_test, PushNotifiesConditionVariableWhenChunkIsReplaced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d2f4a6c-9e13-4b58-a1c7-3e6b8d0f2a94");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->pushWithKey(1U, 10U);
+    EXPECT_FALSE(condVarWaiter.timedWait(1_ns).empty());
+
+    this->pushWithKey(1U, 11U);
+
+    EXPECT_FALSE(condVarWaiter.timedWait(1_ms).empty());
+}
+
 } // namespace
@@ -20,15 +20,21 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 namespace
 {
@@ -54,6 +60,7 @@ class ChunkReceiver_test : public Test
 
     void SetUp() override
     {
+        m_chunkReceiver.attachInlineSlots(&m_inlineSlots);
     }
 
     void TearDown() override
@@ -91,8 +98,43 @@ class ChunkReceiver_test : public Test
     ChunkReceiverData_t m_chunkReceiverData{iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
                                             iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA};
     iox::popo::ChunkReceiver<ChunkReceiverData_t> m_chunkReceiver{&m_chunkReceiverData};
+    iox::popo::InlineSlots m_inlineSlots;
 
     iox::popo::ChunkQueuePusher<ChunkReceiverData_t> m_chunkQueuePusher{&m_chunkReceiverData};
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = iox::MAX_SUBSCRIBERS_PER_PUBLISHER;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    ChunkSenderData_t m_chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
+    ChunkSenderData_t m_inlineChunkSenderData{&m_memoryManager,
+                                              iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                              0U,
+                                              iox::mepoo::MemoryInfo(),
+                                              iox::mepoo::NO_MEMPOOL_RESERVATION,
+                                              false,
+                                              true};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_inlineChunkSender{&m_inlineChunkSenderData};
+
+    /// @brief chunks which are sent by a ChunkSender carry a publish timestamp
+    void sendChunkToReceiver(const iox::popo::UniquePortId& originId = iox::popo::UniquePortId())
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(originId,
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                          iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        iox::cxx::Ensures(!maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
 };
 
 TEST_F(ChunkReceiver_test, getNoChunkFromEmptyQueue)
@@ -281,4 +323,293 @@ TEST_F(ChunkReceiver_test, LogStreamConvertsChunkReceiveResultValueToString)
     EXPECT_THAT(loggerMock.logs[0].message, StrEq(iox::popo::asStringLiteral(sut)));
 }
 
+TEST_F(ChunkReceiver_test, ChunksExceedingTheMaximumSampleAgeAreDiscardedAndCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1fb76f5-5b59-441e-b7de-7ff5c0c7b52e");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    m_chunkReceiverData.m_maximumSampleAgeNs = 1U;
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sendChunkToReceiver();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_EQ(maybeChunkHeader.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(m_chunkReceiver.numberOfExpiredChunks(), Eq(NUMBER_OF_CHUNKS));
+    // only the last chunk is still in use since the sender keeps it for reuse
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, ChunkWithinTheMaximumSampleAgeIsProvided)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "73a92ca3-5dcc-4315-8736-d1ac8d1fc4ff");
+    m_chunkReceiverData.m_maximumSampleAgeNs = iox::units::Duration::fromHours(1U).toNanoseconds();
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    sendChunkToReceiver();
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkReceiver.numberOfExpiredChunks(), Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, ChunkWithoutPublishTimestampNeverExpires)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0eb93586-7685-4fb5-8bfe-fba56cb91cfd");
+    m_chunkReceiverData.m_maximumSampleAgeNs = 1U;
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkReceiver.numberOfExpiredChunks(), Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, LatencyOfProvidedChunksIsRecordedInTheHistogramOfTheirPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87e13330-a606-48e5-9e3e-59f0567c29ff");
+    constexpr uint32_t NUMBER_OF_CHUNKS{2U};
+    iox::popo::UniquePortId originId;
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sendChunkToReceiver(originId);
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+
+    const auto& latencyHistograms = m_chunkReceiverData.m_latencyHistograms;
+    ASSERT_THAT(latencyHistograms.size(), Eq(1U));
+    EXPECT_THAT(latencyHistograms.getOriginId(0U), Eq(originId));
+    uint64_t numberOfRecordedChunks{0U};
+    for (uint32_t bucket = 0U; bucket < iox::popo::LatencyHistograms::NUMBER_OF_BUCKETS; ++bucket)
+    {
+        numberOfRecordedChunks += latencyHistograms.getBucketCount(0U, bucket);
+    }
+    EXPECT_THAT(numberOfRecordedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(ChunkReceiver_test, LatencyOfChunkWithoutPublishTimestampIsNotRecorded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26af7677-56b2-4a9b-901c-48909cb186bf");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkReceiverData.m_latencyHistograms.size(), Eq(0U));
+    m_chunkReceiver.release(*maybeChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, DeadlineIsNeverMissedWithoutDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9f0051a-2c52-4295-b2d2-df7a61dfbe10");
+    EXPECT_FALSE(m_chunkReceiver.hasMissedDeadline());
+}
+
+TEST_F(ChunkReceiver_test, DeadlineIsMissedWhenNoChunkArrivesWithinTheDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3f92257-1e27-4412-8f56-2043d9694277");
+    constexpr std::chrono::milliseconds DEADLINE{100};
+    m_chunkReceiverData.m_deadlineNs = static_cast<uint64_t>(std::chrono::nanoseconds(DEADLINE).count());
+    m_chunkReceiverData.m_lastArrivalTimestampNs.store(iox::mepoo::monotonicTimestamp());
+
+    EXPECT_FALSE(m_chunkReceiver.hasMissedDeadline());
+    std::this_thread::sleep_for(DEADLINE * 2);
+    EXPECT_TRUE(m_chunkReceiver.hasMissedDeadline());
+}
+
+TEST_F(ChunkReceiver_test, DeadlineIsNotMissedAfterAChunkArrived)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c17077e-7864-439d-88bf-a69adebd9628");
+    constexpr std::chrono::milliseconds DEADLINE{100};
+    m_chunkReceiverData.m_deadlineNs = static_cast<uint64_t>(std::chrono::nanoseconds(DEADLINE).count());
+    m_chunkReceiverData.m_lastArrivalTimestampNs.store(iox::mepoo::monotonicTimestamp());
+    std::this_thread::sleep_for(DEADLINE * 2);
+    ASSERT_TRUE(m_chunkReceiver.hasMissedDeadline());
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    EXPECT_FALSE(m_chunkReceiver.hasMissedDeadline());
+}
+
+TEST_F(ChunkReceiver_test, releaseToSharedChunkHandsOverTheOwnershipOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d62c4207-a921-4445-b593-ab729ce9680a");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeChunk = m_chunkReceiver.releaseToSharedChunk(*maybeChunkHeader);
+
+    ASSERT_FALSE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk->getChunkHeader(), Eq(*maybeChunkHeader));
+    EXPECT_TRUE(maybeChunk->hasNoOtherOwners());
+    m_chunkReceiver.releaseAll();
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    maybeChunk.value() = nullptr;
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, releaseToSharedChunkOfInvalidChunkCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d20c8f72-5a74-4e9a-8d31-201172d2503d");
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    ChunkMock<bool> myCrazyChunk;
+    auto maybeChunk = m_chunkReceiver.releaseToSharedChunk(myCrazyChunk.chunkHeader());
+
+    ASSERT_TRUE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk.get_error(), Eq(iox::popo::ChunkReleaseResult::INVALID_CHUNK));
+    EXPECT_TRUE(errorHandlerCalled);
+}
+
+TEST_F(ChunkReceiver_test, InlineChunksAndChunksInTheQueueAreProvidedInTheOrderOfArrival)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd98a472-442c-432d-9e93-14a4056d596d");
+    ChunkMock<DummySample> inlineChunk;
+    inlineChunk.sample()->dummy = 42U;
+    auto firstChunk = getChunkFromMemoryManager();
+    auto lastChunk = getChunkFromMemoryManager();
+    m_chunkQueuePusher.push(firstChunk);
+    m_chunkQueuePusher.pushInline(*inlineChunk.chunkHeader());
+    m_chunkQueuePusher.push(lastChunk);
+
+    auto maybeFirstChunkHeader = m_chunkReceiver.tryGet();
+    auto maybeInlineChunkHeader = m_chunkReceiver.tryGet();
+    auto maybeLastChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_FALSE(maybeFirstChunkHeader.has_error());
+    EXPECT_THAT(*maybeFirstChunkHeader, Eq(firstChunk.getChunkHeader()));
+    ASSERT_FALSE(maybeInlineChunkHeader.has_error());
+    EXPECT_THAT(*maybeInlineChunkHeader, Ne(inlineChunk.chunkHeader()));
+    EXPECT_THAT(static_cast<const DummySample*>((*maybeInlineChunkHeader)->userPayload())->dummy, Eq(42U));
+    ASSERT_FALSE(maybeLastChunkHeader.has_error());
+    EXPECT_THAT(*maybeLastChunkHeader, Eq(lastChunk.getChunkHeader()));
+    m_chunkReceiver.release(*maybeFirstChunkHeader);
+    m_chunkReceiver.release(*maybeInlineChunkHeader);
+    m_chunkReceiver.release(*maybeLastChunkHeader);
+    EXPECT_TRUE(m_chunkReceiver.empty());
+}
+
+TEST_F(ChunkReceiver_test, ChunksOfAnInlineSenderAreReceivedAsChunksWithoutInlineSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a70dcec-7846-439c-884e-8373cf663de3");
+    ASSERT_THAT(m_chunkReceiver.detachInlineSlots(), Eq(&m_inlineSlots));
+    ASSERT_FALSE(m_inlineChunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(iox::popo::UniquePortId(),
+                                                            sizeof(DummySample),
+                                                            alignof(DummySample),
+                                                            iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                            iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSender.send(*maybeChunkHeader);
+
+    auto maybeReceivedChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_FALSE(maybeReceivedChunkHeader.has_error());
+    EXPECT_THAT(*maybeReceivedChunkHeader, Eq(*maybeChunkHeader));
+    m_chunkReceiver.release(*maybeReceivedChunkHeader);
+}
+
+TEST_F(ChunkReceiver_test, ChunksOfAnInlineSenderAreReceivedWithoutFurtherChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09e89f07-c9ae-4842-97ac-31f751cccbb2");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::popo::UniquePortId originId;
+    ASSERT_FALSE(m_inlineChunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(originId,
+                                                                sizeof(DummySample),
+                                                                alignof(DummySample),
+                                                                iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                                iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample{i};
+        m_inlineChunkSender.send(*maybeChunkHeader);
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        EXPECT_THAT(static_cast<const DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(i));
+        EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(originId));
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+    // only the last chunk of the sender is in use, it is reused for every sample
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_chunkReceiverData.m_latencyHistograms.size(), Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, ExpiredInlineChunksAreDiscardedAndCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29ee5b69-1a78-4a6b-9438-179865c23113");
+    m_chunkReceiverData.m_maximumSampleAgeNs = 1U;
+    ASSERT_FALSE(m_inlineChunkSender.tryAddQueue(&m_chunkReceiverData).has_error());
+    auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(iox::popo::UniquePortId(),
+                                                            sizeof(DummySample),
+                                                            alignof(DummySample),
+                                                            iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                            iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_inlineChunkSender.send(*maybeChunkHeader);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto maybeReceivedChunkHeader = m_chunkReceiver.tryGet();
+
+    ASSERT_TRUE(maybeReceivedChunkHeader.has_error());
+    EXPECT_EQ(maybeReceivedChunkHeader.get_error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(m_chunkReceiver.numberOfExpiredChunks(), Eq(1U));
+}
+
+TEST_F(ChunkReceiver_test, ReleaseAllReleasesTheTakenInlineChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0c6cccc-71a2-4965-bdc3-faeaaba41cc3");
+    ChunkMock<DummySample> inlineChunk;
+    for (uint64_t i = 0U; i < iox::popo::InlineSlots::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_chunkQueuePusher.pushInline(*inlineChunk.chunkHeader()));
+    }
+    ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+
+    m_chunkReceiver.releaseAll();
+
+    EXPECT_TRUE(m_chunkReceiver.empty());
+    for (uint64_t i = 0U; i < iox::popo::InlineSlots::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(m_chunkQueuePusher.pushInline(*inlineChunk.chunkHeader()));
+    }
+}
+
+TEST_F(ChunkReceiver_test, releaseToSharedChunkOfInlineChunkFailsAndKeepsTheSlotHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff55b315-7792-4547-9617-cc2faab69d80");
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+    ChunkMock<DummySample> inlineChunk;
+    m_chunkQueuePusher.pushInline(*inlineChunk.chunkHeader());
+    auto maybeChunkHeader = m_chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeChunk = m_chunkReceiver.releaseToSharedChunk(*maybeChunkHeader);
+
+    ASSERT_TRUE(maybeChunk.has_error());
+    EXPECT_THAT(maybeChunk.get_error(), Eq(iox::popo::ChunkReleaseResult::CHUNK_DELIVERED_INLINE));
+    EXPECT_FALSE(errorHandlerCalled);
+    EXPECT_TRUE(m_chunkReceiver.releaseInline(*maybeChunkHeader));
+}
+
 } // namespace
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/monotonic_timestamp.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
@@ -28,6 +29,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/inline_slots.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -54,6 +56,7 @@ class ChunkSender_test : public Test
     {
         m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
         m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL, MEMPOOL_RESERVATION});
         m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
     }
 
@@ -76,6 +79,7 @@ class ChunkSender_test : public Test
     static constexpr uint32_t BIG_CHUNK = 256;
     static constexpr uint64_t HISTORY_CAPACITY = 4;
     static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+    static constexpr iox::mepoo::MemPoolReservation_t MEMPOOL_RESERVATION = 1;
 
     static constexpr uint32_t USER_PAYLOAD_ALIGNMENT = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT;
     static constexpr uint32_t USER_HEADER_SIZE = iox::CHUNK_NO_USER_HEADER_SIZE;
@@ -113,6 +117,23 @@ class ChunkSender_test : public Test
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    ChunkSenderData_t m_inlineChunkSenderData{&m_memoryManager,
+                                              iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                              0U,
+                                              iox::mepoo::MemoryInfo(),
+                                              iox::mepoo::NO_MEMPOOL_RESERVATION,
+                                              false,
+                                              true};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_inlineChunkSender{&m_inlineChunkSenderData};
+
+    iox::mepoo::SharedChunk getChunkFromMemoryManager(const uint32_t userHeaderSize = USER_HEADER_SIZE,
+                                                      const uint32_t userHeaderAlignment = USER_HEADER_ALIGNMENT)
+    {
+        auto chunkSettings = iox::mepoo::ChunkSettings::create(
+                                 sizeof(DummySample), alignof(DummySample), userHeaderSize, userHeaderAlignment)
+                                 .value();
+        return m_memoryManager.getChunk(chunkSettings).value();
+    }
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -147,6 +168,26 @@ TEST_F(ChunkSender_test, allocate_OneChunkWithLargeUserHeaderResultsInLargeChunk
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkSender_test, allocate_WithMempoolReservationUsesOnlyTheReservedMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8f14a2b-6c39-4e07-b5a1-3e9c7f0d2b64");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      MEMPOOL_RESERVATION};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{SMALL_CHUNK / 2};
+    auto maybeChunkHeader = sut.tryAllocate(
+        UniquePortId(), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    sut.release(maybeChunkHeader.value());
+}
+
 TEST_F(ChunkSender_test, allocate_ChunkHasOriginIdSet)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7e33b20b-93f9-4b53-926b-20295ac73b61");
@@ -738,7 +779,8 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
                             AllocationError::RUNNING_OUT_OF_CHUNKS,
                             AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
                             AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
-                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER})
+                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER,
+                            AllocationError::CHUNK_DELIVERED_INLINE})
     {
         auto enumString = iox::popo::asStringLiteral(sut);
 
@@ -762,6 +804,9 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
         case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
             EXPECT_THAT(enumString, StrEq("AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER"));
             break;
+        case AllocationError::CHUNK_DELIVERED_INLINE:
+            EXPECT_THAT(enumString, StrEq("AllocationError::CHUNK_DELIVERED_INLINE"));
+            break;
         }
 
         testedEnumValues |= 1U << static_cast<uint64_t>(sut);
@@ -787,4 +832,354 @@ TEST_F(ChunkSender_test, LogStreamConvertsAllocationErrorValueToString)
     EXPECT_THAT(loggerMock.logs[0].message, StrEq(iox::popo::asStringLiteral(sut)));
 }
 
+TEST_F(ChunkSender_test, sendSetsThePublishTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "887224ad-5be5-46a0-88d6-45a8a94c6463");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->publishTimestamp(), Eq(0U));
+
+    const auto timestampBeforeSend = iox::mepoo::monotonicTimestamp();
+    m_chunkSender.send(*maybeChunkHeader);
+    const auto timestampAfterSend = iox::mepoo::monotonicTimestamp();
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Ge(timestampBeforeSend));
+    EXPECT_THAT(popRet->getChunkHeader()->publishTimestamp(), Le(timestampAfterSend));
+}
+
+TEST_F(ChunkSender_test, adoptOfExclusiveChunkFromSameMemoryManagerDoesNotCopy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5121e621-ab7e-4137-afc9-2db4bdb77f82");
+    auto chunk = getChunkFromMemoryManager();
+    auto* originalChunkHeader = chunk.getChunkHeader();
+    UniquePortId originId;
+
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(originId, std::move(chunk));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(*maybeChunkHeader, Eq(originalChunkHeader));
+    EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(originId));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, adoptOfChunkWithOtherOwnersCopiesUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0ed8a32-5d85-4498-8979-0c925f7a6835");
+    auto chunk = getChunkFromMemoryManager();
+    new (chunk.getUserPayload()) DummySample{73U};
+    auto otherOwner = chunk;
+
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), std::move(chunk));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(*maybeChunkHeader, Ne(otherOwner.getChunkHeader()));
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(static_cast<DummySample*>((*maybeChunkHeader)->userPayload())->dummy, Eq(73U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+}
+
+TEST_F(ChunkSender_test, adoptOfChunkWithOtherOwnersCopiesUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7810d59-c893-4e44-adf9-2a28df5cefc5");
+    constexpr uint32_t CUSTOM_USER_HEADER_SIZE{sizeof(uint64_t)};
+    constexpr uint32_t CUSTOM_USER_HEADER_ALIGNMENT{alignof(uint64_t)};
+    auto chunk = getChunkFromMemoryManager(CUSTOM_USER_HEADER_SIZE, CUSTOM_USER_HEADER_ALIGNMENT);
+    *static_cast<uint64_t*>(chunk.getChunkHeader()->userHeader()) = 1337U;
+    auto otherOwner = chunk;
+
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), std::move(chunk));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(*maybeChunkHeader, Ne(otherOwner.getChunkHeader()));
+    EXPECT_THAT((*maybeChunkHeader)->userHeaderSize(), Eq(CUSTOM_USER_HEADER_SIZE));
+    EXPECT_THAT(*static_cast<uint64_t*>((*maybeChunkHeader)->userHeader()), Eq(1337U));
+}
+
+TEST_F(ChunkSender_test, adoptedChunkCanBeSent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cc19e9f-f8a4-40b3-8f51-06522244ff94");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), getChunkFromMemoryManager());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_chunkSender.send(*maybeChunkHeader), Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader(), Eq(*maybeChunkHeader));
+}
+
+TEST_F(ChunkSender_test, adoptOfEmptyChunkFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb14df58-64ce-4d44-a5d0-3b6bdf5493ad");
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), iox::mepoo::SharedChunk());
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+}
+
+TEST_F(ChunkSender_test, adoptInPipelineCopiesWhileTheUpstreamChunkSenderHoldsTheChunkAsLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e471c48-4f62-492e-b3c2-240b6880542f");
+    ChunkSenderData_t upstreamData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> upstream{&upstreamData};
+    ASSERT_FALSE(upstream.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = upstream.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto* sentChunkHeader = *maybeChunkHeader;
+    upstream.send(sentChunkHeader);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    auto adoptedChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), std::move(*popRet));
+
+    ASSERT_FALSE(adoptedChunkHeader.has_error());
+    EXPECT_THAT(*adoptedChunkHeader, Ne(sentChunkHeader));
+    m_chunkSender.release(*adoptedChunkHeader);
+}
+
+TEST_F(ChunkSender_test, adoptInPipelineDoesNotCopyOnceTheUpstreamChunkSenderSentItsNextChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a43205fe-4685-4804-afe5-d58d687511e9");
+    ChunkSenderData_t upstreamData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> upstream{&upstreamData};
+    ASSERT_FALSE(upstream.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::mepoo::ChunkHeader* firstChunkHeader{nullptr};
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        auto maybeChunkHeader = upstream.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        if (firstChunkHeader == nullptr)
+        {
+            firstChunkHeader = *maybeChunkHeader;
+        }
+        upstream.send(*maybeChunkHeader);
+    }
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    auto adoptedChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), std::move(*popRet));
+
+    ASSERT_FALSE(adoptedChunkHeader.has_error());
+    EXPECT_THAT(*adoptedChunkHeader, Eq(firstChunkHeader));
+    m_chunkSender.release(*adoptedChunkHeader);
+}
+
+TEST_F(ChunkSender_test, allocateSegmentAppendsTheSegmentToTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66cf8142-6445-474d-9829-22c12873e646");
+    UniquePortId originId;
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        originId, sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeFirstSegment = m_chunkSender.tryAllocateSegment(*maybeChunkHeader, BIG_CHUNK, alignof(uint64_t));
+    ASSERT_FALSE(maybeFirstSegment.has_error());
+    auto maybeSecondSegment = m_chunkSender.tryAllocateSegment(*maybeChunkHeader, sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(maybeSecondSegment.has_error());
+
+    EXPECT_THAT((*maybeChunkHeader)->nextSegment(), Eq(*maybeFirstSegment));
+    EXPECT_THAT((*maybeFirstSegment)->nextSegment(), Eq(*maybeSecondSegment));
+    EXPECT_THAT((*maybeSecondSegment)->nextSegment(), Eq(nullptr));
+    EXPECT_THAT((*maybeFirstSegment)->userPayloadSize(), Eq(BIG_CHUNK));
+    EXPECT_THAT((*maybeFirstSegment)->originId(), Eq(originId));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, releaseOfChunkWithSegmentsFreesAllSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3008dbb-b851-46ca-a1c4-6745a64ac585");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ASSERT_FALSE(m_chunkSender.tryAllocateSegment(*maybeChunkHeader, sizeof(uint64_t), alignof(uint64_t)).has_error());
+    ASSERT_FALSE(m_chunkSender.tryAllocateSegment(*maybeChunkHeader, sizeof(uint64_t), alignof(uint64_t)).has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(3U));
+
+    m_chunkSender.release(*maybeChunkHeader);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, chunkWithSegmentsIsDeliveredAsOneMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb21f682-d9c5-4fae-a7f8-5066862b37a9");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto maybeSegment = m_chunkSender.tryAllocateSegment(*maybeChunkHeader, sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(maybeSegment.has_error());
+
+    EXPECT_THAT(m_chunkSender.send(*maybeChunkHeader), Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->nextSegment(), Eq(*maybeSegment));
+    EXPECT_FALSE(myQueue.tryPop().has_value());
+}
+
+TEST_F(ChunkSender_test, allocateSegmentForInvalidChunkTriggersTheErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c133554e-f6da-4176-b810-aafafb3bc960");
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            errorHandlerCalled = true;
+            EXPECT_THAT(error, Eq(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_APPEND_SEGMENT_FROM_USER));
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        });
+
+    ChunkMock<bool> myCrazyChunk;
+    auto maybeSegment = m_chunkSender.tryAllocateSegment(myCrazyChunk.chunkHeader(), sizeof(uint64_t), 1U);
+
+    EXPECT_TRUE(errorHandlerCalled);
+    ASSERT_TRUE(maybeSegment.has_error());
+    EXPECT_THAT(maybeSegment.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, adoptOfChunkWithOtherOwnersCopiesSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c69618c5-5ae1-4528-8b72-4287b180a472");
+    auto chunk = getChunkFromMemoryManager();
+    auto segment = getChunkFromMemoryManager();
+    new (segment.getUserPayload()) DummySample{37U};
+    chunk.appendSegment(std::move(segment));
+    auto otherOwner = chunk;
+
+    auto maybeChunkHeader = m_chunkSender.tryAdopt(UniquePortId(), std::move(chunk));
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto copiedSegment = (*maybeChunkHeader)->nextSegment();
+    ASSERT_THAT(copiedSegment, Ne(nullptr));
+    EXPECT_THAT(copiedSegment, Ne(otherOwner.getChunkHeader()->nextSegment()));
+    EXPECT_THAT(static_cast<DummySample*>(copiedSegment->userPayload())->dummy, Eq(37U));
+    EXPECT_THAT(copiedSegment->nextSegment(), Eq(nullptr));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(4U));
+}
+
+TEST_F(ChunkSender_test, resendPreviousChunkWithoutPreviousChunkDeliversNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "398fef7d-4822-4418-9dde-546330905c7f");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    EXPECT_THAT(m_chunkSender.resendPreviousChunk(), Eq(0U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_FALSE(myQueue.tryPop().has_value());
+}
+
+TEST_F(ChunkSender_test, resendPreviousChunkDeliversTheLastSentChunkAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7235af3b-89a0-4740-a653-1e59011dedc6");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkSender.send(*maybeChunkHeader), Eq(1U));
+    const auto sequenceNumber = (*maybeChunkHeader)->sequenceNumber();
+
+    EXPECT_THAT(m_chunkSender.resendPreviousChunk(), Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(popRet->getChunkHeader(), Eq(*maybeChunkHeader));
+    }
+    EXPECT_THAT((*maybeChunkHeader)->sequenceNumber(), Eq(sequenceNumber));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, inlineDeliveryCopiesTheChunksIntoTheQueueAndReusesTheLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93d76bc8-d9a8-4a7b-ac63-d4af73149d60");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::popo::InlineSlots inlineSlots;
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    myQueue.attachInlineSlots(&inlineSlots);
+    ASSERT_FALSE(m_inlineChunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample{i};
+        EXPECT_THAT(m_inlineChunkSender.send(*maybeChunkHeader), Eq(1U));
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_FALSE(myQueue.tryPop().has_value());
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        const auto* chunkHeader = myQueue.tryPopInline();
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeader->userPayload())->dummy, Eq(i));
+        EXPECT_TRUE(myQueue.releaseInline(chunkHeader));
+    }
+}
+
+TEST_F(ChunkSender_test, inlineDeliveryAllocationOfChunkWhichDoesNotFitIntoAnInlineSlotFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fcc96b2c-cbe2-4d3f-930f-8945e02361ae");
+    auto maybeLargeChunkHeader = m_inlineChunkSender.tryAllocate(UniquePortId(),
+                                                                 iox::MAX_INLINE_USER_PAYLOAD_SIZE + 1U,
+                                                                 USER_PAYLOAD_ALIGNMENT,
+                                                                 USER_HEADER_SIZE,
+                                                                 USER_HEADER_ALIGNMENT);
+    auto maybeChunkHeaderWithUserHeader = m_inlineChunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), sizeof(uint64_t), alignof(uint64_t));
+
+    ASSERT_TRUE(maybeLargeChunkHeader.has_error());
+    EXPECT_THAT(maybeLargeChunkHeader.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    ASSERT_TRUE(maybeChunkHeaderWithUserHeader.has_error());
+    EXPECT_THAT(maybeChunkHeaderWithUserHeader.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, inlineDeliveryAllocateSegmentFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4665fbcb-9e85-498f-b3dc-e55e9332965b");
+    auto maybeChunkHeader = m_inlineChunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto maybeSegment = m_inlineChunkSender.tryAllocateSegment(*maybeChunkHeader, sizeof(uint64_t), 1U);
+
+    ASSERT_TRUE(maybeSegment.has_error());
+    EXPECT_THAT(maybeSegment.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, inlineDeliveryAdoptOfChunkWhichDoesNotFitIntoAnInlineSlotFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e1a8d37-8f66-4f8f-880c-cb5bccc09046");
+    auto maybeChunkHeader =
+        m_inlineChunkSender.tryAdopt(UniquePortId(), getChunkFromMemoryManager(sizeof(uint64_t), alignof(uint64_t)));
+
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 } // namespace
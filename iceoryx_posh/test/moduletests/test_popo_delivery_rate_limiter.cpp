@@ -0,0 +1,134 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_rate_limiter.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DeliveryRateLimiter_test : public Test
+{
+  public:
+    uint64_t admittedSamples(const uint64_t numberOfSamples)
+    {
+        uint64_t numberOfAdmittedSamples{0U};
+        for (uint64_t i = 0U; i < numberOfSamples; ++i)
+        {
+            if (sut.admitSample())
+            {
+                ++numberOfAdmittedSamples;
+            }
+        }
+        return numberOfAdmittedSamples;
+    }
+
+    DeliveryRateLimiter sut;
+};
+
+TEST_F(DeliveryRateLimiter_test, DefaultLimiterIsInactiveAndAdmitsEverySample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ad04ebd-60a7-4798-9dfd-dcb22bd8aacb");
+    EXPECT_FALSE(sut.isActive());
+    EXPECT_THAT(admittedSamples(10U), Eq(10U));
+}
+
+TEST_F(DeliveryRateLimiter_test, DecimationOfZeroOrOneAdmitsEverySample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "240a55a9-e495-4eeb-be86-8c4e579e376c");
+    for (const uint64_t decimation : {0U, 1U})
+    {
+        sut.configure(decimation, 0_ns);
+        EXPECT_FALSE(sut.isActive());
+        EXPECT_THAT(admittedSamples(10U), Eq(10U));
+    }
+}
+
+TEST_F(DeliveryRateLimiter_test, DecimationAdmitsTheFirstAndEveryNthSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29236f5b-ef3b-45a4-92dc-dedea72f0e80");
+    constexpr uint64_t DECIMATION{3U};
+    sut.configure(DECIMATION, 0_ns);
+
+    EXPECT_TRUE(sut.isActive());
+    for (uint64_t i = 0U; i < 3U * DECIMATION; ++i)
+    {
+        EXPECT_THAT(sut.admitSample(), Eq(i % DECIMATION == 0U));
+    }
+}
+
+TEST_F(DeliveryRateLimiter_test, MinimumIntervalAdmitsSamplesOnlyAfterTheIntervalElapsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36eefa87-dfcf-40a8-a290-36a963f7b781");
+    sut.configure(1U, 100_ns);
+
+    EXPECT_TRUE(sut.isActive());
+    EXPECT_TRUE(sut.admitSample(1000U));
+    EXPECT_FALSE(sut.admitSample(1050U));
+    EXPECT_FALSE(sut.admitSample(1099U));
+    EXPECT_TRUE(sut.admitSample(1100U));
+    EXPECT_FALSE(sut.admitSample(1150U));
+    EXPECT_TRUE(sut.admitSample(1300U));
+}
+
+TEST_F(DeliveryRateLimiter_test, SampleWithTimestampBeforeTheLastDeliveryIsNotAdmitted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69cda40f-ddf9-4e21-890c-ea7ababd55af");
+    sut.configure(1U, 100_ns);
+
+    EXPECT_TRUE(sut.admitSample(1000U));
+    EXPECT_FALSE(sut.admitSample(900U));
+}
+
+TEST_F(DeliveryRateLimiter_test, DecimationAndMinimumIntervalMustBothBeSatisfied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "747dc007-6c6f-43f1-b771-a193bfc644f1");
+    sut.configure(2U, 100_ns);
+
+    EXPECT_TRUE(sut.admitSample(1000U));
+    // rejected by the decimation
+    EXPECT_FALSE(sut.admitSample(1010U));
+    // rejected by the minimum interval
+    EXPECT_FALSE(sut.admitSample(1020U));
+    // rejected by the decimation
+    EXPECT_FALSE(sut.admitSample(1200U));
+    EXPECT_TRUE(sut.admitSample(1210U));
+}
+
+TEST_F(DeliveryRateLimiter_test, MinimumIntervalWithCurrentTimeAdmitsOnlyTheFirstSampleWithinTheInterval)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e5cbd0c-3233-4c13-b03b-88b28b985a9f");
+    sut.configure(1U, 1_h);
+
+    EXPECT_THAT(admittedSamples(10U), Eq(1U));
+}
+
+TEST_F(DeliveryRateLimiter_test, ConfigureResetsTheState)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab8ad465-01dd-4a7e-8db3-68d07a77677d");
+    sut.configure(2U, 100_ns);
+    EXPECT_TRUE(sut.admitSample(1000U));
+
+    sut.configure(2U, 100_ns);
+
+    EXPECT_TRUE(sut.admitSample(1010U));
+}
+
+} // namespace
@@ -0,0 +1,248 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/inline_slots.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using iox::mepoo::ChunkHeader;
+
+class InlineSlots_test : public Test
+{
+  public:
+    bool push(const uint64_t value, const bool discardOldest = false)
+    {
+        *chunk.sample() = value;
+        return sut.push(*chunk.chunkHeader(), discardOldest);
+    }
+
+    void pushAll()
+    {
+        for (uint64_t i = 0U; i < InlineSlots::CAPACITY; ++i)
+        {
+            ASSERT_TRUE(push(i));
+        }
+    }
+
+    static uint64_t valueOf(const ChunkHeader* const chunkHeader)
+    {
+        return *static_cast<const uint64_t*>(chunkHeader->userPayload());
+    }
+
+    ChunkMock<uint64_t> chunk;
+    InlineSlots sut;
+};
+
+TEST_F(InlineSlots_test, SmallChunkWithoutUserHeaderFits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "801d1366-7b62-4cd0-8861-4d0934f75459");
+    EXPECT_TRUE(InlineSlots::fits(InlineSlots::MAX_USER_PAYLOAD_SIZE, 1U, 0U));
+    EXPECT_TRUE(InlineSlots::fits(*chunk.chunkHeader()));
+}
+
+TEST_F(InlineSlots_test, ChunkWithTooLargeUserPayloadDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4788541e-0398-4469-86a7-ce4554de9025");
+    ChunkMock<uint8_t[InlineSlots::MAX_USER_PAYLOAD_SIZE + 1U]> largeChunk;
+
+    EXPECT_FALSE(InlineSlots::fits(InlineSlots::MAX_USER_PAYLOAD_SIZE + 1U, 1U, 0U));
+    EXPECT_FALSE(InlineSlots::fits(*largeChunk.chunkHeader()));
+}
+
+TEST_F(InlineSlots_test, ChunkWithUserHeaderDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9fb112d1-ec5c-4a67-812e-77062cb13d66");
+    ChunkMock<uint64_t, uint64_t> chunkWithUserHeader;
+
+    EXPECT_FALSE(InlineSlots::fits(sizeof(uint64_t), alignof(uint64_t), sizeof(uint64_t)));
+    EXPECT_FALSE(InlineSlots::fits(*chunkWithUserHeader.chunkHeader()));
+}
+
+TEST_F(InlineSlots_test, ChunkWithLargerUserPayloadAlignmentThanTheChunkHeaderDoesNotFit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e927a598-d295-4dae-8e0b-ef58512ab8e5");
+    EXPECT_FALSE(InlineSlots::fits(sizeof(uint64_t), 2U * alignof(ChunkHeader), 0U));
+}
+
+TEST_F(InlineSlots_test, InitiallyNoSlotIsReady)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a6138e7-578e-468b-b491-d620721ec0db");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.tryTake(), Eq(nullptr));
+}
+
+TEST_F(InlineSlots_test, PushedChunkIsCopiedIntoTheSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93bf1eae-cf39-4ed6-88b9-f6e5dc229041");
+    constexpr uint64_t VALUE{42U};
+    ASSERT_TRUE(push(VALUE));
+    EXPECT_FALSE(sut.empty());
+
+    const auto* chunkHeader = sut.tryTake();
+    *chunk.sample() = VALUE + 1U;
+
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(chunkHeader, Ne(chunk.chunkHeader()));
+    EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(sizeof(uint64_t)));
+    EXPECT_THAT(valueOf(chunkHeader), Eq(VALUE));
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_F(InlineSlots_test, SlotsAreTakenInTheOrderOfThePushes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "633c60eb-9096-4bac-9bfa-4dce793f391b");
+    pushAll();
+
+    for (uint64_t i = 0U; i < InlineSlots::CAPACITY; ++i)
+    {
+        const auto* chunkHeader = sut.tryTake();
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(valueOf(chunkHeader), Eq(i));
+    }
+    EXPECT_THAT(sut.tryTake(), Eq(nullptr));
+}
+
+TEST_F(InlineSlots_test, PushWithoutFreeSlotFailsAndKeepsTheReadySlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d59616d8-ad90-48cb-b8d5-9c8b5ae51cf8");
+    pushAll();
+
+    EXPECT_FALSE(push(InlineSlots::CAPACITY));
+
+    EXPECT_THAT(valueOf(sut.tryTake()), Eq(0U));
+}
+
+TEST_F(InlineSlots_test, PushWithDiscardOldestOverwritesTheOldestReadySlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27241cf6-1940-46f1-8b0a-3b1fd20fc6cf");
+    pushAll();
+
+    EXPECT_FALSE(push(InlineSlots::CAPACITY, true));
+
+    for (uint64_t i = 1U; i <= InlineSlots::CAPACITY; ++i)
+    {
+        const auto* chunkHeader = sut.tryTake();
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(valueOf(chunkHeader), Eq(i));
+    }
+}
+
+TEST_F(InlineSlots_test, PushWithDiscardOldestFailsWhenAllSlotsAreHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "acecbfcf-9654-486c-bcc5-e734935d4ae1");
+    pushAll();
+    for (uint64_t i = 0U; i < InlineSlots::CAPACITY; ++i)
+    {
+        ASSERT_THAT(sut.tryTake(), Ne(nullptr));
+    }
+
+    EXPECT_FALSE(push(InlineSlots::CAPACITY, true));
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_F(InlineSlots_test, ReleasedSlotCanBeReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f3235e3-b624-46b3-b459-fc270300a2e6");
+    pushAll();
+    const auto* chunkHeader = sut.tryTake();
+
+    EXPECT_TRUE(sut.release(chunkHeader));
+
+    EXPECT_TRUE(push(InlineSlots::CAPACITY));
+}
+
+TEST_F(InlineSlots_test, ReleaseOfChunkHeaderWhichIsNotAHeldSlotFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee53991b-cb31-4b5d-a307-865947c00a68");
+    ASSERT_TRUE(push(0U));
+    const auto* chunkHeader = sut.tryTake();
+    ASSERT_TRUE(sut.release(chunkHeader));
+
+    EXPECT_FALSE(sut.release(chunkHeader));
+    EXPECT_FALSE(sut.release(chunk.chunkHeader()));
+    EXPECT_FALSE(sut.release(nullptr));
+}
+
+TEST_F(InlineSlots_test, ReleaseAllFreesTheHeldAndTheReadySlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a125b1d2-180c-49dd-a541-8786d75ae570");
+    pushAll();
+    ASSERT_THAT(sut.tryTake(), Ne(nullptr));
+    ASSERT_THAT(sut.tryTake(), Ne(nullptr));
+
+    sut.releaseAll();
+
+    EXPECT_TRUE(sut.empty());
+    pushAll();
+}
+
+TEST_F(InlineSlots_test, NumberOfEnqueuedChunksBeforeOldestIsNulloptWithoutReadySlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aaa859f5-82d1-4e2a-b30f-f590b7a3bb86");
+    EXPECT_FALSE(sut.numberOfEnqueuedChunksBeforeOldest().has_value());
+}
+
+TEST_F(InlineSlots_test, NumberOfEnqueuedChunksBeforeOldestIsTheOneOfTheOldestReadySlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bfcd454-75e3-4ead-b888-8fe006a68113");
+    ASSERT_TRUE(sut.push(*chunk.chunkHeader(), false, 3U));
+    ASSERT_TRUE(sut.push(*chunk.chunkHeader(), false, 5U));
+
+    auto numberOfEnqueuedChunks = sut.numberOfEnqueuedChunksBeforeOldest();
+    ASSERT_TRUE(numberOfEnqueuedChunks.has_value());
+    EXPECT_THAT(numberOfEnqueuedChunks.value(), Eq(3U));
+    EXPECT_FALSE(sut.empty());
+    ASSERT_THAT(sut.tryTake(), Ne(nullptr));
+
+    numberOfEnqueuedChunks = sut.numberOfEnqueuedChunksBeforeOldest();
+    ASSERT_TRUE(numberOfEnqueuedChunks.has_value());
+    EXPECT_THAT(numberOfEnqueuedChunks.value(), Eq(5U));
+}
+
+TEST_F(InlineSlots_test, OldestReadySlotIsNotOverwrittenAfterItsNumberOfEnqueuedChunksWasProvided)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0cdd3733-02c8-43ee-9f28-ada1d5422402");
+    pushAll();
+    ASSERT_TRUE(sut.numberOfEnqueuedChunksBeforeOldest().has_value());
+
+    EXPECT_FALSE(push(InlineSlots::CAPACITY, true));
+
+    const auto* chunkHeader = sut.tryTake();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(valueOf(chunkHeader), Eq(0U));
+    sut.releaseAll();
+    EXPECT_TRUE(sut.empty());
+    pushAll();
+}
+
+TEST_F(InlineSlots_test, OnlyTakenSlotIsHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf97d141-03f4-4e53-88b4-32f6cb8e7cd9");
+    ASSERT_TRUE(push(0U));
+    const auto* chunkHeader = sut.tryTake();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+
+    EXPECT_TRUE(sut.isHeld(chunkHeader));
+    EXPECT_FALSE(sut.isHeld(chunk.chunkHeader()));
+    ASSERT_TRUE(sut.release(chunkHeader));
+    EXPECT_FALSE(sut.isHeld(chunkHeader));
+}
+
+} // namespace
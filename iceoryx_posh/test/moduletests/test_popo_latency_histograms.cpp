@@ -0,0 +1,170 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histograms.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class LatencyHistograms_test : public Test
+{
+  public:
+    static constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+
+    uint64_t sumOfBucketCounts(const uint32_t index)
+    {
+        uint64_t sum{0U};
+        for (uint32_t bucket = 0U; bucket < LatencyHistograms::NUMBER_OF_BUCKETS; ++bucket)
+        {
+            sum += sut.getBucketCount(index, bucket);
+        }
+        return sum;
+    }
+
+    LatencyHistograms sut;
+};
+
+TEST_F(LatencyHistograms_test, LatenciesBelowOneMicrosecondBelongToTheFirstBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d2b70f5-c338-4e39-ad64-ca7627e6604c");
+    EXPECT_THAT(LatencyHistograms::bucketIndex(0U), Eq(0U));
+    EXPECT_THAT(LatencyHistograms::bucketIndex(NANOSECONDS_PER_MICROSECOND - 1U), Eq(0U));
+}
+
+TEST_F(LatencyHistograms_test, BucketBoundsArePowersOfTwoMicroseconds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f845a953-aee8-49c3-bffa-9b2a665b5b88");
+    for (uint32_t index = 1U; index < LatencyHistograms::NUMBER_OF_BUCKETS; ++index)
+    {
+        const uint64_t lowerBoundUs = 1U << (index - 1U);
+        EXPECT_THAT(LatencyHistograms::bucketIndex(lowerBoundUs * NANOSECONDS_PER_MICROSECOND), Eq(index));
+        EXPECT_THAT(LatencyHistograms::bucketIndex(lowerBoundUs * NANOSECONDS_PER_MICROSECOND - 1U), Eq(index - 1U));
+    }
+}
+
+TEST_F(LatencyHistograms_test, LargeLatenciesBelongToTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4bba03d-0cb0-4e0f-830b-fa73fd31d7ca");
+    EXPECT_THAT(LatencyHistograms::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistograms::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(LatencyHistograms_test, DefaultConstructedHistogramsAreEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "688e2e65-ea30-455e-866c-afc140e0b829");
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_FALSE(sut.getOriginId(0U).isValid());
+    EXPECT_THAT(sumOfBucketCounts(0U), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfReassignments(), Eq(0U));
+}
+
+TEST_F(LatencyHistograms_test, RecordedLatencyIsCountedInItsBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfbba243-84a2-4d94-91c0-f0805d231572");
+    UniquePortId originId;
+    constexpr uint64_t LATENCY_NS{5U * NANOSECONDS_PER_MICROSECOND};
+
+    sut.record(originId, LATENCY_NS);
+    sut.record(originId, LATENCY_NS);
+
+    ASSERT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(sut.getOriginId(0U), Eq(originId));
+    EXPECT_THAT(sut.getBucketCount(0U, LatencyHistograms::bucketIndex(LATENCY_NS)), Eq(2U));
+    EXPECT_THAT(sumOfBucketCounts(0U), Eq(2U));
+}
+
+TEST_F(LatencyHistograms_test, EveryPublisherHasItsOwnHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6f6d231-bc01-4d5d-aac9-ea62683a63b4");
+    UniquePortId originIdA;
+    UniquePortId originIdB;
+
+    sut.record(originIdA, 0U);
+    sut.record(originIdB, 0U);
+    sut.record(originIdB, 0U);
+
+    ASSERT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(sut.getOriginId(0U), Eq(originIdA));
+    EXPECT_THAT(sut.getOriginId(1U), Eq(originIdB));
+    EXPECT_THAT(sumOfBucketCounts(0U), Eq(1U));
+    EXPECT_THAT(sumOfBucketCounts(1U), Eq(2U));
+}
+
+TEST_F(LatencyHistograms_test, FurtherPublisherReusesTheLeastRecentlyRecordedHistogramWhenAllAreAssigned)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6360a2a-2e05-44c8-9384-bda49272ced3");
+    UniquePortId originIds[LatencyHistograms::CAPACITY];
+    for (const auto& originId : originIds)
+    {
+        sut.record(originId, 0U);
+    }
+    // the first publisher is still active, the second one is therefore the least recently recorded
+    sut.record(originIds[0], 0U);
+    UniquePortId furtherOriginId;
+    constexpr uint64_t LATENCY_NS{5U * NANOSECONDS_PER_MICROSECOND};
+
+    sut.record(furtherOriginId, LATENCY_NS);
+
+    EXPECT_THAT(sut.size(), Eq(LatencyHistograms::CAPACITY));
+    EXPECT_THAT(sut.getNumberOfReassignments(), Eq(1U));
+    EXPECT_THAT(sut.getOriginId(0U), Eq(originIds[0]));
+    EXPECT_THAT(sumOfBucketCounts(0U), Eq(2U));
+    ASSERT_THAT(sut.getOriginId(1U), Eq(furtherOriginId));
+    EXPECT_THAT(sut.getBucketCount(1U, LatencyHistograms::bucketIndex(LATENCY_NS)), Eq(1U));
+    EXPECT_THAT(sumOfBucketCounts(1U), Eq(1U));
+}
+
+TEST_F(LatencyHistograms_test, PublishersAreRecordedAfterAnyNumberOfRestarts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02186eb7-f19b-491d-a98b-4a5627288e03");
+    UniquePortId activeOriginId;
+    for (uint32_t restart = 0U; restart < 3U * LatencyHistograms::CAPACITY; ++restart)
+    {
+        UniquePortId restartedOriginId;
+        sut.record(activeOriginId, 0U);
+        sut.record(restartedOriginId, 0U);
+    }
+    UniquePortId lastOriginId;
+
+    sut.record(lastOriginId, 0U);
+
+    bool isLastOriginRecorded{false};
+    bool isActiveOriginRecorded{false};
+    for (uint32_t index = 0U; index < sut.size(); ++index)
+    {
+        isLastOriginRecorded |= (sut.getOriginId(index) == lastOriginId);
+        isActiveOriginRecorded |= (sut.getOriginId(index) == activeOriginId);
+    }
+    EXPECT_TRUE(isLastOriginRecorded);
+    EXPECT_TRUE(isActiveOriginRecorded);
+}
+
+TEST_F(LatencyHistograms_test, OutOfRangeIndicesReturnEmptyValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b8d0302-cf6f-49a6-8a57-44f31bb00df5");
+    sut.record(UniquePortId(), 0U);
+
+    EXPECT_FALSE(sut.getOriginId(1U).isValid());
+    EXPECT_THAT(sut.getBucketCount(LatencyHistograms::CAPACITY, 0U), Eq(0U));
+    EXPECT_THAT(sut.getBucketCount(0U, LatencyHistograms::NUMBER_OF_BUCKETS), Eq(0U));
+}
+
+} // namespace
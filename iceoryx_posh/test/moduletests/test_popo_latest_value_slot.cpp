@@ -0,0 +1,252 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+class LatestValueSlot_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    SharedChunk getChunkFromMemoryManager(const uint64_t value = 0U)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        auto& chunkSettings = chunkSettingsResult.value();
+
+        auto getChunkResult = memoryManager.getChunk(chunkSettings);
+        iox::cxx::Ensures(!getChunkResult.has_error());
+        *static_cast<uint64_t*>(getChunkResult.value().getUserPayload()) = value;
+        return getChunkResult.value();
+    }
+
+    uint64_t getValue(const SharedChunk& chunk)
+    {
+        return *static_cast<const uint64_t*>(chunk.getUserPayload());
+    }
+
+    uint64_t usedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0).m_usedChunks;
+    }
+
+    MemoryManager memoryManager;
+    LatestValueSlot sut;
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100;
+    static constexpr uint32_t CHUNK_SIZE = 128;
+
+    iox::posix::Allocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+TEST_F(LatestValueSlot_test, DefaultConstructedSlotHasNoNewChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "604f0fa6-c9db-42a5-a9d8-9198d3f0a0e6");
+    uint64_t sequenceNumber{0U};
+
+    EXPECT_FALSE(sut.hasNewChunk(sequenceNumber));
+    EXPECT_FALSE(sut.tryAcquire(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, StoredChunkCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3987bb6-8e3e-4af8-afd6-e9a612ac7000");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager(42U));
+
+    EXPECT_TRUE(sut.hasNewChunk(sequenceNumber));
+    auto maybeChunk = sut.tryAcquire(sequenceNumber);
+
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(42U));
+}
+
+TEST_F(LatestValueSlot_test, ChunkIsAcquiredOnlyOncePerStore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb9ae530-e501-4ed4-8942-2a9e2c0294d7");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager(42U));
+
+    EXPECT_TRUE(sut.tryAcquire(sequenceNumber).has_value());
+
+    EXPECT_FALSE(sut.hasNewChunk(sequenceNumber));
+    EXPECT_FALSE(sut.tryAcquire(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, OnlyTheNewestChunkIsAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca739436-03e5-49f0-9fb1-4f5ef30d9f1d");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager(1U));
+    sut.store(getChunkFromMemoryManager(2U));
+    sut.store(getChunkFromMemoryManager(3U));
+
+    auto maybeChunk = sut.tryAcquire(sequenceNumber);
+
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(3U));
+    EXPECT_FALSE(sut.tryAcquire(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, EveryReaderAcquiresTheChunkIndependently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3c3a0a5-50cf-4e17-8f85-e5508cfe23aa");
+    uint64_t sequenceNumberOfReaderA{0U};
+    uint64_t sequenceNumberOfReaderB{0U};
+    sut.store(getChunkFromMemoryManager(13U));
+
+    auto maybeChunkA = sut.tryAcquire(sequenceNumberOfReaderA);
+    auto maybeChunkB = sut.tryAcquire(sequenceNumberOfReaderB);
+
+    ASSERT_TRUE(maybeChunkA.has_value());
+    ASSERT_TRUE(maybeChunkB.has_value());
+    EXPECT_THAT(*maybeChunkA, Eq(*maybeChunkB));
+}
+
+TEST_F(LatestValueSlot_test, ReplacedChunkIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3daf4d6-bcb6-470d-b37d-bcaf35780896");
+    sut.store(getChunkFromMemoryManager());
+    sut.store(getChunkFromMemoryManager());
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+}
+
+TEST_F(LatestValueSlot_test, AcquiredChunkOutlivesReplacement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85aee1fa-ce48-4834-9ee9-966b3ebc4431");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager(7U));
+    auto maybeChunk = sut.tryAcquire(sequenceNumber);
+    ASSERT_TRUE(maybeChunk.has_value());
+
+    sut.store(getChunkFromMemoryManager(8U));
+
+    EXPECT_THAT(usedChunks(), Eq(2U));
+    EXPECT_THAT(getValue(*maybeChunk), Eq(7U));
+}
+
+TEST_F(LatestValueSlot_test, ClearReleasesTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b27bbb4c-6139-4ac4-a822-45c19794fceb");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager());
+
+    sut.clear();
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_FALSE(sut.hasNewChunk(sequenceNumber));
+    EXPECT_FALSE(sut.tryAcquire(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, ChunkStoredAfterClearCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aafa0dfb-82ed-4d9c-b91a-09b2bfc2dff1");
+    uint64_t sequenceNumber{0U};
+    sut.store(getChunkFromMemoryManager(1U));
+    EXPECT_TRUE(sut.tryAcquire(sequenceNumber).has_value());
+    sut.clear();
+
+    sut.store(getChunkFromMemoryManager(2U));
+    auto maybeChunk = sut.tryAcquire(sequenceNumber);
+
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(2U));
+}
+
+TEST_F(LatestValueSlot_test, RelativePointerDataConversionRoundTrips)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5639c1a-fd76-4d13-965b-cf6b960411d7");
+    auto data = LatestValueSlot::toRelativePointerData(&sut);
+
+    EXPECT_FALSE(data.isLogicalNullptr());
+    EXPECT_THAT(LatestValueSlot::fromRelativePointerData(data), Eq(&sut));
+}
+
+TEST_F(LatestValueSlot_test, NullptrIsConvertedToLogicalNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70da367e-c624-4483-862e-5f8d51cf3d38");
+    auto data = LatestValueSlot::toRelativePointerData(nullptr);
+
+    EXPECT_TRUE(data.isLogicalNullptr());
+    EXPECT_THAT(LatestValueSlot::fromRelativePointerData(data), Eq(nullptr));
+}
+
+TEST_F(LatestValueSlot_test, ConcurrentReaderAcquiresIncreasingValuesWithoutLeakingChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a13ac3d-0f79-4ce4-8dee-0aedd456bf38");
+    constexpr uint64_t NUMBER_OF_STORES{10000U};
+    std::atomic_bool isWriterFinished{false};
+    std::atomic_bool hasReaderSeenDecreasingValue{false};
+
+    std::thread reader([&] {
+        uint64_t sequenceNumber{0U};
+        uint64_t lastValue{0U};
+        while (!isWriterFinished.load())
+        {
+            auto maybeChunk = sut.tryAcquire(sequenceNumber);
+            if (maybeChunk.has_value())
+            {
+                const auto value = getValue(*maybeChunk);
+                if (value < lastValue)
+                {
+                    hasReaderSeenDecreasingValue = true;
+                }
+                lastValue = value;
+            }
+        }
+    });
+
+    for (uint64_t i = 1U; i <= NUMBER_OF_STORES; ++i)
+    {
+        sut.store(getChunkFromMemoryManager(i));
+    }
+    isWriterFinished = true;
+    reader.join();
+
+    EXPECT_FALSE(hasReaderSeenDecreasingValue.load());
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    sut.clear();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
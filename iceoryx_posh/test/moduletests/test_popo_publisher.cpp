@@ -107,6 +107,24 @@ TEST_F(PublisherTest, LoanWithArgumentsCallsCustomCtor)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanedSampleWithConflationKeyHeaderIsIdentifiedByTheUserHeaderId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a03b238-f6a3-4932-91dc-39ff5c4be6c8");
+    using ConflationPublisher =
+        iox::popo::PublisherImpl<DummyData, iox::popo::ConflationKeyHeader, MockBasePublisher<DummyData>>;
+    ConflationPublisher publisher{{"", "", ""}};
+    ChunkMock<DummyData, iox::popo::ConflationKeyHeader> conflationChunkMock;
+    EXPECT_CALL(publisher.mockPort(), tryAllocateChunk(sizeof(DummyData), _, sizeof(iox::popo::ConflationKeyHeader), _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(conflationChunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = publisher.loan();
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(conflationChunkMock.chunkHeader()->userHeaderId(), Eq(iox::popo::ConflationKeyHeader::USER_HEADER_ID));
+    EXPECT_CALL(publisher.mockPort(), releaseChunk(conflationChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6e341963-5917-440b-b01a-2fc8fff64def");
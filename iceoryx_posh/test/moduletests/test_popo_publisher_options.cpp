@@ -32,6 +32,9 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.mempoolReservation = 3U;
+    testOptions.latestValueOnly = true;
+    testOptions.inlineDelivery = true;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +49,15 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.mempoolReservation, Ne(defaultOptions.mempoolReservation));
+            EXPECT_THAT(roundTripOptions.mempoolReservation, Eq(testOptions.mempoolReservation));
+
+            EXPECT_THAT(roundTripOptions.latestValueOnly, Ne(defaultOptions.latestValueOnly));
+            EXPECT_THAT(roundTripOptions.latestValueOnly, Eq(testOptions.latestValueOnly));
+
+            EXPECT_THAT(roundTripOptions.inlineDelivery, Ne(defaultOptions.inlineDelivery));
+            EXPECT_THAT(roundTripOptions.inlineDelivery, Eq(testOptions.inlineDelivery));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +78,15 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr iox::mepoo::MemPoolReservation_t MEMPOOL_RESERVATION{iox::mepoo::NO_MEMPOOL_RESERVATION};
+    constexpr bool LATEST_VALUE_ONLY{false};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            MEMPOOL_RESERVATION,
+                                                            LATEST_VALUE_ONLY);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
@@ -0,0 +1,112 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/ring_publisher.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "mocks/publisher_mock.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using ::testing::_;
+using namespace iox::popo;
+
+constexpr uint64_t RING_CAPACITY{64U};
+
+struct RingMemory
+{
+    alignas(ByteRing) uint8_t memory[sizeof(ByteRing) + RING_CAPACITY];
+};
+
+using TestRingPublisher = RingPublisherImpl<MockBasePublisher<void>>;
+
+class RingPublisherTest : public Test
+{
+  protected:
+    void expectRingAllocation()
+    {
+        EXPECT_CALL(portMock,
+                    tryAllocateChunk(static_cast<uint32_t>(ByteRing::requiredMemorySize(RING_CAPACITY)),
+                                     static_cast<uint32_t>(alignof(ByteRing)),
+                                     iox::CHUNK_NO_USER_HEADER_SIZE,
+                                     iox::CHUNK_NO_USER_HEADER_ALIGNMENT))
+            .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))));
+    }
+
+    ChunkMock<RingMemory> chunkMock;
+    TestRingPublisher sut{{"", "", ""}, RING_CAPACITY};
+    MockPublisherPortUser& portMock{sut.mockPort()};
+    const char record[8]{'z', 'o', 'i', 'd', 'b', 'e', 'r', 'g'};
+};
+
+TEST_F(RingPublisherTest, FirstWriteLoansAndPublishesTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "667483a3-5d2e-432b-84dd-5f2631a304ae");
+    expectRingAllocation();
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader())).Times(1);
+
+    EXPECT_FALSE(sut.write(record, sizeof(record)).has_error());
+
+    ByteRingReader reader(*static_cast<const ByteRing*>(chunkMock.chunkHeader()->userPayload()));
+    char buffer[sizeof(record)];
+    auto result = reader.read(buffer, sizeof(buffer));
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(sizeof(record)));
+    EXPECT_THAT(std::memcmp(buffer, record, sizeof(record)), Eq(0));
+}
+
+TEST_F(RingPublisherTest, FurtherWritesUseTheSameRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd8c3816-53bb-473a-a02e-0cdb8fca1f7f");
+    expectRingAllocation();
+    EXPECT_CALL(portMock, sendChunk(_)).Times(1);
+
+    EXPECT_FALSE(sut.write(record, sizeof(record)).has_error());
+    EXPECT_FALSE(sut.write(record, sizeof(record)).has_error());
+    EXPECT_FALSE(sut.write(record, sizeof(record)).has_error());
+}
+
+TEST_F(RingPublisherTest, WriteFailsWhenTheRingCannotBeLoaned)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9af12ef4-a4d7-474c-85c3-f03d24448b6c");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+
+    auto result = sut.write(record, sizeof(record));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::RING_NOT_AVAILABLE));
+}
+
+TEST_F(RingPublisherTest, NotifyResendsTheRingWhenItExists)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c56145b-3e79-4718-8738-5a59e40dd7d7");
+    EXPECT_CALL(portMock, resendPreviousChunk()).Times(0);
+    sut.notify();
+    Mock::VerifyAndClearExpectations(&portMock);
+
+    expectRingAllocation();
+    EXPECT_CALL(portMock, sendChunk(_)).Times(1);
+    EXPECT_FALSE(sut.write(record, sizeof(record)).has_error());
+    EXPECT_CALL(portMock, resendPreviousChunk()).Times(1);
+
+    sut.notify();
+}
+
+} // namespace
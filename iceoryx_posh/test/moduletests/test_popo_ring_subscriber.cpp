@@ -0,0 +1,149 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/ring_subscriber.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "mocks/subscriber_mock.hpp"
+
+#include "test.hpp"
+
+#include <new>
+
+namespace
+{
+using namespace ::testing;
+using ::testing::_;
+using namespace iox::popo;
+
+constexpr uint64_t RING_CAPACITY{64U};
+
+struct RingMemory
+{
+    alignas(ByteRing) uint8_t memory[sizeof(ByteRing) + RING_CAPACITY];
+};
+
+class TestRingSubscriber : public RingSubscriberImpl<MockBaseSubscriber<void>>
+{
+  public:
+    using SubscriberParent = RingSubscriberImpl<MockBaseSubscriber<void>>;
+
+    TestRingSubscriber(const iox::capro::ServiceDescription& service,
+                       const SubscriberOptions& subscriberOptions = SubscriberOptions())
+        : SubscriberParent(service, subscriberOptions)
+    {
+    }
+
+    using SubscriberParent::port;
+};
+
+class RingSubscriberTest : public Test
+{
+  protected:
+    static iox::cxx::expected<const iox::mepoo::ChunkHeader*, ChunkReceiveResult>
+    chunk(const iox::mepoo::ChunkHeader* const chunkHeader)
+    {
+        return iox::cxx::success<const iox::mepoo::ChunkHeader*>(chunkHeader);
+    }
+
+    static iox::cxx::expected<const iox::mepoo::ChunkHeader*, ChunkReceiveResult> noChunk()
+    {
+        return iox::cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    ChunkMock<RingMemory> ringChunkMock;
+    ByteRing& ring{*new (ringChunkMock.sample()) ByteRing(RING_CAPACITY)};
+    TestRingSubscriber sut{{"", "", ""}};
+    const char record[6]{'e', 'l', 'z', 'a', 'r', '!'};
+    char buffer[RING_CAPACITY];
+};
+
+TEST_F(RingSubscriberTest, ReadFailsWhenNoRingWasReceived)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0d15861-18bf-4b7e-9301-ff6ecbc31834");
+    EXPECT_CALL(sut, takeChunk).WillOnce(Return(noChunk()));
+
+    auto result = sut.read(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::RING_NOT_AVAILABLE));
+    EXPECT_FALSE(sut.hasLostRecords());
+}
+
+TEST_F(RingSubscriberTest, ReadsTheRecordsOfTheReceivedRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8c63578-ce86-4a3d-aec1-794014303eac");
+    ASSERT_FALSE(ring.write(record, sizeof(record)).has_error());
+    EXPECT_CALL(sut, takeChunk).WillOnce(Return(chunk(ringChunkMock.chunkHeader()))).WillRepeatedly(Return(noChunk()));
+
+    auto result = sut.read(buffer, sizeof(buffer));
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(sizeof(record)));
+    EXPECT_THAT(std::memcmp(buffer, record, sizeof(record)), Eq(0));
+    result = sut.read(buffer, sizeof(buffer));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::NO_RECORD_AVAILABLE));
+
+    EXPECT_CALL(sut.port(), releaseChunk(ringChunkMock.chunkHeader())).Times(1);
+}
+
+TEST_F(RingSubscriberTest, NotificationsForTheHeldRingAreReleasedImmediately)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dee46b83-bd78-482d-839c-243f979a62d9");
+    EXPECT_CALL(sut, takeChunk)
+        .WillOnce(Return(chunk(ringChunkMock.chunkHeader())))
+        .WillOnce(Return(chunk(ringChunkMock.chunkHeader())))
+        .WillOnce(Return(chunk(ringChunkMock.chunkHeader())))
+        .WillRepeatedly(Return(noChunk()));
+    EXPECT_CALL(sut.port(), releaseChunk(ringChunkMock.chunkHeader())).Times(2);
+
+    EXPECT_TRUE(sut.read(buffer, sizeof(buffer)).has_error());
+
+    Mock::VerifyAndClearExpectations(&sut.port());
+    EXPECT_CALL(sut.port(), releaseChunk(ringChunkMock.chunkHeader())).Times(1);
+}
+
+TEST_F(RingSubscriberTest, ChunkWhichIsNoRingIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec6c4826-066f-40f6-9c6c-8db9090e9264");
+    ChunkMock<uint64_t> otherChunkMock;
+    EXPECT_CALL(sut, takeChunk).WillOnce(Return(chunk(otherChunkMock.chunkHeader()))).WillOnce(Return(noChunk()));
+    EXPECT_CALL(sut.port(), releaseChunk(otherChunkMock.chunkHeader())).Times(1);
+
+    auto result = sut.read(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ByteRingError::RING_NOT_AVAILABLE));
+}
+
+TEST_F(RingSubscriberTest, RecordsOverwrittenBeforeTheyWereReadAreReportedAsLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ffc7d3cf-db7b-408d-b650-80aa83840941");
+    EXPECT_CALL(sut, takeChunk).WillOnce(Return(chunk(ringChunkMock.chunkHeader()))).WillRepeatedly(Return(noChunk()));
+    EXPECT_TRUE(sut.read(buffer, sizeof(buffer)).has_error());
+    for (uint32_t i = 0U; i < 5U; ++i)
+    {
+        ASSERT_FALSE(ring.write(record, sizeof(record)).has_error());
+    }
+
+    EXPECT_FALSE(sut.read(buffer, sizeof(buffer)).has_error());
+
+    EXPECT_TRUE(sut.hasLostRecords());
+    EXPECT_FALSE(sut.hasLostRecords());
+    EXPECT_CALL(sut.port(), releaseChunk(ringChunkMock.chunkHeader())).Times(1);
+}
+
+} // namespace
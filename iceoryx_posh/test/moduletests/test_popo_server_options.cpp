@@ -34,6 +34,7 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.offerOnCreate = false;
     testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.mempoolReservation = 7U;
 
     iox::popo::ServerOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,9 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.mempoolReservation, Ne(defaultOptions.mempoolReservation));
+            EXPECT_THAT(roundTripOptions.mempoolReservation, Eq(testOptions.mempoolReservation));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of ServerOptions failed!"; });
 }
@@ -72,9 +76,14 @@ iox::cxx::Serialization enumSerialization(QueueFullPolicyUT requsetQueueFullPoli
     constexpr uint64_t REQUEST_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
-
-    return iox::cxx::Serialization::create(
-        REQUEST_QUEUE_CAPACITY, NODE_NAME, OFFER_ON_CREATE, requsetQueueFullPolicy, clientTooSlowPolicy);
+    constexpr iox::mepoo::MemPoolReservation_t MEMPOOL_RESERVATION{iox::mepoo::NO_MEMPOOL_RESERVATION};
+
+    return iox::cxx::Serialization::create(REQUEST_QUEUE_CAPACITY,
+                                           NODE_NAME,
+                                           OFFER_ON_CREATE,
+                                           requsetQueueFullPolicy,
+                                           clientTooSlowPolicy,
+                                           MEMPOOL_RESERVATION);
 }
 
 TEST(ServerOptions_test, DeserializingValidRequestQueueFullPolicyAndClientTooSlowPolicyIsSuccessful)
@@ -188,4 +197,16 @@ TEST(ServerOptions_test, ComparisonOperatorReturnsFalseClientTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseMempoolReservationDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b8f6e31-c4d7-4a59-9e0a-73d5b1f8c2e6");
+    ServerOptions options1;
+    options1.mempoolReservation = 1U;
+    ServerOptions options2;
+    options2.mempoolReservation = 2U;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -34,6 +34,12 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.queueConflationPolicy = iox::popo::QueueConflationPolicy::KEEP_LATEST_PER_KEY;
+    testOptions.userHeaderFilter = iox::popo::UserHeaderFilter::inRange(8U, 4U, 13U, 37U);
+    testOptions.deliveryDecimation = 10U;
+    testOptions.minimumDeliveryInterval = iox::units::Duration::fromMilliseconds(100U);
+    testOptions.maximumSampleAge = iox::units::Duration::fromMilliseconds(20U);
+    testOptions.deadline = iox::units::Duration::fromMilliseconds(50U);
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,6 +59,27 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.queueConflationPolicy, Ne(defaultOptions.queueConflationPolicy));
+            EXPECT_THAT(roundTripOptions.queueConflationPolicy, Eq(testOptions.queueConflationPolicy));
+
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.operation, Ne(defaultOptions.userHeaderFilter.operation));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.operation, Eq(testOptions.userHeaderFilter.operation));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.fieldOffset, Eq(testOptions.userHeaderFilter.fieldOffset));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.fieldSize, Eq(testOptions.userHeaderFilter.fieldSize));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.firstOperand, Eq(testOptions.userHeaderFilter.firstOperand));
+            EXPECT_THAT(roundTripOptions.userHeaderFilter.secondOperand,
+                        Eq(testOptions.userHeaderFilter.secondOperand));
+
+            EXPECT_THAT(roundTripOptions.deliveryDecimation, Ne(defaultOptions.deliveryDecimation));
+            EXPECT_THAT(roundTripOptions.deliveryDecimation, Eq(testOptions.deliveryDecimation));
+            EXPECT_THAT(roundTripOptions.minimumDeliveryInterval, Ne(defaultOptions.minimumDeliveryInterval));
+            EXPECT_THAT(roundTripOptions.minimumDeliveryInterval, Eq(testOptions.minimumDeliveryInterval));
+
+            EXPECT_THAT(roundTripOptions.maximumSampleAge, Ne(defaultOptions.maximumSampleAge));
+            EXPECT_THAT(roundTripOptions.maximumSampleAge, Eq(testOptions.maximumSampleAge));
+            EXPECT_THAT(roundTripOptions.deadline, Ne(defaultOptions.deadline));
+            EXPECT_THAT(roundTripOptions.deadline, Eq(testOptions.deadline));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
@@ -82,4 +109,84 @@ TEST(SubscriberOptions_test, DeserializingInvalidQueueFullPolicyFails)
         .or_else([&](auto&) { GTEST_SUCCEED(); });
 }
 
+TEST(SubscriberOptions_test, DeserializingInvalidQueueConflationPolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e572fa41-9c6c-46c3-8354-529aac6560c5");
+    constexpr uint64_t QUEUE_CAPACITY{73U};
+    constexpr uint64_t HISTORY_REQUEST{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool SUBSCRIBE_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::QueueFullPolicy> QUEUE_FULL_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::QueueFullPolicy>>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER)};
+    constexpr bool REQUIRES_PUBLISHER_HISTORY_SUPPORT{false};
+    constexpr std::underlying_type_t<iox::popo::QueueConflationPolicy> QUEUE_CONFLATION_POLICY{111};
+
+    const auto serialized = iox::cxx::Serialization::create(QUEUE_CAPACITY,
+                                                            HISTORY_REQUEST,
+                                                            NODE_NAME,
+                                                            SUBSCRIBE_ON_CREATE,
+                                                            QUEUE_FULL_POLICY,
+                                                            REQUIRES_PUBLISHER_HISTORY_SUPPORT,
+                                                            QUEUE_CONFLATION_POLICY);
+    iox::popo::SubscriberOptions::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+iox::cxx::Serialization serializeWithUserHeaderFilter(
+    const std::underlying_type_t<iox::popo::UserHeaderFilter::Operation> filterOperation, const uint32_t fieldSize)
+{
+    constexpr uint64_t QUEUE_CAPACITY{73U};
+    constexpr uint64_t HISTORY_REQUEST{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool SUBSCRIBE_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::QueueFullPolicy> QUEUE_FULL_POLICY{
+        static_cast<std::underlying_type_t<iox::popo::QueueFullPolicy>>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER)};
+    constexpr bool REQUIRES_PUBLISHER_HISTORY_SUPPORT{false};
+    constexpr std::underlying_type_t<iox::popo::QueueConflationPolicy> QUEUE_CONFLATION_POLICY{0U};
+    constexpr uint32_t FIELD_OFFSET{0U};
+    constexpr uint64_t FIRST_OPERAND{1U};
+    constexpr uint64_t SECOND_OPERAND{2U};
+    constexpr uint64_t DELIVERY_DECIMATION{1U};
+    constexpr uint64_t MINIMUM_DELIVERY_INTERVAL_NS{0U};
+    constexpr uint64_t MAXIMUM_SAMPLE_AGE_NS{0U};
+    constexpr uint64_t DEADLINE_NS{0U};
+
+    return iox::cxx::Serialization::create(QUEUE_CAPACITY,
+                                           HISTORY_REQUEST,
+                                           NODE_NAME,
+                                           SUBSCRIBE_ON_CREATE,
+                                           QUEUE_FULL_POLICY,
+                                           REQUIRES_PUBLISHER_HISTORY_SUPPORT,
+                                           QUEUE_CONFLATION_POLICY,
+                                           filterOperation,
+                                           FIELD_OFFSET,
+                                           fieldSize,
+                                           FIRST_OPERAND,
+                                           SECOND_OPERAND,
+                                           DELIVERY_DECIMATION,
+                                           MINIMUM_DELIVERY_INTERVAL_NS,
+                                           MAXIMUM_SAMPLE_AGE_NS,
+                                           DEADLINE_NS);
+}
+
+TEST(SubscriberOptions_test, DeserializingInvalidUserHeaderFilterOperationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "651d7ce8-6f3c-4f81-9a3c-a97c535946a0");
+    iox::popo::SubscriberOptions::deserialize(serializeWithUserHeaderFilter(111U, 4U))
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+TEST(SubscriberOptions_test, DeserializingUserHeaderFilterWithInvalidFieldSizeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c545e196-f027-448e-bada-6f90e390d0b3");
+    constexpr std::underlying_type_t<iox::popo::UserHeaderFilter::Operation> EQUAL_TO{
+        static_cast<std::underlying_type_t<iox::popo::UserHeaderFilter::Operation>>(
+            iox::popo::UserHeaderFilter::Operation::EQUAL_TO)};
+    iox::popo::SubscriberOptions::deserialize(serializeWithUserHeaderFilter(EQUAL_TO, 3U))
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 } // namespace
@@ -0,0 +1,162 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/user_header_filter.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+struct TestUserHeader
+{
+    uint8_t flags{0U};
+    uint16_t classification{0U};
+    uint32_t sensorId{0U};
+    uint64_t objectId{0U};
+};
+
+class UserHeaderFilter_test : public Test
+{
+  public:
+    ChunkHeader& createChunk(const TestUserHeader& userHeader)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(
+            sizeof(uint64_t), alignof(uint64_t), sizeof(TestUserHeader), alignof(TestUserHeader));
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        auto* chunkHeader = new (m_memory.get()) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+        *static_cast<TestUserHeader*>(chunkHeader->userHeader()) = userHeader;
+        return *chunkHeader;
+    }
+
+    ChunkHeader& createChunkWithoutUserHeader()
+    {
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        iox::cxx::Ensures(!chunkSettingsResult.has_error());
+        return *new (m_memory.get()) ChunkHeader(CHUNK_SIZE, chunkSettingsResult.value());
+    }
+
+    static UserHeaderFilter sensorIdEqualTo(const uint64_t value)
+    {
+        return UserHeaderFilter::equalTo(offsetof(TestUserHeader, sensorId), sizeof(uint32_t), value);
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{256U};
+    // NOLINTJUSTIFICATION raw memory for a chunk
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    std::unique_ptr<uint64_t[]> m_memory{new uint64_t[CHUNK_SIZE / sizeof(uint64_t)]};
+};
+
+TEST_F(UserHeaderFilter_test, DefaultFilterAcceptsEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb30d892-eca2-4a76-80ba-5c12a20a1336");
+    UserHeaderFilter sut;
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_TRUE(sut.accepts(createChunkWithoutUserHeader()));
+    EXPECT_TRUE(sut.accepts(createChunk(TestUserHeader{})));
+}
+
+TEST_F(UserHeaderFilter_test, EqualToAcceptsOnlyEqualField)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "51cb90e5-a7d7-43d2-b4cf-82e2c65495bf");
+    auto sut = sensorIdEqualTo(42U);
+    TestUserHeader userHeader;
+
+    userHeader.sensorId = 42U;
+    EXPECT_TRUE(sut.accepts(createChunk(userHeader)));
+    userHeader.sensorId = 43U;
+    EXPECT_FALSE(sut.accepts(createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, InRangeAcceptsFieldWithinBounds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7750c80c-fe7f-4380-ba3d-70e3e8fa789e");
+    auto sut = UserHeaderFilter::inRange(offsetof(TestUserHeader, classification), sizeof(uint16_t), 10U, 19U);
+    TestUserHeader userHeader;
+
+    for (const uint16_t classification : std::initializer_list<uint16_t>{9U, 10U, 15U, 19U, 20U})
+    {
+        userHeader.classification = classification;
+        EXPECT_THAT(sut.accepts(createChunk(userHeader)), Eq(classification >= 10U && classification <= 19U));
+    }
+}
+
+TEST_F(UserHeaderFilter_test, AnyBitSetAcceptsFieldWithOneOfTheMaskBits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7cf3de7b-031c-486c-af37-443a1b4cfadf");
+    auto sut = UserHeaderFilter::anyBitSet(offsetof(TestUserHeader, flags), sizeof(uint8_t), 0x6U);
+    TestUserHeader userHeader;
+
+    userHeader.flags = 0x4U;
+    EXPECT_TRUE(sut.accepts(createChunk(userHeader)));
+    userHeader.flags = 0x9U;
+    EXPECT_FALSE(sut.accepts(createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, FilterOnEightByteFieldWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "297c9e8f-67cd-4af8-b8ba-ea69761b9cd1");
+    constexpr uint64_t OBJECT_ID{0x123456789ABCDEF0U};
+    auto sut = UserHeaderFilter::equalTo(offsetof(TestUserHeader, objectId), sizeof(uint64_t), OBJECT_ID);
+    TestUserHeader userHeader;
+    userHeader.objectId = OBJECT_ID;
+
+    EXPECT_TRUE(sut.accepts(createChunk(userHeader)));
+}
+
+TEST_F(UserHeaderFilter_test, ChunkWithoutUserHeaderIsNotAccepted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62e25622-5984-4a34-a0a7-993b177b3055");
+    auto sut = sensorIdEqualTo(0U);
+
+    EXPECT_FALSE(sut.accepts(createChunkWithoutUserHeader()));
+}
+
+TEST_F(UserHeaderFilter_test, ChunkWhoseUserHeaderDoesNotContainTheFieldIsNotAccepted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1516d3a-9286-4a39-9ef4-862a78e66a02");
+    auto sut = UserHeaderFilter::equalTo(sizeof(TestUserHeader) - 2U, sizeof(uint32_t), 0U);
+
+    EXPECT_FALSE(sut.accepts(createChunk(TestUserHeader{})));
+}
+
+TEST_F(UserHeaderFilter_test, InvalidFieldSizeTerminates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a5e68d5-15a9-45d8-8ad0-f6a582a2ec75");
+    EXPECT_DEATH(IOX_DISCARD_RESULT(UserHeaderFilter::equalTo(0U, 3U, 0U)), ".*");
+}
+
+TEST_F(UserHeaderFilter_test, FilterWithInvalidFieldSizeIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2efc38d0-9631-4ec0-975c-ec8bdee78040");
+    auto sut = sensorIdEqualTo(0U);
+    sut.fieldSize = 3U;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_FALSE(sut.accepts(createChunk(TestUserHeader{})));
+}
+
+} // namespace
@@ -294,6 +294,15 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithHistoryGreaterMaxCapacityClam
     EXPECT_EQ(publisherPort->m_chunkSenderData.m_historyCapacity, iox::MAX_PUBLISHER_HISTORY);
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithoutNodeNameUsesTheRuntimeName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cfac94f-2243-4feb-94f0-34c1049ec52a");
+    const auto publisherPort = m_runtime->getMiddlewarePublisher(iox::capro::ServiceDescription("99", "1", "20"));
+
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(publisherPort->m_nodeName, iox::NodeName_t(iox::cxx::TruncateToCapacity, m_runtimeName.c_str()));
+}
+
 TEST_F(PoshRuntime_test, getMiddlewarePublisherDefaultArgs)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1eae6dfa-c3f2-478b-9354-768c43bd8d96");
@@ -639,6 +648,143 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithQueueFullPolicySetToBlockPub
                 Eq(iox::popo::QueueFullPolicy::BLOCK_PRODUCER));
 }
 
+TEST_F(PoshRuntime_test, CreatePortsWithPublishersAndSubscribersIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f2035fe-746a-4ab3-b530-3e6f5994e562");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 13U;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 42U;
+
+    iox::runtime::PortRequestContainer requests;
+    requests.emplace_back(
+        iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "20"), publisherOptions));
+    requests.emplace_back(
+        iox::runtime::PortRequest::subscriber(iox::capro::ServiceDescription("99", "1", "21"), subscriberOptions));
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "22")));
+
+    const auto results = m_runtime->createPorts(requests);
+
+    ASSERT_THAT(results.size(), Eq(requests.size()));
+    EXPECT_THAT(results[0].type, Eq(iox::runtime::PortRequestType::PUBLISHER));
+    ASSERT_NE(nullptr, results[0].publisherPortData);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "20"), results[0].publisherPortData->m_serviceDescription);
+    EXPECT_EQ(publisherOptions.historyCapacity, results[0].publisherPortData->m_chunkSenderData.m_historyCapacity);
+
+    EXPECT_THAT(results[1].type, Eq(iox::runtime::PortRequestType::SUBSCRIBER));
+    ASSERT_NE(nullptr, results[1].subscriberPortData);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "21"), results[1].subscriberPortData->m_serviceDescription);
+    EXPECT_EQ(subscriberOptions.queueCapacity, results[1].subscriberPortData->m_chunkReceiverData.m_queue.capacity());
+
+    EXPECT_THAT(results[2].type, Eq(iox::runtime::PortRequestType::PUBLISHER));
+    ASSERT_NE(nullptr, results[2].publisherPortData);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "22"), results[2].publisherPortData->m_serviceDescription);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithMoreRequestsThanFitIntoOneIpcMessageIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e5d66b9-8614-41d1-ae12-67ce4893f23d");
+    const iox::capro::IdString_t longName(TruncateToCapacity, std::string(iox::capro::IdString_t::capacity(), 'x'));
+
+    iox::runtime::PortRequestContainer requests;
+    for (uint32_t i = 0U; i < iox::MAX_PORT_REQUESTS_PER_BATCH; ++i)
+    {
+        const iox::capro::ServiceDescription service(
+            longName, longName, iox::capro::IdString_t(TruncateToCapacity, convert::toString(i)));
+        requests.emplace_back((i % 2U == 0U) ? iox::runtime::PortRequest::publisher(service)
+                                             : iox::runtime::PortRequest::subscriber(service));
+    }
+
+    const auto results = m_runtime->createPorts(requests);
+
+    ASSERT_THAT(results.size(), Eq(requests.size()));
+    for (uint32_t i = 0U; i < iox::MAX_PORT_REQUESTS_PER_BATCH; ++i)
+    {
+        if (i % 2U == 0U)
+        {
+            ASSERT_NE(nullptr, results[i].publisherPortData);
+            EXPECT_EQ(requests[i].service, results[i].publisherPortData->m_serviceDescription);
+        }
+        else
+        {
+            ASSERT_NE(nullptr, results[i].subscriberPortData);
+            EXPECT_EQ(requests[i].service, results[i].subscriberPortData->m_serviceDescription);
+        }
+    }
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithForbiddenServiceDescriptionFailsOnlyForThisPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d65b781-3a96-428d-88e4-4ba240f4a079");
+    auto forbiddenServiceDescriptionDetected{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&forbiddenServiceDescriptionDetected](const iox::PoshError error, const iox::ErrorLevel) {
+            if (error == iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN)
+            {
+                forbiddenServiceDescriptionDetected = true;
+            }
+        });
+
+    iox::runtime::PortRequestContainer requests;
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::roudi::IntrospectionPortService));
+    requests.emplace_back(iox::runtime::PortRequest::subscriber(iox::capro::ServiceDescription("99", "1", "20")));
+
+    const auto results = m_runtime->createPorts(requests);
+
+    ASSERT_THAT(results.size(), Eq(requests.size()));
+    EXPECT_EQ(nullptr, results[0].publisherPortData);
+    EXPECT_NE(nullptr, results[1].subscriberPortData);
+    EXPECT_TRUE(forbiddenServiceDescriptionDetected);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsUsesTheRuntimeNameAsDefaultNodeName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35c951de-aada-4ab9-a5bf-1c8017bcf1b5");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.nodeName = m_nodeName;
+
+    iox::runtime::PortRequestContainer requests;
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "30")));
+    requests.emplace_back(
+        iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "31"), publisherOptions));
+    requests.emplace_back(iox::runtime::PortRequest::subscriber(iox::capro::ServiceDescription("99", "1", "32")));
+
+    const auto results = m_runtime->createPorts(requests);
+
+    ASSERT_THAT(results.size(), Eq(requests.size()));
+    ASSERT_NE(nullptr, results[0].publisherPortData);
+    EXPECT_EQ(iox::NodeName_t(m_runtimeName), results[0].publisherPortData->m_nodeName);
+    ASSERT_NE(nullptr, results[1].publisherPortData);
+    EXPECT_EQ(m_nodeName, results[1].publisherPortData->m_nodeName);
+    ASSERT_NE(nullptr, results[2].subscriberPortData);
+    EXPECT_EQ(iox::NodeName_t(m_runtimeName), results[2].subscriberPortData->m_nodeName);
+}
+
+TEST_F(PoshRuntime_test, CreatePortsPublishesTheServiceRegistryOnceForTheWholeBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "449cf211-7844-4b8d-affe-d8d04ea73184");
+    const iox::capro::ServiceDescription serviceRegistry{
+        iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    iox::SubscriberPortUserType registrySubscriber(m_runtime->getMiddlewareSubscriber(serviceRegistry));
+    ASSERT_THAT(registrySubscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+
+    iox::runtime::PortRequestContainer requests;
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "40")));
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "41")));
+    requests.emplace_back(iox::runtime::PortRequest::publisher(iox::capro::ServiceDescription("99", "1", "42")));
+
+    const auto results = m_runtime->createPorts(requests);
+    ASSERT_THAT(results.size(), Eq(requests.size()));
+
+    uint64_t numberOfServiceRegistryPublications{0U};
+    for (auto chunk = registrySubscriber.tryGetChunk(); !chunk.has_error(); chunk = registrySubscriber.tryGetChunk())
+    {
+        registrySubscriber.releaseChunk(chunk.value());
+        ++numberOfServiceRegistryPublications;
+    }
+    EXPECT_THAT(numberOfServiceRegistryPublications, Eq(1U));
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareClientWithDefaultArgsIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2db35746-e402-443f-b374-3b6a239ab5fd");
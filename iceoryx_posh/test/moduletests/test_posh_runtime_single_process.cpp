@@ -15,6 +15,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_platform/stat.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 
@@ -61,6 +63,54 @@ TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessIsSucce
         { std::unique_ptr<PoshRuntimeSingleProcess> sut{new PoshRuntimeSingleProcess(runtimeName)}; });
 }
 
+TEST_F(PoshRuntimeSingleProcess_test, PortsCanBeCreatedWithMultipleRuntimeMessageWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f36f5c43-7c88-4226-bb0a-ee39f6289657");
+    iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(defaultRouDiConfig)};
+
+    constexpr uint32_t RUNTIME_MESSAGE_WORKERS{4U};
+    std::unique_ptr<RouDi> roudi{new RouDi(roudiComponents->rouDiMemoryManager,
+                                           roudiComponents->portManager,
+                                           RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF,
+                                                                         false,
+                                                                         RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                                         iox::version::CompatibilityCheckLevel::PATCH,
+                                                                         iox::roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                                         RUNTIME_MESSAGE_WORKERS})};
+
+    std::unique_ptr<PoshRuntimeSingleProcess> sut{new PoshRuntimeSingleProcess(RuntimeName_t{"App"})};
+
+    const iox::capro::ServiceDescription service{"Radar", "Front", "Objects"};
+    EXPECT_NE(nullptr, sut->getMiddlewarePublisher(service));
+    EXPECT_NE(nullptr, sut->getMiddlewareSubscriber(service));
+}
+
+TEST_F(PoshRuntimeSingleProcess_test, RegistrationPassesTheFileDescriptorOfTheMemfdManagementMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5d0e8a3-6f2c-4e71-9a4d-1c7f3b92e605");
+    if (!iox::platform::IOX_SUPPORT_MEMFD)
+    {
+        GTEST_SKIP() << "memfd is not supported on this platform";
+    }
+    iox::RouDiConfig_t roudiConfig = iox::RouDiConfig_t().setDefaults();
+    roudiConfig.m_memfdManagementMemory = true;
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(roudiConfig)};
+
+    std::unique_ptr<RouDi> roudi{new RouDi(roudiComponents->rouDiMemoryManager,
+                                           roudiComponents->portManager,
+                                           RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF, false})};
+
+    using namespace iox::units::duration_literals;
+    IpcRuntimeInterface sut(IPC_CHANNEL_ROUDI_NAME, RuntimeName_t{"App"}, 1_s);
+
+    const auto fileDescriptor = sut.getMgmtMemoryFileDescriptor();
+    ASSERT_TRUE(fileDescriptor.has_value());
+    struct stat fileStatus;
+    ASSERT_THAT(fstat(fileDescriptor.value(), &fileStatus), Eq(0));
+    EXPECT_THAT(static_cast<uint64_t>(fileStatus.st_size), Eq(sut.getShmTopicSize()));
+}
+
 TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessMultipleProcessIsFound)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1cc7ad5d-5878-454a-94ba-5cf412c22682");
@@ -36,7 +36,8 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
-           && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
+           && (lhs.processKillDelay == rhs.processKillDelay)
+           && (lhs.runtimeMessageWorkers == rhs.runtimeMessageWorkers) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
            && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
 }
 } // namespace config
@@ -346,6 +347,65 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersLongOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebe310cd-8c87-47b2-8a56-2e360402406f");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessageWorkers, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersShortOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c2d1e43-0205-4221-8252-5b827aa8ab22");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "2";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessageWorkers, 2U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersOptionOutOfBoundsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6a40d36-0981-4f65-8d7d-27480389d91f");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "17"; // MAX_RUNTIME_MESSAGE_WORKERS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
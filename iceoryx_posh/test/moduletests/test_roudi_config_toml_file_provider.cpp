@@ -55,6 +55,184 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithHugePagesEnablesHugePagesOnlyForThisSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "faf3ec69-1cb7-48b6-a1c0-c0b1501d33f0");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_huge_pages.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 2U);
+    EXPECT_TRUE(result.value().m_sharedMemorySegments[0].m_useHugePages);
+    EXPECT_FALSE(result.value().m_sharedMemorySegments[1].m_useHugePages);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithPrefaultAndLockMemoryEnablesThemPerSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c789625-4c4e-48bd-ba67-a47b6cadd6de");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_prefault.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 2U);
+    EXPECT_TRUE(result.value().m_sharedMemorySegments[0].m_prefault);
+    EXPECT_TRUE(result.value().m_sharedMemorySegments[0].m_lockMemory);
+    EXPECT_TRUE(result.value().m_sharedMemorySegments[1].m_prefault);
+    EXPECT_FALSE(result.value().m_sharedMemorySegments[1].m_lockMemory);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithSegmentFilePlacesOnlyThisSegmentInAFile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e1d8b27-6a3f-4c95-b0d2-9f7a5e3c1b86");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_segment_file.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 2U);
+    const auto& file = result.value().m_sharedMemorySegments[0].m_file;
+    ASSERT_TRUE(file.has_value());
+    EXPECT_EQ(file->m_path, iox::mepoo::SegmentFile::Path_t("/dev/hugepages/iceoryx_segment"));
+    EXPECT_EQ(file->m_size, 4194304U);
+    EXPECT_TRUE(file->m_synchronousMapping);
+    EXPECT_FALSE(result.value().m_sharedMemorySegments[1].m_file.has_value());
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithMempoolReservationReservesOnlyThisMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5c83e2a-9d16-4f70-a2e4-18f6d0c7b9a3");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_mempool_reservation.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 1U);
+    const auto& mempools = result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_mempoolConfig;
+    ASSERT_EQ(mempools.size(), 2U);
+    EXPECT_EQ(mempools[0].m_reservation, iox::mepoo::NO_MEMPOOL_RESERVATION);
+    EXPECT_EQ(mempools[1].m_reservation, 1U);
+    EXPECT_EQ(mempools[1].m_chunkCount, 5U);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithLatencyIntrospectionEnablesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce349c61-111f-4195-a68f-aa3d6a9cd5aa");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_latency_introspection.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(result.value().m_latencyIntrospection);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithoutLatencyIntrospectionDisablesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "91e33a71-41cd-40bb-ae99-59e7ee549752");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_prefault.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().m_latencyIntrospection);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithMemfdManagementMemoryEnablesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c0e7b52-9a1d-4f36-b8e2-6d5a31c7f094");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_memfd_management_memory.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(result.value().m_memfdManagementMemory);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithoutMemfdManagementMemoryDisablesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e81f3d96-27c4-4a5b-9f0d-b3c6a4e17258");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_latency_introspection.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().m_memfdManagementMemory);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithBuddyPoolAndWithoutMempoolsSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e1d9f43-b7a2-4c58-85f0-d3c2a8e4b169");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_buddy_pool.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 1U);
+    const auto& mempoolConfig = result.value().m_sharedMemorySegments[0].m_mempoolConfig;
+    EXPECT_TRUE(mempoolConfig.m_mempoolConfig.empty());
+    ASSERT_TRUE(mempoolConfig.m_buddyMemPoolConfig.has_value());
+    EXPECT_EQ(mempoolConfig.m_buddyMemPoolConfig->m_size, 1048576U);
+    EXPECT_EQ(mempoolConfig.m_buddyMemPoolConfig->m_minChunkSize, 512U);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithOverflowSegmentsUsesDefaultThresholdWhenNotSpecified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d84f2a61-3c97-4e0b-a5d2-7b1e6f9c3a08");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_overflow_segments.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 3U);
+    EXPECT_EQ(segments[0].m_overflow.m_maxSegments, 3U);
+    EXPECT_EQ(segments[0].m_overflow.m_thresholdPercent, 90U);
+    EXPECT_EQ(segments[1].m_overflow.m_maxSegments, 1U);
+    EXPECT_EQ(segments[1].m_overflow.m_thresholdPercent, iox::mepoo::SegmentOverflow::DEFAULT_THRESHOLD_PERCENT);
+    EXPECT_EQ(segments[2].m_overflow.m_maxSegments, 0U);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseConfigWithChunkSizeRecordingEnablesTheRecordingOnlyForThisSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0e7c39-81d4-4f2a-9e63-c4a8d1f7b250");
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_chunk_size_recording.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 2U);
+    ASSERT_TRUE(segments[0].m_chunkSizeRecordingFile.has_value());
+    EXPECT_EQ(segments[0].m_chunkSizeRecordingFile.value(),
+              iox::mepoo::SegmentFile::Path_t("/tmp/iceoryx_chunk_size_recording"));
+    EXPECT_TRUE(segments[0].m_mempoolConfig.m_recordChunkSizes);
+    EXPECT_FALSE(segments[1].m_chunkSizeRecordingFile.has_value());
+    EXPECT_FALSE(segments[1].m_mempoolConfig.m_recordChunkSizes);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseAllMalformedInputConfigFiles,
     RoudiConfigTomlFileProvider_test,
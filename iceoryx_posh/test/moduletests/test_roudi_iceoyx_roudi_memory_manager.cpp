@@ -179,4 +179,32 @@ TEST_F(IceoryxRoudiMemoryManager_test, DestroyMemoryNotFailingAfterCalledTwoTime
     EXPECT_THAT(res.has_error(), Eq(false));
 }
 
+TEST_F(IceoryxRoudiMemoryManager_test, MgmtMemoryFileDescriptorIsNulloptWithNamedSharedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a9c4f1e-83d7-4b60-a5e2-f07d6c1b9834");
+    ASSERT_FALSE(m_roudiMemoryManagerTest->createAndAnnounceMemory().has_error());
+
+    EXPECT_FALSE(m_roudiMemoryManagerTest->mgmtMemoryFileDescriptor().has_value());
+}
+
+TEST_F(IceoryxRoudiMemoryManager_test, MgmtMemoryFileDescriptorIsAvailableWithMemfdManagementMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e3b51d0-c94a-4f28-b6d1-5a08e2f7c3b9");
+    if (!iox::platform::IOX_SUPPORT_MEMFD)
+    {
+        GTEST_SKIP() << "memfd is not supported on this platform";
+    }
+    // only one IceOryxRouDiMemoryManager can exist at a time since it holds the RouDi file lock
+    m_roudiMemoryManagerTest.reset();
+    auto config = iox::RouDiConfig_t().setDefaults();
+    config.m_memfdManagementMemory = true;
+    IceOryxRouDiMemoryManager sut(config);
+
+    EXPECT_FALSE(sut.mgmtMemoryFileDescriptor().has_value());
+    ASSERT_FALSE(sut.createAndAnnounceMemory().has_error());
+
+    EXPECT_TRUE(sut.mgmtMemoryFileDescriptor().has_value());
+    EXPECT_THAT(sut.mgmtMemoryProvider()->size(), Gt(0U));
+}
+
 } // namespace
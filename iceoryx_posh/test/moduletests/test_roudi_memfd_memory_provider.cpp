@@ -0,0 +1,133 @@
+// Copyright (c) 2026 by agent. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/memory/memfd_memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_platform/unistd.hpp"
+
+#include "mocks/roudi_memory_block_mock.hpp"
+
+#include "test.hpp"
+
+#include <cerrno>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+using iox::ShmName_t;
+static const ShmName_t TEST_MEMFD_NAME = ShmName_t("TheLegendOfMemfd");
+
+class MemfdMemoryProvider_Test : public Test
+{
+  public:
+    void SetUp() override
+    {
+#if !defined(__linux__)
+        GTEST_SKIP() << "memfd is only supported on Linux";
+#endif
+    }
+
+    void createMemory(MemfdMemoryProvider& sut)
+    {
+        ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock).has_error());
+        EXPECT_CALL(memoryBlock, size()).WillRepeatedly(Return(MEMORY_SIZE));
+        EXPECT_CALL(memoryBlock, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+        EXPECT_CALL(memoryBlock, destroy());
+
+        ASSERT_FALSE(sut.create().has_error());
+    }
+
+    static constexpr uint64_t MEMORY_SIZE{16U};
+    static constexpr uint64_t MEMORY_ALIGNMENT{8U};
+    MemoryBlockMock memoryBlock;
+};
+
+constexpr uint64_t MemfdMemoryProvider_Test::MEMORY_SIZE;
+constexpr uint64_t MemfdMemoryProvider_Test::MEMORY_ALIGNMENT;
+
+TEST_F(MemfdMemoryProvider_Test, CreateMemoryProvidesFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e558cfb7-e16e-41f7-aa08-437960a22d6d");
+    MemfdMemoryProvider sut(TEST_MEMFD_NAME);
+    EXPECT_FALSE(sut.getFileDescriptor().has_value());
+
+    createMemory(sut);
+
+    EXPECT_TRUE(sut.getFileDescriptor().has_value());
+}
+
+TEST_F(MemfdMemoryProvider_Test, MemoryIsSharedWithMappingsOfTheFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0781752-1bab-48f5-85c8-0aab067e4d8e");
+    MemfdMemoryProvider sut(TEST_MEMFD_NAME);
+    createMemory(sut);
+    ASSERT_TRUE(sut.baseAddress().has_value());
+
+    constexpr uint32_t DATA{0xC0FFEEU};
+    *static_cast<uint32_t*>(sut.baseAddress().value()) = DATA;
+
+    auto memoryMap = iox::posix::MemoryMapBuilder()
+                         .length(MEMORY_SIZE)
+                         .fileDescriptor(sut.getFileDescriptor().value())
+                         .accessMode(iox::posix::AccessMode::READ_ONLY)
+                         .flags(iox::posix::MemoryMapFlags::SHARE_CHANGES)
+                         .create();
+    ASSERT_FALSE(memoryMap.has_error());
+    EXPECT_THAT(*static_cast<const uint32_t*>(memoryMap->getBaseAddress()), Eq(DATA));
+}
+
+TEST_F(MemfdMemoryProvider_Test, SizeOfMemoryFileCannotBeChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba1e1ea2-1835-4592-ba1f-d490d8f7fce6");
+    MemfdMemoryProvider sut(TEST_MEMFD_NAME);
+    createMemory(sut);
+    ASSERT_TRUE(sut.getFileDescriptor().has_value());
+
+    EXPECT_THAT(ftruncate(sut.getFileDescriptor().value(), 0), Eq(-1));
+    EXPECT_THAT(errno, Eq(EPERM));
+}
+
+TEST_F(MemfdMemoryProvider_Test, DestroyMemoryReleasesFileDescriptor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1034ffa-2182-4d44-80e5-131012def172");
+    MemfdMemoryProvider sut(TEST_MEMFD_NAME);
+    createMemory(sut);
+
+    ASSERT_FALSE(sut.destroy().has_error());
+
+    EXPECT_FALSE(sut.getFileDescriptor().has_value());
+}
+
+TEST_F(MemfdMemoryProvider_Test, CreationFailedWithAlignmentExceedingPageSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "242e4cd9-8144-4851-8b7b-02ab0ee18d4c");
+    MemfdMemoryProvider sut(TEST_MEMFD_NAME);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock).has_error());
+    EXPECT_CALL(memoryBlock, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock, alignment()).WillRepeatedly(Return(iox::posix::pageSize() + 8U));
+
+    auto expectFailed = sut.create();
+    ASSERT_THAT(expectFailed.has_error(), Eq(true));
+    EXPECT_THAT(expectFailed.get_error(), Eq(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE));
+    EXPECT_FALSE(sut.getFileDescriptor().has_value());
+}
+
+} // namespace
@@ -79,6 +79,11 @@ class SegmentMock
 class SegmentManagerMock
 {
   public:
+    uint64_t getNumberOfSegments() const noexcept
+    {
+        return m_segmentContainer.size();
+    }
+
     iox::cxx::vector<SegmentMock, iox::MAX_SHM_SEGMENTS> m_segmentContainer;
 };
 
@@ -0,0 +1,259 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/roudi/mempool_sizing_advisor.hpp"
+#include "test.hpp"
+
+#include <sstream>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class MemPoolSizingAdvisor_test : public Test
+{
+  public:
+    static constexpr uint32_t CHUNK_HEADER_SIZE{static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader))};
+    static constexpr uint32_t SMALL_CHUNK_SIZE{CHUNK_HEADER_SIZE + 60U};
+    static constexpr uint32_t MEDIUM_CHUNK_SIZE{CHUNK_HEADER_SIZE + 64U};
+    static constexpr uint32_t LARGE_CHUNK_SIZE{CHUNK_HEADER_SIZE + 960U};
+    static constexpr uint64_t REQUESTS_PER_BUCKET{10U};
+
+    /// @brief three buckets which were served by a single mempool whose peak usage was the number of requests
+    ChunkSizeStatistics createStatistics() const
+    {
+        ChunkSizeStatistics statistics;
+        statistics.m_buckets.push_back({SMALL_CHUNK_SIZE, REQUESTS_PER_BUCKET});
+        statistics.m_buckets.push_back({MEDIUM_CHUNK_SIZE, REQUESTS_PER_BUCKET});
+        statistics.m_buckets.push_back({LARGE_CHUNK_SIZE, REQUESTS_PER_BUCKET});
+        ChunkSizeStatistics::MemPool memPool;
+        memPool.m_chunkSize = CHUNK_HEADER_SIZE + 1024U;
+        memPool.m_chunkCount = 100U;
+        memPool.m_peakUsedChunks = 3U * REQUESTS_PER_BUCKET;
+        memPool.m_requests = 3U * REQUESTS_PER_BUCKET;
+        statistics.m_memPools.push_back(memPool);
+        return statistics;
+    }
+
+    static uint32_t payloadSizeOf(const uint32_t chunkSize)
+    {
+        return iox::cxx::align(chunkSize - CHUNK_HEADER_SIZE, 8U);
+    }
+};
+
+TEST_F(MemPoolSizingAdvisor_test, StatisticsWhichAreWrittenCanBeReadBack)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f3c1e08-a9d2-4b65-8e47-1d6b0c9f2a53");
+    auto statistics = createStatistics();
+    statistics.m_memPools[0].m_wastedBytes = 1234U;
+    statistics.m_memPools[0].m_failedRequests = 5U;
+    statistics.m_requestsWithoutMemPool = 7U;
+
+    std::stringstream stream;
+    statistics.writeTo(stream);
+    auto result = ChunkSizeStatistics::readFrom(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& readStatistics = result.value();
+    EXPECT_THAT(readStatistics.m_requestsWithoutMemPool, Eq(7U));
+    ASSERT_THAT(readStatistics.m_buckets.size(), Eq(3U));
+    EXPECT_THAT(readStatistics.m_buckets[1].m_maxChunkSize, Eq(MEDIUM_CHUNK_SIZE));
+    EXPECT_THAT(readStatistics.m_buckets[1].m_count, Eq(REQUESTS_PER_BUCKET));
+    ASSERT_THAT(readStatistics.m_memPools.size(), Eq(1U));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_chunkSize, Eq(statistics.m_memPools[0].m_chunkSize));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_chunkCount, Eq(100U));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_peakUsedChunks, Eq(3U * REQUESTS_PER_BUCKET));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_requests, Eq(3U * REQUESTS_PER_BUCKET));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_wastedBytes, Eq(1234U));
+    EXPECT_THAT(readStatistics.m_memPools[0].m_failedRequests, Eq(5U));
+    EXPECT_THAT(readStatistics.getNumberOfRequests(), Eq(3U * REQUESTS_PER_BUCKET));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, ReadingMalformedStatisticsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2e96a41-5d07-4c8f-a3b1-6f0e8d2c7954");
+    for (const auto& content : {"", "something 1\n", "iceoryx-chunk-size-recording 1\nbucket 100\n",
+                                "iceoryx-chunk-size-recording 1\nbucket 200 1\nbucket 100 1\n",
+                                "iceoryx-chunk-size-recording 1\nunknown 1\n"})
+    {
+        std::stringstream stream(content);
+        auto result = ChunkSizeStatistics::readFrom(stream);
+        ASSERT_TRUE(result.has_error()) << content;
+        EXPECT_THAT(result.get_error(), Eq(ChunkSizeStatistics::Error::INVALID_FORMAT)) << content;
+    }
+}
+
+TEST_F(MemPoolSizingAdvisor_test, ReadingStatisticsWithAnotherVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d1a8f73-e06c-4925-bc38-a7f5e2d19b06");
+    std::stringstream stream("iceoryx-chunk-size-recording 2\n");
+
+    auto result = ChunkSizeStatistics::readFrom(stream);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkSizeStatistics::Error::UNSUPPORTED_VERSION));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, AdviseGroupsTheChunkSizesWithTheLeastMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e85b0d36-71fa-4c2e-9a64-3c8d1f7e0b29");
+    MemPoolSizingAdvisor::Options options;
+    options.m_maxNumberOfMemPools = 2U;
+    options.m_headroomPercent = 0U;
+
+    const auto advice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+
+    const auto& mempools = advice.m_mePooConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(2U));
+    EXPECT_THAT(mempools[0].m_size, Eq(payloadSizeOf(MEDIUM_CHUNK_SIZE)));
+    EXPECT_THAT(mempools[0].m_chunkCount, Eq(2U * REQUESTS_PER_BUCKET));
+    EXPECT_THAT(mempools[1].m_size, Eq(payloadSizeOf(LARGE_CHUNK_SIZE)));
+    EXPECT_THAT(mempools[1].m_chunkCount, Eq(REQUESTS_PER_BUCKET));
+    EXPECT_THAT(advice.m_requiredMemorySize,
+                Eq(iox::mepoo::MemoryManager::requiredFullMemorySize(advice.m_mePooConfig)));
+    EXPECT_TRUE(advice.m_fitsIntoBudget);
+}
+
+TEST_F(MemPoolSizingAdvisor_test, AdviseWithASingleMemPoolUsesTheLargestChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a6f9c27-d4b1-4e83-87c5-b1e2a0d6f348");
+    MemPoolSizingAdvisor::Options options;
+    options.m_maxNumberOfMemPools = 1U;
+    options.m_headroomPercent = 0U;
+
+    const auto advice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+
+    const auto& mempools = advice.m_mePooConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(1U));
+    EXPECT_THAT(mempools[0].m_size, Eq(payloadSizeOf(LARGE_CHUNK_SIZE)));
+    EXPECT_THAT(mempools[0].m_chunkCount, Eq(3U * REQUESTS_PER_BUCKET));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, AdviseAddsTheHeadroomAndTheFailedRequestsToThePeakUsage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c39d7e52-8b0a-4f16-a2d4-5e7f1c3b9a60");
+    auto statistics = createStatistics();
+    // half of the requests failed, the mempool would have required twice the chunks
+    statistics.m_memPools[0].m_failedRequests = 3U * REQUESTS_PER_BUCKET / 2U;
+    MemPoolSizingAdvisor::Options options;
+    options.m_maxNumberOfMemPools = 1U;
+    options.m_headroomPercent = 50U;
+
+    const auto advice = MemPoolSizingAdvisor::advise(statistics, options);
+
+    ASSERT_THAT(advice.m_mePooConfig.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(advice.m_mePooConfig.m_mempoolConfig[0].m_chunkCount, Eq(3U * 3U * REQUESTS_PER_BUCKET));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, AdviseScalesTheChunkCountsDownToTheMemoryBudget)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e0b4a96-f72c-4d38-b1e9-0c6a8d3f2e17");
+    MemPoolSizingAdvisor::Options options;
+    options.m_maxNumberOfMemPools = 2U;
+    const auto unlimitedAdvice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+    options.m_memoryBudget = unlimitedAdvice.m_requiredMemorySize / 2U;
+
+    const auto advice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+
+    EXPECT_TRUE(advice.m_fitsIntoBudget);
+    EXPECT_THAT(advice.m_requiredMemorySize, Le(options.m_memoryBudget));
+    ASSERT_THAT(advice.m_mePooConfig.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(advice.m_mePooConfig.m_mempoolConfig[0].m_chunkCount,
+                Lt(unlimitedAdvice.m_mePooConfig.m_mempoolConfig[0].m_chunkCount));
+    EXPECT_THAT(advice.m_mePooConfig.m_mempoolConfig[1].m_chunkCount,
+                Lt(unlimitedAdvice.m_mePooConfig.m_mempoolConfig[1].m_chunkCount));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, AdviseReportsABudgetWhichIsTooSmallForASingleChunkPerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7d2f815-3c6e-4b90-8e5a-9f1b4c0d7e38");
+    MemPoolSizingAdvisor::Options options;
+    options.m_memoryBudget = 1U;
+
+    const auto advice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+
+    EXPECT_FALSE(advice.m_fitsIntoBudget);
+    for (const auto& entry : advice.m_mePooConfig.m_mempoolConfig)
+    {
+        EXPECT_THAT(entry.m_chunkCount, Eq(1U));
+    }
+}
+
+TEST_F(MemPoolSizingAdvisor_test, WriteTomlWritesASegmentWithTheAdvisedMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b8e3c60-9a4d-4f27-b6d5-e2c7a0f9d814");
+    MemPoolSizingAdvisor::Options options;
+    options.m_maxNumberOfMemPools = 2U;
+    options.m_headroomPercent = 0U;
+    const auto advice = MemPoolSizingAdvisor::advise(createStatistics(), options);
+
+    std::stringstream stream;
+    MemPoolSizingAdvisor::writeToml(advice, stream);
+
+    const auto toml = stream.str();
+    EXPECT_THAT(toml, HasSubstr("[general]\nversion = 1\n"));
+    EXPECT_THAT(toml, HasSubstr("[[segment]]\n"));
+    EXPECT_THAT(toml,
+                HasSubstr("[[segment.mempool]]\nsize = " + std::to_string(payloadSizeOf(MEDIUM_CHUNK_SIZE))
+                          + "\ncount = " + std::to_string(2U * REQUESTS_PER_BUCKET) + "\n"));
+    EXPECT_THAT(toml,
+                HasSubstr("[[segment.mempool]]\nsize = " + std::to_string(payloadSizeOf(LARGE_CHUNK_SIZE))
+                          + "\ncount = " + std::to_string(REQUESTS_PER_BUCKET) + "\n"));
+}
+
+TEST_F(MemPoolSizingAdvisor_test, StatisticsFromMemoryManagerContainTheRecordingAndThePeakUsage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d60f2b84-7e1c-4a93-95b8-3a0e6c2d1f75");
+    constexpr uint64_t MEMORY_SIZE{100000U};
+    std::vector<uint8_t> memory(MEMORY_SIZE);
+    iox::posix::Allocator allocator(memory.data(), MEMORY_SIZE);
+    iox::mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({64U, 10U});
+    mempoolConfig.addMemPool({128U, 10U, 1U});
+    mempoolConfig.m_recordChunkSizes = true;
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    const auto chunkSettings =
+        iox::mepoo::ChunkSettings::create(32U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    {
+        auto chunk1 = memoryManager.getChunk(chunkSettings);
+        auto chunk2 = memoryManager.getChunk(chunkSettings);
+        auto reservedChunk = memoryManager.getChunk(chunkSettings, 1U);
+        ASSERT_FALSE(chunk1.has_error() || chunk2.has_error() || reservedChunk.has_error());
+    }
+    auto chunk3 = memoryManager.getChunk(chunkSettings);
+    ASSERT_FALSE(chunk3.has_error());
+
+    const auto statistics = ChunkSizeStatistics::fromMemoryManager(memoryManager);
+
+    ASSERT_THAT(statistics.m_buckets.size(), Eq(1U));
+    EXPECT_THAT(statistics.m_buckets[0].m_maxChunkSize, Eq(chunkSettings.requiredChunkSize()));
+    EXPECT_THAT(statistics.m_buckets[0].m_count, Eq(3U));
+    ASSERT_THAT(statistics.m_memPools.size(), Eq(1U));
+    EXPECT_THAT(statistics.m_memPools[0].m_chunkSize, Eq(64U + CHUNK_HEADER_SIZE));
+    EXPECT_THAT(statistics.m_memPools[0].m_chunkCount, Eq(10U));
+    EXPECT_THAT(statistics.m_memPools[0].m_peakUsedChunks, Eq(2U));
+    EXPECT_THAT(statistics.m_memPools[0].m_requests, Eq(3U));
+    EXPECT_THAT(statistics.m_memPools[0].m_wastedBytes, Eq(3U * 32U));
+}
+
+} // namespace
@@ -35,6 +35,8 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPortsData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberLatencyData;
 
     void sendThroughputData()
     {
@@ -48,6 +50,14 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::cxx::optional<PublisherPort>& getPublisherPortSubscriberPortsData()
+    {
+        return this->m_publisherPortSubscriberPortsData;
+    }
+    iox::cxx::optional<PublisherPort>& getPublisherPortSubscriberLatencies()
+    {
+        return this->m_publisherPortSubscriberLatencies;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -161,6 +171,15 @@ TEST_F(PortIntrospection_test, registerPublisherPort)
                 Eq(false));
 }
 
+TEST_F(PortIntrospection_test, registerLatencyPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89fc72b0-5073-434f-9576-b9f780a44d6c");
+    EXPECT_THAT(m_introspectionAccess.registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection)),
+                Eq(true));
+    EXPECT_THAT(m_introspectionAccess.registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection2)),
+                Eq(false));
+}
+
 
 TEST_F(PortIntrospection_test, sendPortData_EmptyList)
 {
@@ -448,6 +467,55 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, SubscriberLatencyDataIsNotSentWithoutLatencyPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1708125b-2965-44a9-bf79-ea83315ebe59");
+    ASSERT_FALSE(m_introspectionAccess.getPublisherPortSubscriberLatencies().has_value());
+
+    m_introspectionAccess.sendSubscriberLatencyData();
+
+    EXPECT_FALSE(m_introspectionAccess.getPublisherPortSubscriberLatencies().has_value());
+}
+
+TEST_F(PortIntrospection_test, SubscriberLatencyDataContainsTheLatencyHistograms)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "060b755b-21bc-42f6-8080-07628be93c0b");
+    using Topic = iox::roudi::SubscriberLatencyIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::capro::ServiceDescription service("Radar", "FrontLeft", "Objects");
+    iox::popo::SubscriberPortData portData{service,
+                                           iox::RuntimeName_t("subscriber"),
+                                           iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                           iox::popo::SubscriberOptions()};
+    iox::popo::UniquePortId originId;
+    constexpr uint64_t LATENCY_NS{1000U};
+    portData.m_chunkReceiverData.m_latencyHistograms.record(originId, LATENCY_NS);
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(portData), Eq(true));
+
+    ASSERT_TRUE(m_introspectionAccess.registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection2)));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberLatencies().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortSubscriberLatencies().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendSubscriberLatencyData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->subscriberLatencyList.size(), Eq(1U));
+    const auto& latencyData = chunk->sample()->subscriberLatencyList[0];
+    ASSERT_THAT(latencyData.latencyHistograms.size(), Eq(1U));
+    EXPECT_THAT(latencyData.latencyHistograms[0].publisherPortID, Eq(static_cast<uint64_t>(originId)));
+    EXPECT_THAT(latencyData.latencyHistograms[0].bucketCounts[iox::popo::LatencyHistograms::bucketIndex(LATENCY_NS)],
+                Eq(1U));
+    EXPECT_THAT(latencyData.numberOfHistogramReassignments, Eq(0U));
+
+    chunk->sample()->~SubscriberLatencyIntrospectionFieldTopic();
+}
 
 TEST_F(PortIntrospection_test, Thread)
 {
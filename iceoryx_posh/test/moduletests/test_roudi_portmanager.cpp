@@ -18,6 +18,9 @@
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "test_roudi_portmanager_fixture.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace iox_test_roudi_portmanager
 {
 PublisherOptions createTestPubOptions()
@@ -582,6 +585,66 @@ TEST_F(PortManager_test, SubscriberNotRequiringHistorySupportDoesConnectToPublis
     EXPECT_TRUE(publisher.hasSubscribers());
 }
 
+TEST_F(PortManager_test, SubscriberConnectedToPublisherWithInlineDeliveryGetsInlineSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0c7e41-2f6d-4d8a-9a3e-0c6f2d1b7e94");
+
+    auto publisherOptions = createTestPubOptions();
+    publisherOptions.inlineDelivery = true;
+
+    auto publisher = createPublisher(publisherOptions);
+    auto subscriberData = m_portManager
+                              ->acquireSubscriberPortData(
+                                  {"1", "1", "1"}, createTestSubOptions(), "schlomo", PortConfigInfo())
+                              .value();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_TRUE(SubscriberPortType(subscriberData).hasInlineSlots());
+}
+
+TEST_F(PortManager_test, SubscriberConnectedToPublisherWithoutInlineDeliveryGetsNoInlineSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3e8a9d2-61b4-4f07-8e15-93a7d4f0b268");
+
+    auto publisher = createPublisher(createTestPubOptions());
+    auto subscriberData = m_portManager
+                              ->acquireSubscriberPortData(
+                                  {"1", "1", "1"}, createTestSubOptions(), "schlomo", PortConfigInfo())
+                              .value();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_FALSE(SubscriberPortType(subscriberData).hasInlineSlots());
+}
+
+TEST_F(PortManager_test, InlineSlotsOfDestroyedSubscriberAreReusedWhenThePoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f4d2b6a-0e93-4c71-b5a8-2d7e1c9f3a40");
+
+    auto publisherOptions = createTestPubOptions();
+    publisherOptions.inlineDelivery = true;
+    auto publisher = createPublisher(publisherOptions);
+
+    const iox::RuntimeName_t firstRuntimeName{"schlomo"};
+    auto acquireSubscriber = [&](const iox::RuntimeName_t& runtimeName) {
+        return m_portManager
+            ->acquireSubscriberPortData({"1", "1", "1"}, createTestSubOptions(), runtimeName, PortConfigInfo())
+            .value();
+    };
+
+    auto firstSubscriberData = acquireSubscriber(firstRuntimeName);
+    EXPECT_TRUE(SubscriberPortType(firstSubscriberData).hasInlineSlots());
+    for (uint32_t i = 1U; i < iox::MAX_SUBSCRIBERS_WITH_INLINE_SLOTS; ++i)
+    {
+        EXPECT_TRUE(SubscriberPortType(acquireSubscriber("guiseppe")).hasInlineSlots());
+    }
+
+    EXPECT_FALSE(SubscriberPortType(acquireSubscriber("guiseppe")).hasInlineSlots());
+
+    m_portManager->deletePortsOfProcess(firstRuntimeName);
+
+    EXPECT_TRUE(SubscriberPortType(acquireSubscriber("guiseppe")).hasInlineSlots());
+}
+
 TEST_F(PortManager_test, DeleteInterfacePortfromMaximumNumberAndAddOneIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2e682da4-aea0-4c37-8895-4049506db936");
@@ -1000,4 +1063,70 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, PortsOfDifferentRuntimesCanBeAcquiredConcurrentlyToTheDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7f34690-a0ff-40b9-8145-80ce2e0fc66d");
+    constexpr uint64_t NUMBER_OF_RUNTIMES{4U};
+    constexpr uint64_t PORTS_PER_RUNTIME{8U};
+
+    // every runtime offers its own services and subscribes to the services of the next runtime
+    auto service = [](const uint64_t runtimeIndex, const uint64_t port) -> ServiceDescription {
+        return {"Concurrent",
+                iox::capro::IdString_t(TruncateToCapacity, convert::toString(runtimeIndex % NUMBER_OF_RUNTIMES)),
+                iox::capro::IdString_t(TruncateToCapacity, convert::toString(port))};
+    };
+
+    std::vector<iox::popo::PublisherPortData*> publishers(NUMBER_OF_RUNTIMES * PORTS_PER_RUNTIME, nullptr);
+    std::vector<iox::popo::SubscriberPortData*> subscribers(NUMBER_OF_RUNTIMES * PORTS_PER_RUNTIME, nullptr);
+
+    Barrier startBarrier(NUMBER_OF_RUNTIMES + 1U);
+    std::atomic<uint64_t> finishedRuntimes{0U};
+    std::vector<std::thread> runtimeThreads;
+    for (uint64_t runtimeIndex = 0U; runtimeIndex < NUMBER_OF_RUNTIMES; ++runtimeIndex)
+    {
+        runtimeThreads.emplace_back([&, runtimeIndex] {
+            const iox::RuntimeName_t runtimeName(TruncateToCapacity, "runtime" + convert::toString(runtimeIndex));
+            startBarrier.notify();
+            startBarrier.wait();
+            for (uint64_t port = 0U; port < PORTS_PER_RUNTIME; ++port)
+            {
+                const auto index = runtimeIndex * PORTS_PER_RUNTIME + port;
+                m_portManager
+                    ->acquirePublisherPortData(service(runtimeIndex, port),
+                                               createTestPubOptions(),
+                                               runtimeName,
+                                               m_payloadDataSegmentMemoryManager,
+                                               PortConfigInfo())
+                    .and_then([&](auto publisherPortData) { publishers[index] = publisherPortData; });
+                m_portManager
+                    ->acquireSubscriberPortData(
+                        service(runtimeIndex + 1U, port), createTestSubOptions(), runtimeName, PortConfigInfo())
+                    .and_then([&](auto subscriberPortData) { subscribers[index] = subscriberPortData; });
+            }
+            ++finishedRuntimes;
+        });
+    }
+
+    startBarrier.notify();
+    startBarrier.wait();
+    while (finishedRuntimes < NUMBER_OF_RUNTIMES)
+    {
+        m_portManager->doDiscovery();
+    }
+    for (auto& runtimeThread : runtimeThreads)
+    {
+        runtimeThread.join();
+    }
+    m_portManager->doDiscovery();
+
+    for (uint64_t index = 0U; index < NUMBER_OF_RUNTIMES * PORTS_PER_RUNTIME; ++index)
+    {
+        ASSERT_THAT(publishers[index], Ne(nullptr));
+        ASSERT_THAT(subscribers[index], Ne(nullptr));
+        EXPECT_TRUE(PublisherPortUser(publishers[index]).hasSubscribers());
+        EXPECT_THAT(SubscriberPortUser(subscribers[index]).getSubscriptionState(),
+                    Eq(iox::SubscribeState::SUBSCRIBED));
+    }
+}
+
 } // namespace iox_test_roudi_portmanager
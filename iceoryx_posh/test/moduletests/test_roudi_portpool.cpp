@@ -326,6 +326,28 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, AddPublisherPortAfterRemovingOneReusesTheFreedPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a7746bd-c60b-4082-8c46-c1ff1b5ac4a2");
+    auto firstPublisherPort = sut.addPublisherPort(
+        {"service1", "instance1", "event1"}, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto secondPublisherPort = sut.addPublisherPort(
+        {"service2", "instance2", "event2"}, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto thirdPublisherPort = sut.addPublisherPort(
+        {"service3", "instance3", "event3"}, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(firstPublisherPort.has_error());
+    ASSERT_FALSE(secondPublisherPort.has_error());
+    ASSERT_FALSE(thirdPublisherPort.has_error());
+
+    sut.removePublisherPort(secondPublisherPort.value());
+    auto newPublisherPort = sut.addPublisherPort(
+        {"service4", "instance4", "event4"}, &m_memoryManager, m_applicationName, m_publisherOptions);
+
+    ASSERT_FALSE(newPublisherPort.has_error());
+    EXPECT_EQ(newPublisherPort.value(), secondPublisherPort.value());
+    EXPECT_EQ(sut.getPublisherPortDataList().size(), 3U);
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -846,4 +868,128 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+// BEGIN resources of runtime tests
+
+TEST_F(PortPool_test, GetPublisherPortDataListOfRuntimeContainsOnlyPortsOfThisRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2eac0b6c-0306-407b-8b76-653cf88d5187");
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPortOfOtherRuntime =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPortOfOtherRuntime.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_applicationName);
+
+    ASSERT_EQ(publisherPortDataList.size(), 2U);
+    EXPECT_EQ(publisherPortDataList[0], publisherPort1.value());
+    EXPECT_EQ(publisherPortDataList[1], publisherPort2.value());
+}
+
+TEST_F(PortPool_test, GetSubscriberPortDataListOfRuntimeWithoutPortsIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "771e2809-7dd2-4cc4-bdc4-51ff7e7bdfa0");
+    ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions).has_error());
+
+    EXPECT_EQ(sut.getSubscriberPortDataList(m_applicationName).size(), 0U);
+    EXPECT_EQ(sut.getSubscriberPortDataList(m_runtimeName).size(), 1U);
+}
+
+TEST_F(PortPool_test, RemovedResourcesAreNotProvidedForTheirRuntime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed499a60-4c79-467c-8a66-ef834314bcdf");
+    auto nodeData1 = sut.addNodeData(m_applicationName, m_nodeName, m_nodeDeviceId);
+    auto nodeData2 = sut.addNodeData(m_applicationName, m_nodeName, m_nodeDeviceId);
+    auto conditionVariableData = sut.addConditionVariableData(m_applicationName);
+    ASSERT_FALSE(nodeData1.has_error());
+    ASSERT_FALSE(nodeData2.has_error());
+    ASSERT_FALSE(conditionVariableData.has_error());
+
+    sut.removeNodeData(nodeData1.value());
+    sut.removeConditionVariableData(conditionVariableData.value());
+
+    auto nodeDataList = sut.getNodeDataList(m_applicationName);
+    ASSERT_EQ(nodeDataList.size(), 1U);
+    EXPECT_EQ(nodeDataList[0], nodeData2.value());
+    EXPECT_EQ(sut.getConditionVariableDataList(m_applicationName).size(), 0U);
+}
+
+TEST_F(PortPool_test, ReusedPositionIsProvidedForTheRuntimeOfTheNewResource)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59b1a22f-0471-41cd-b3b0-99bdf7cb0379");
+    auto interfacePort = sut.addInterfacePort(m_applicationName, Interfaces::INTERNAL);
+    ASSERT_FALSE(interfacePort.has_error());
+    sut.removeInterfacePort(interfacePort.value());
+
+    auto reusedInterfacePort = sut.addInterfacePort(m_runtimeName, Interfaces::INTERNAL);
+    ASSERT_FALSE(reusedInterfacePort.has_error());
+
+    EXPECT_EQ(sut.getInterfacePortDataList(m_applicationName).size(), 0U);
+    auto interfacePortDataList = sut.getInterfacePortDataList(m_runtimeName);
+    ASSERT_EQ(interfacePortDataList.size(), 1U);
+    EXPECT_EQ(interfacePortDataList[0], reusedInterfacePort.value());
+}
+
+// END resources of runtime tests
+
+// BEGIN ports of service tests
+
+TEST_F(PortPool_test, GetPortDataListsOfServiceContainOnlyPortsOfThisService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0dece8c4-c5e6-4e87-924c-877676c7efa3");
+    ServiceDescription otherServiceDescription{"service2", "instance1", "event1"};
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(
+        sut.addPublisherPort(otherServiceDescription, &m_memoryManager, m_applicationName, m_publisherOptions)
+            .has_error());
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions);
+    auto clientPort = sut.addClientPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_clientOptions);
+    auto serverPort =
+        sut.addServerPort(otherServiceDescription, &m_memoryManager, m_applicationName, m_serverOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+    ASSERT_FALSE(subscriberPort.has_error());
+    ASSERT_FALSE(clientPort.has_error());
+    ASSERT_FALSE(serverPort.has_error());
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+    ASSERT_EQ(publisherPortDataList.size(), 1U);
+    EXPECT_EQ(publisherPortDataList[0], publisherPort.value());
+
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_serviceDescription);
+    ASSERT_EQ(subscriberPortDataList.size(), 1U);
+    EXPECT_EQ(subscriberPortDataList[0], subscriberPort.value());
+
+    auto clientPortDataList = sut.getClientPortDataList(m_serviceDescription);
+    ASSERT_EQ(clientPortDataList.size(), 1U);
+    EXPECT_EQ(clientPortDataList[0], clientPort.value());
+
+    EXPECT_EQ(sut.getServerPortDataList(m_serviceDescription).size(), 0U);
+    auto serverPortDataList = sut.getServerPortDataList(otherServiceDescription);
+    ASSERT_EQ(serverPortDataList.size(), 1U);
+    EXPECT_EQ(serverPortDataList[0], serverPort.value());
+}
+
+TEST_F(PortPool_test, RemovedPortsAreNotProvidedForTheirService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f680602-8b07-40ae-a6bb-dcee68dcc2b2");
+    auto subscriberPort1 = sut.addSubscriberPort(m_serviceDescription, m_runtimeName, m_subscriberOptions);
+    auto subscriberPort2 = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort1.has_error());
+    ASSERT_FALSE(subscriberPort2.has_error());
+
+    sut.removeSubscriberPort(subscriberPort1.value());
+
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_serviceDescription);
+    ASSERT_EQ(subscriberPortDataList.size(), 1U);
+    EXPECT_EQ(subscriberPortDataList[0], subscriberPort2.value());
+    EXPECT_EQ(sut.getSubscriberPortDataList(m_runtimeName).size(), 0U);
+}
+
+// END ports of service tests
+
 } // namespace
@@ -119,4 +119,13 @@ TEST_F(Process_test, TimeStamp)
     EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
 }
 
+TEST_F(Process_test, NumberOfMappedSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e11c7e3-4886-499b-b64c-9a8b21079625");
+    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    EXPECT_THAT(roudiproc.getNumberOfMappedSegments(), Eq(0U));
+    roudiproc.setNumberOfMappedSegments(3U);
+    EXPECT_THAT(roudiproc.getNumberOfMappedSegments(), Eq(3U));
+}
+
 } // namespace
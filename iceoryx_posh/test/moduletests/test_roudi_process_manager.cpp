@@ -41,7 +41,14 @@ class ProcessManager_test : public Test
   public:
     void SetUp() override
     {
-        auto config = iox::RouDiConfig_t().setDefaults();
+        createSut(iox::RouDiConfig_t().setDefaults());
+    }
+
+    void createSut(const iox::RouDiConfig_t& config)
+    {
+        m_sut.reset();
+        m_portManager.reset();
+        m_roudiMemoryManager.reset();
         m_roudiMemoryManager = std::make_unique<IceOryxRouDiMemoryManager>(config);
         EXPECT_FALSE(m_roudiMemoryManager->createAndAnnounceMemory().has_error());
         m_portManager = std::make_unique<PortManager>(m_roudiMemoryManager.get());
@@ -157,4 +164,30 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, OverflowSegmentIsLinkedWhenAllProcessesMappedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e42491e3-569f-49ad-985c-ef8e785bac43");
+    auto config = iox::RouDiConfig_t().setDefaults();
+    config.m_sharedMemorySegments.front().m_overflow.m_maxSegments = 1U;
+    config.m_sharedMemorySegments.front().m_overflow.m_thresholdPercent = 0U;
+    createSut(config);
+
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    auto segmentManager = m_roudiMemoryManager->segmentManager().value();
+    auto& memoryManager = segmentManager->getSegmentInformationWithWriteAccessForUser(m_user)
+                              .m_memoryManager.value()
+                              .get();
+
+    segmentManager->createOverflowSegmentsOnDemand();
+    ASSERT_THAT(segmentManager->getNumberOfSegments(), Eq(2U));
+
+    m_sut->linkOverflowSegmentsMappedByAllProcesses();
+    EXPECT_THAT(memoryManager.getOverflowMemoryManager(), Eq(nullptr));
+
+    m_sut->updateMappedSegmentsOfProcess(m_processname, 2U);
+    m_sut->linkOverflowSegmentsMappedByAllProcesses();
+    EXPECT_THAT(memoryManager.getOverflowMemoryManager(), Ne(nullptr));
+}
+
 } // namespace
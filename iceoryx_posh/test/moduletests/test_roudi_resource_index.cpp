@@ -0,0 +1,162 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/resource_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+class ResourceIndex_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{10U};
+    static constexpr uint64_t NUMBER_OF_LISTS{4U};
+
+    std::vector<uint64_t> candidatesOf(const uint64_t keyHash) const
+    {
+        std::vector<uint64_t> candidates;
+        sut.forEachCandidate(keyHash, [&](const uint64_t position) { candidates.push_back(position); });
+        return candidates;
+    }
+
+    ResourceIndex<CAPACITY, NUMBER_OF_LISTS> sut;
+};
+
+constexpr uint64_t ResourceIndex_test::CAPACITY;
+constexpr uint64_t ResourceIndex_test::NUMBER_OF_LISTS;
+
+TEST_F(ResourceIndex_test, EmptyIndexHasNoCandidates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "797a8c3c-02c1-43e5-ab1e-ffb6f3830ff1");
+    for (uint64_t hash = 0U; hash < NUMBER_OF_LISTS; ++hash)
+    {
+        EXPECT_TRUE(candidatesOf(hash).empty());
+    }
+}
+
+TEST_F(ResourceIndex_test, InsertedPositionsAreCandidatesOfTheirKeyInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b499046-a4b6-42bc-b444-a9306b8caae2");
+    sut.insert(1U, 7U);
+    sut.insert(1U, 2U);
+    sut.insert(1U, 5U);
+
+    auto candidates = candidatesOf(1U);
+
+    ASSERT_THAT(candidates.size(), Eq(3U));
+    EXPECT_THAT(candidates[0], Eq(2U));
+    EXPECT_THAT(candidates[1], Eq(5U));
+    EXPECT_THAT(candidates[2], Eq(7U));
+}
+
+TEST_F(ResourceIndex_test, CandidatesStayInAscendingOrderAfterErasing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da461e4e-5423-480b-ab3f-a8673ea273a3");
+    sut.insert(1U, 2U);
+    sut.insert(1U, 5U);
+    sut.insert(1U, 7U);
+    sut.erase(5U);
+
+    sut.insert(1U, 6U);
+    sut.insert(1U, 1U);
+    sut.insert(1U, 9U);
+
+    EXPECT_THAT(candidatesOf(1U), ElementsAre(1U, 2U, 6U, 7U, 9U));
+}
+
+TEST_F(ResourceIndex_test, PositionsOfOtherKeysAreNotCandidates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12ace830-a47c-4955-9f59-2c69d19d2ec9");
+    sut.insert(1U, 3U);
+    sut.insert(2U, 4U);
+
+    auto candidates = candidatesOf(2U);
+
+    ASSERT_THAT(candidates.size(), Eq(1U));
+    EXPECT_THAT(candidates[0], Eq(4U));
+}
+
+TEST_F(ResourceIndex_test, KeysWithTheSameListShareTheirCandidates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "09b9f16e-eff0-4962-8bb7-da06422b6593");
+    sut.insert(1U, 3U);
+    sut.insert(1U + NUMBER_OF_LISTS, 4U);
+
+    EXPECT_THAT(candidatesOf(1U).size(), Eq(2U));
+    EXPECT_THAT(candidatesOf(1U + NUMBER_OF_LISTS).size(), Eq(2U));
+}
+
+TEST_F(ResourceIndex_test, ErasedPositionsAreNoCandidates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e459757d-23a9-4841-8a11-5d930adfb6ff");
+    sut.insert(1U, 3U);
+    sut.insert(1U, 4U);
+    sut.insert(1U, 5U);
+
+    sut.erase(4U);
+    sut.erase(5U);
+
+    auto candidates = candidatesOf(1U);
+    ASSERT_THAT(candidates.size(), Eq(1U));
+    EXPECT_THAT(candidates[0], Eq(3U));
+
+    sut.erase(3U);
+    EXPECT_TRUE(candidatesOf(1U).empty());
+}
+
+TEST_F(ResourceIndex_test, ErasedPositionCanBeInsertedForAnotherKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d356d0f0-5c22-4ce0-8523-393b39c46555");
+    sut.insert(1U, 3U);
+    sut.erase(3U);
+    sut.insert(2U, 3U);
+
+    EXPECT_TRUE(candidatesOf(1U).empty());
+    ASSERT_THAT(candidatesOf(2U).size(), Eq(1U));
+}
+
+TEST_F(ResourceIndex_test, InsertingAndErasingInvalidPositionsIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb96beaf-e349-401b-b69b-7658e5825206");
+    sut.insert(1U, CAPACITY);
+    sut.insert(1U, 3U);
+    sut.insert(2U, 3U);
+    sut.erase(CAPACITY);
+    sut.erase(4U);
+
+    ASSERT_THAT(candidatesOf(1U).size(), Eq(1U));
+    EXPECT_TRUE(candidatesOf(2U).empty());
+}
+
+TEST_F(ResourceIndex_test, ServiceDescriptionHashDependsOnlyOnTheIdStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb0fb91c-3ed4-4d3b-bb37-ab474fc26907");
+    capro::ServiceDescription service{"a", "bc", "d"};
+    capro::ServiceDescription sameServiceOtherInterface{"a", "bc", "d", {}, capro::Interfaces::DDS};
+    capro::ServiceDescription shiftedIdStrings{"ab", "c", "d"};
+
+    EXPECT_THAT(hashOf(service), Eq(hashOf(sameServiceOtherInterface)));
+    EXPECT_THAT(hashOf(service), Ne(hashOf(shiftedIdStrings)));
+}
+
+} // namespace
@@ -0,0 +1,199 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/log/logging.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_ROUNDS{3U};
+constexpr uint64_t PORTS_PER_ROUND{iox::MAX_PORT_REQUESTS_PER_BATCH};
+constexpr uint64_t NUMBER_OF_CONCURRENT_RUNTIMES{iox::MAX_PROCESS_NUMBER};
+constexpr uint64_t SUBSCRIBERS_PER_CONCURRENT_RUNTIME{3U};
+
+/// @brief every round uses its own services, half of the ports are publishers and half of them subscribers
+iox::capro::ServiceDescription service(const char* method, const uint64_t round, const uint64_t port)
+{
+    return {iox::capro::IdString_t(iox::cxx::TruncateToCapacity, method),
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(round)),
+            iox::capro::IdString_t(iox::cxx::TruncateToCapacity, iox::cxx::convert::toString(port))};
+}
+
+bool isPublisher(const uint64_t port)
+{
+    return port % 2U == 0U;
+}
+
+/// @brief runs the rounds and returns the mean duration of a round in microseconds
+template <typename Round>
+uint64_t meanDurationOfRound(Round round)
+{
+    uint64_t sum{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUNDS; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        round(i);
+        const auto end = std::chrono::steady_clock::now();
+        sum += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    }
+    return sum / NUMBER_OF_ROUNDS;
+}
+
+void printResult(const char* name, const uint64_t durationInMicroseconds)
+{
+    std::cout << std::setw(10) << durationInMicroseconds << " us : " << name << std::endl;
+}
+
+/// @brief requests every port with its own IPC round trip
+uint64_t individualRequests(iox::runtime::PoshRuntime& runtime)
+{
+    return meanDurationOfRound([&](const uint64_t round) {
+        for (uint64_t port = 0U; port < PORTS_PER_ROUND; ++port)
+        {
+            const bool hasPort = isPublisher(port)
+                                     ? runtime.getMiddlewarePublisher(service("individual", round, port)) != nullptr
+                                     : runtime.getMiddlewareSubscriber(service("individual", round, port)) != nullptr;
+            if (!hasPort)
+            {
+                std::cout << "Could not create a port" << std::endl;
+            }
+        }
+    });
+}
+
+/// @brief requests all ports of a round with a single call to PoshRuntime::createPorts
+uint64_t batchedRequests(iox::runtime::PoshRuntime& runtime)
+{
+    return meanDurationOfRound([&](const uint64_t round) {
+        iox::runtime::PortRequestContainer requests;
+        for (uint64_t port = 0U; port < PORTS_PER_ROUND; ++port)
+        {
+            requests.emplace_back(isPublisher(port)
+                                      ? iox::runtime::PortRequest::publisher(service("batched", round, port))
+                                      : iox::runtime::PortRequest::subscriber(service("batched", round, port)));
+        }
+        for (const auto& result : runtime.createPorts(requests))
+        {
+            if (result.publisherPortData == nullptr && result.subscriberPortData == nullptr)
+            {
+                std::cout << "Could not create a port" << std::endl;
+            }
+        }
+    });
+}
+
+/// @brief the runtimes register at the same time from their own threads, every runtime requests a publisher for its
+/// own service and subscribers for the services of the next runtimes with a single call to PoshRuntime::createPorts
+/// @return the duration until all runtimes are registered and have their ports in microseconds
+uint64_t concurrentStartup(const uint32_t runtimeMessageWorkers)
+{
+    iox::roudi::RouDiEnvironment roudiEnv{
+        iox::RouDiConfig_t().setDefaults(), iox::roudi::MonitoringMode::OFF, 0U, runtimeMessageWorkers};
+
+    std::mutex startMutex;
+    std::condition_variable startCondition;
+    bool isStarted{false};
+    std::atomic<uint64_t> failedRequests{0U};
+
+    std::vector<std::thread> runtimeThreads;
+    for (uint64_t i = 0U; i < NUMBER_OF_CONCURRENT_RUNTIMES; ++i)
+    {
+        runtimeThreads.emplace_back([&, i] {
+            {
+                std::unique_lock<std::mutex> lock(startMutex);
+                startCondition.wait(lock, [&] { return isStarted; });
+            }
+
+            auto& runtime = iox::runtime::PoshRuntime::initRuntime(
+                iox::RuntimeName_t(iox::cxx::TruncateToCapacity, "iox-bm-startup-" + iox::cxx::convert::toString(i)));
+
+            iox::runtime::PortRequestContainer requests;
+            requests.emplace_back(iox::runtime::PortRequest::publisher(service("concurrent", i, 0U)));
+            for (uint64_t j = 1U; j <= SUBSCRIBERS_PER_CONCURRENT_RUNTIME; ++j)
+            {
+                requests.emplace_back(iox::runtime::PortRequest::subscriber(
+                    service("concurrent", (i + j) % NUMBER_OF_CONCURRENT_RUNTIMES, 0U)));
+            }
+            for (const auto& result : runtime.createPorts(requests))
+            {
+                if (result.publisherPortData == nullptr && result.subscriberPortData == nullptr)
+                {
+                    ++failedRequests;
+                }
+            }
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(startMutex);
+        isStarted = true;
+    }
+    startCondition.notify_all();
+    for (auto& runtimeThread : runtimeThreads)
+    {
+        runtimeThread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    if (failedRequests > 0U)
+    {
+        std::cout << "Could not create " << failedRequests << " ports" << std::endl;
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+} // namespace
+
+int main()
+{
+    iox::log::Logger::init(iox::log::LogLevel::ERROR);
+
+    {
+        iox::roudi::RouDiEnvironment roudiEnv{iox::RouDiConfig_t().setDefaults()};
+        auto& runtime = iox::runtime::PoshRuntime::initRuntime("iox-bm-startup");
+
+        std::cout << "mean duration to create " << PORTS_PER_ROUND << " ports, " << NUMBER_OF_ROUNDS << " rounds"
+                  << std::endl;
+        printResult("individualRequests", individualRequests(runtime));
+        printResult("batchedRequests", batchedRequests(runtime));
+    }
+
+    std::cout << "duration until " << NUMBER_OF_CONCURRENT_RUNTIMES
+              << " concurrently registering runtimes have their ports" << std::endl;
+    for (const uint32_t runtimeMessageWorkers : {1U, 2U, 4U, 8U})
+    {
+        const std::string name =
+            "concurrentStartup, " + iox::cxx::convert::toString(runtimeMessageWorkers) + " workers";
+        printResult(name.c_str(), concurrentStartup(runtimeMessageWorkers));
+    }
+
+    return 0;
+}
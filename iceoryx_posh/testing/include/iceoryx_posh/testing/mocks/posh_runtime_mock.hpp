@@ -61,6 +61,10 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                  const iox::popo::SubscriberOptions&,
                  const iox::runtime::PortConfigInfo&),
                 (noexcept, override));
+    MOCK_METHOD(iox::runtime::PortRequestResultContainer,
+                createPorts,
+                (const iox::runtime::PortRequestContainer&),
+                (noexcept, override));
     MOCK_METHOD(iox::popo::ClientPortUser::MemberType_t*,
                 getMiddlewareClient,
                 (const iox::capro::ServiceDescription&,